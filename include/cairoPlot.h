@@ -243,6 +243,22 @@ extern "C" {
     int cairoPlot2d (cairo_t* cr, PLOT_DIAG *pDiag);
 
 
+/* FUNCTION *******************************************************************/
+/** Plots a further graph (dashed) into a diagram, which was drawn by a
+ *  preceding call of cairoPlot2d(). The axes and the graph rectangle are
+ *  taken from \p pDiag as returned by cairoPlot2d(), so only the callbacks
+ *  (and the user data pointer) of \p pDiag should be changed in between.
+ *
+ *  \param cr           \e Cairo context for drawing.
+ *  \param pDiag        Pointer to plot descriptor (after cairoPlot2d()).
+ *
+ *  \return             The number of samples taken to draw this graph
+ *                      (independent of a possible break) or a negative
+ *                      number on error.
+ ******************************************************************************/
+    int cairoPlotOverlay (cairo_t* cr, PLOT_DIAG *pDiag);
+
+
 
 /* FUNCTION *******************************************************************/
 /** Checks the plot range of an axis against some predefined limits. If the
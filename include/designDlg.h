@@ -11,9 +11,7 @@
 /* INCLUDE FILES **************************************************************/
 
 #include "gui.h"
-#include "miscFilter.h"
-#include "linFirFilter.h"
-#include "stdIirFilter.h"
+#include "filterDesign.h"
 
 
 #ifdef  __cplusplus
@@ -24,26 +22,6 @@ extern "C" {
 /* GLOBAL TYPE DECLARATIONS ***************************************************/
 
 
-/** First four common elements in a designs.
- */
-typedef struct
-{
-    int type;            /**< Filter type. \attention Must be the 1st element */
-    int order;       /**< Order of filter. \attention Must be the 2nd element */
-    double cutoff;  /**< Cutoff frequency. \attention Must be the 3rd element */
-    FTRDESIGN ftr; /**< Frequency transformation data. \attention Must be the 4th element */
-} DESIGNDLG_COMMON;
-
-
-/** Dialog data of a filter.
- */
-typedef union dlg
-{
-    MISCFLT_DESIGN miscFlt;             /**< Miscellaneous filter design data */
-    LINFIR_DESIGN linFir;                           /**< Lin. FIR design data */
-    STDIIR_DESIGN stdIir;                /**< Standard IIR filter design data */
-    DESIGNDLG_COMMON all;     /**< For generic access (not a specific design) */
-} DESIGNDLG;
 
 
 
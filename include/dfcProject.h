@@ -11,7 +11,7 @@
 /* INCLUDE FILES **************************************************************/
 
 #include "dfcgen.h"
-#include "designDlg.h"
+#include "filterDesign.h"
 
 
 #ifdef  __cplusplus
@@ -46,6 +46,12 @@ extern "C" {
 
 
 
+/** Filter generator function of a design, e.g. stdIirFilterGen().
+ */
+    typedef int (*DFCPRJ_GEN_FUNC)(DESIGNDLG *pDesign, FLTCOEFF *pFilter);
+
+
+
 /* GLOBAL CONSTANT DECLARATIONS ***********************************************/
 
 
@@ -103,6 +109,37 @@ extern "C" {
     void dfcPrjSetFilter (FLTCLASS type, FLTCOEFF* pFilter, DESIGNDLG *pDesign);
 
 
+/* FUNCTION *******************************************************************/
+/** Generates a filter from its design data, with memoization of the last
+ *  designs. If the same design (filter class, generator, design data and
+ *  sample frequency) was generated before, the filter and the design data
+ *  returned by the generator are taken from the cache. Else the generator is
+ *  called and the (non-critical) result is cached.
+ *
+ *  \note               The cache is guarded by a mutex, which means the
+ *                      function may be called from any thread.
+ *  \note               The roots are cached as returned by the generator,
+ *                      so they are valid only if member \a factor of the
+ *                      filter is unequal to zero. Generators which leave it
+ *                      zero (e.g. linear FIR designs) provide no roots, and
+ *                      neither does a cache hit of their designs.
+ *
+ *  \param fltcls       Filter class (FLTCLASS_MISC, FLTCLASS_LINFIR or
+ *                      FLTCLASS_STDIIR).
+ *  \param genFunc      Generator function of the filter class, e.g.
+ *                      stdIirFilterGen().
+ *  \param pDesign      Pointer to design data, which may be modified by the
+ *                      generator (e.g. the derived lowpass cutoff frequency).
+ *  \param pFilter      Pointer to buffer which gets the generated filter. The
+ *                      member \a f0 must be set before calling.
+ *
+ *  \return             Return code of the generator function, see for
+ *                      example stdIirFilterGen().
+ ******************************************************************************/
+    int dfcPrjFilterGen (FLTCLASS fltcls, DFCPRJ_GEN_FUNC genFunc,
+                         DESIGNDLG *pDesign, FLTCOEFF *pFilter);
+
+
 /* FUNCTION *******************************************************************/
 /** Sets new project information data.
  *
@@ -0,0 +1,135 @@
+/**
+ * \file        filterConv.h
+ * \brief       Block FFT convolution of long FIR filters (partitioned
+ *              overlap-save).
+ * \copyright   Copyright (C) 2006-2022 Ralf Hoppe <dfcgen@rho62.de>
+ */
+
+#ifndef FILTER_CONV_H
+#define FILTER_CONV_H
+
+
+/* INCLUDE FILES **************************************************************/
+
+#include "dfcgen.h"
+
+
+#ifdef  __cplusplus
+extern "C" {
+#endif
+
+
+/* GLOBAL TYPE DECLARATIONS ***************************************************/
+
+
+/** Workspace of a uniformly partitioned overlap-save convolution. The impulse
+ *  response (numerator) is split into \a parts partitions of \a block
+ *  coefficients, each transformed once by an FFT of \a size = 2 \a block.
+ *  The spectra of the last \a parts input blocks are held in a frequency-domain
+ *  delay line, so the latency is one block (independent of the filter length).
+ */
+typedef struct
+{
+    /* public */
+    int taps;                    /**< Number of FIR coefficients (degree+1) */
+    int block;         /**< Block size (partition length), a power of two */
+
+    /* private */
+    int size;                           /**< FFT size (twice block size) */
+    int parts;                                    /**< Number of partitions */
+    int head;              /**< Index of newest spectrum in delay line */
+    double *pPart;            /**< Spectra of partitions (halfcomplex) */
+    double *pDelay;     /**< Frequency-domain delay line (input spectra) */
+    double *pIn;           /**< Last two input blocks (time-domain) */
+    double *pAcc;               /**< Spectrum accumulator and FFT buffer */
+} FLTCONV_WORKSPACE;
+
+
+/* GLOBAL CONSTANT DECLARATIONS ***********************************************/
+
+
+/* GLOBAL VARIABLE DECLARATIONS ***********************************************/
+
+
+/* GLOBAL MACRO DEFINITIONS ***************************************************/
+
+
+/* EXPORTED FUNCTIONS *********************************************************/
+
+
+/* FUNCTION *******************************************************************/
+/** Returns the number of FIR coefficients above which the block FFT
+ *  convolution is faster than the direct form (sample by sample). The
+ *  crossover is measured on first call and cached afterwards. The function
+ *  may be called from any thread; concurrent first calls block until the
+ *  one measurement has finished.
+ *
+ *  \return             Number of taps (crossover threshold).
+ ******************************************************************************/
+    int filterConvCrossover (void);
+
+
+/* FUNCTION *******************************************************************/
+/** Creates a workspace for block FFT convolution.
+ *
+ *  \param pPoly        Pointer to FIR polynomial (impulse response).
+ *  \param block        Requested block size, means latency (rounded up to
+ *                      a power of two). Pass zero for a block size derived
+ *                      from the filter length.
+ *
+ *  \return             Pointer to workspace on success, else NULL (out of
+ *                      memory).
+ ******************************************************************************/
+    FLTCONV_WORKSPACE* filterConvNew (const MATHPOLY *pPoly, int block);
+
+
+/* FUNCTION *******************************************************************/
+/** Filters a sequence of samples by block FFT convolution. Input and output
+ *  buffer may be the same.
+ *
+ *  \param pConv        Pointer to workspace, formerly created by
+ *                      filterConvNew().
+ *  \param in           Input samples.
+ *  \param out          Buffer which gets the output samples.
+ *  \param n            Number of samples (must be a multiple of the block
+ *                      size \a block).
+ *
+ *  \return             Zero on success, else an error number (see errno.h or
+ *                      gsl_errno.h for predefined codes).
+ ******************************************************************************/
+    int filterConvProcess (FLTCONV_WORKSPACE *pConv, const double *in,
+                           double *out, int n);
+
+
+/* FUNCTION *******************************************************************/
+/** Resets the convolution state (all past input samples are set to zero).
+ *
+ *  \param pConv        Pointer to workspace.
+ *
+ ******************************************************************************/
+    void filterConvReset (FLTCONV_WORKSPACE *pConv);
+
+
+/* FUNCTION *******************************************************************/
+/** Free's a block FFT convolution workspace.
+ *
+ *  \param pConv        Pointer to workspace, formerly created by
+ *                      filterConvNew().
+ *
+ ******************************************************************************/
+    void filterConvFree (FLTCONV_WORKSPACE *pConv);
+
+
+
+#ifdef  __cplusplus
+}
+#endif
+
+
+#endif /* FILTER_CONV_H */
+
+
+/******************************************************************************/
+/* END OF FILE                                                                */
+/******************************************************************************/
+
@@ -0,0 +1,73 @@
+/**
+ * \file        filterDesign.h
+ * \brief       Filter design data of all filter classes.
+ * \copyright   Copyright (C) 2006-2022 Ralf Hoppe <dfcgen@rho62.de>
+ */
+
+#ifndef FILTER_DESIGN_H
+#define FILTER_DESIGN_H
+
+
+/* INCLUDE FILES **************************************************************/
+
+#include "miscFilter.h"
+#include "linFirFilter.h"
+#include "stdIirFilter.h"
+
+
+#ifdef  __cplusplus
+extern "C" {
+#endif
+
+
+/* GLOBAL TYPE DECLARATIONS ***************************************************/
+
+
+/** First four common elements in a designs.
+ */
+typedef struct
+{
+    int type;            /**< Filter type. \attention Must be the 1st element */
+    int order;       /**< Order of filter. \attention Must be the 2nd element */
+    double cutoff;  /**< Cutoff frequency. \attention Must be the 3rd element */
+    FTRDESIGN ftr; /**< Frequency transformation data. \attention Must be the 4th element */
+} DESIGNDLG_COMMON;
+
+
+/** Dialog data of a filter.
+ */
+typedef union dlg
+{
+    MISCFLT_DESIGN miscFlt;             /**< Miscellaneous filter design data */
+    LINFIR_DESIGN linFir;                           /**< Lin. FIR design data */
+    STDIIR_DESIGN stdIir;                /**< Standard IIR filter design data */
+    DESIGNDLG_COMMON all;     /**< For generic access (not a specific design) */
+} DESIGNDLG;
+
+
+
+/* GLOBAL CONSTANT DECLARATIONS ***********************************************/
+
+
+/* GLOBAL VARIABLE DECLARATIONS ***********************************************/
+
+
+/* GLOBAL MACRO DEFINITIONS ***************************************************/
+
+
+/* EXPORTED FUNCTIONS *********************************************************/
+
+
+
+#ifdef  __cplusplus
+}
+#endif
+
+
+#endif /* FILTER_DESIGN_H */
+
+
+/******************************************************************************/
+/* END OF FILE                                                                */
+/******************************************************************************/
+
@@ -0,0 +1,156 @@
+/**
+ * \file        filterEngine.h
+ * \brief       Filter engines for (fast) block processing of sample streams.
+ * \copyright   Copyright (C) 2006-2022 Ralf Hoppe <dfcgen@rho62.de>
+ */
+
+#ifndef FILTER_ENGINE_H
+#define FILTER_ENGINE_H
+
+
+/* INCLUDE FILES **************************************************************/
+
+#include "dfcgen.h"
+#include "filterConv.h"
+
+
+#ifdef  __cplusplus
+extern "C" {
+#endif
+
+
+/* GLOBAL TYPE DECLARATIONS ***************************************************/
+
+
+/** Filter engine (implementation) types.
+ */
+typedef enum
+{
+    FLTENGINE_AUTO = 0,                /**< Automatic selection (from filter) */
+    FLTENGINE_DIRECT = 1,                  /**< Direct form II (transposed) */
+    FLTENGINE_BIQUAD = 2,           /**< Cascade of second order sections */
+    FLTENGINE_FFT = 3,         /**< Block FFT convolution (FIR filters only) */
+
+    FLTENGINE_SIZE                    /**< Size of FLTENGINE_TYPE enumeration */
+} FLTENGINE_TYPE;
+
+
+/** Second order section (normalized to \f$a_0=1\f$).
+    \f[
+    H_i(z)=\frac{b_0+b_1 z^{-1}+b_2 z^{-2}}{1+a_1 z^{-1}+a_2 z^{-2}}
+    \f]
+ */
+typedef struct
+{
+    double b0, b1, b2;                           /**< Numerator coefficients */
+    double a1, a2;                             /**< Denominator coefficients */
+} FLTENGINE_SOS;
+
+
+/** Filter engine. The engine applies one filter to \a channels interleaved
+ *  channels. The state of all delay elements is laid out channel-minor (the
+ *  channels of one delay element are adjacent), so that the inner loops run
+ *  over the channels and can be vectorized by the compiler.
+ */
+typedef struct
+{
+    /* public */
+    FLTENGINE_TYPE type;        /**< Engine type (never FLTENGINE_AUTO) */
+    int block;       /**< Number of frames passed to filterEngineProcess()
+                       must be a multiple of it (1 if not block oriented) */
+    int channels;                     /**< Number of (interleaved) channels */
+
+    /* private */
+    int degree;     /**< Degree of direct form resp. number of sections */
+    double *pNum;  /**< Normalized numerator coefficients (direct form) */
+    double *pDen; /**< Normalized denominator coefficients (direct form) */
+    FLTENGINE_SOS *pSos;               /**< Second order sections */
+    double *pState;  /**< Filter state (delay elements, channel-minor) */
+    double *pFrame;   /**< Input frame resp. block of one channel (scratch) */
+    FLTCONV_WORKSPACE **ppConv; /**< Block FFT convolutions (per channel) */
+} FLTENGINE;
+
+
+/* GLOBAL CONSTANT DECLARATIONS ***********************************************/
+
+
+/* GLOBAL VARIABLE DECLARATIONS ***********************************************/
+
+
+/* GLOBAL MACRO DEFINITIONS ***************************************************/
+
+
+/* EXPORTED FUNCTIONS *********************************************************/
+
+
+/* FUNCTION *******************************************************************/
+/** Creates a filter engine. On FLTENGINE_AUTO the engine is chosen from the
+ *  filter: FIR filters with at least filterConvCrossover() coefficients use
+ *  block FFT convolution, IIR filters of degree greater than two are split
+ *  into second order sections and all others use the direct form. Filters
+ *  with a leading delay (\f$b_0=0\f$) have no gain factor for the first
+ *  section, therefore FLTENGINE_BIQUAD falls back to FLTENGINE_DIRECT on them.
+ *
+ *  \param pFilter      Pointer to filter coefficients. If the roots are
+ *                      invalid (\a factor is zero) they are computed here.
+ *  \param type         Requested engine type.
+ *  \param block        Block size of FFT convolution (zero for default).
+ *  \param channels     Number of interleaved channels (one at least).
+ *  \param ppEngine     Pointer to a buffer which gets the pointer to the new
+ *                      engine (NULL on error).
+ *
+ *  \return             Zero on success, else an error number (see errno.h or
+ *                      gsl_errno.h for predefined codes).
+ ******************************************************************************/
+    int filterEngineNew (const FLTCOEFF *pFilter, FLTENGINE_TYPE type,
+                         int block, int channels, FLTENGINE **ppEngine);
+
+
+/* FUNCTION *******************************************************************/
+/** Filters a sequence of (interleaved) sample frames. Input and output buffer
+ *  may be the same.
+ *
+ *  \param pEngine      Pointer to filter engine.
+ *  \param in           Input samples (\p n times \a channels elements).
+ *  \param out          Buffer which gets the output samples.
+ *  \param n            Number of frames (must be a multiple of \a block).
+ *
+ *  \return             Zero on success, else an error number (see errno.h or
+ *                      gsl_errno.h for predefined codes).
+ ******************************************************************************/
+    int filterEngineProcess (FLTENGINE *pEngine, const double *in,
+                             double *out, int n);
+
+
+/* FUNCTION *******************************************************************/
+/** Resets the filter state (all past samples are set to zero).
+ *
+ *  \param pEngine      Pointer to filter engine.
+ *
+ ******************************************************************************/
+    void filterEngineReset (FLTENGINE *pEngine);
+
+
+/* FUNCTION *******************************************************************/
+/** Free's a filter engine.
+ *
+ *  \param pEngine      Pointer to filter engine, formerly created by
+ *                      filterEngineNew().
+ *
+ ******************************************************************************/
+    void filterEngineFree (FLTENGINE *pEngine);
+
+
+
+#ifdef  __cplusplus
+}
+#endif
+
+
+#endif /* FILTER_ENGINE_H */
+
+
+/******************************************************************************/
+/* END OF FILE                                                                */
+/******************************************************************************/
+
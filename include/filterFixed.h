@@ -0,0 +1,179 @@
+/**
+ * \file        filterFixed.h
+ * \brief       Fixed-point (Q15/Q31) filter simulation.
+ * \copyright   Copyright (C) 2006-2022 Ralf Hoppe <dfcgen@rho62.de>
+ */
+
+#ifndef FILTER_FIXED_H
+#define FILTER_FIXED_H
+
+
+/* INCLUDE FILES **************************************************************/
+
+#include "dfcgen.h"
+
+
+#ifdef  __cplusplus
+extern "C" {
+#endif
+
+
+/* GLOBAL TYPE DECLARATIONS ***************************************************/
+
+
+/** Fixed-point formats (wordlength of samples and coefficients).
+ */
+typedef enum
+{
+    FLTFIXED_Q15 = 0,                  /**< 16 bit words, 32 bit products */
+    FLTFIXED_Q31 = 1,                  /**< 32 bit words, 64 bit products */
+
+    FLTFIXED_SIZE                    /**< Size of FLTFIXED_FORMAT enumeration */
+} FLTFIXED_FORMAT;
+
+
+/** Rounding of the accumulator when shifted back to the sample format.
+ */
+typedef enum
+{
+    FLTFIXED_ROUND_TRUNC = 0,        /**< Truncation (towards minus infinity) */
+    FLTFIXED_ROUND_NEAREST = 1,     /**< Round to nearest (halfway rounds up) */
+    FLTFIXED_ROUND_CONVERGENT = 2, /**< Round to nearest (halfway to even) */
+
+    FLTFIXED_ROUND_SIZE                /**< Size of FLTFIXED_ROUND enumeration */
+} FLTFIXED_ROUND;
+
+
+/** Fixed-point filter (direct form I). Numerator and denominator are
+ *  normalized to \f$a_0=1\f$ and quantized to the wordlength of \a format,
+ *  scaled by \f$2^{-frac}\f$ (so that the greatest coefficient just fits).
+ *  Products are summed up in a 64 bit accumulator, which is shifted back
+ *  (with rounding) and saturated to the sample format.
+ */
+typedef struct
+{
+    /* public */
+    FLTFIXED_FORMAT format;                         /**< Fixed-point format */
+    FLTFIXED_ROUND rounding;                           /**< Rounding mode */
+    int frac;               /**< Number of fractional bits of coefficients */
+    FLTCOEFF coeff;  /**< Quantized coefficients (for frequency responses) */
+    gsize overflows;           /**< Number of saturated output samples */
+
+    /* private */
+    int guard;   /**< Guard bits (right shift of Q31 products before summing) */
+    int taps;           /**< Number of numerator coefficients (degree + 1) */
+    int poles;                                   /**< Degree of denominator */
+    gint32 *pNum;                     /**< Quantized numerator coefficients */
+    gint32 *pDen;   /**< Quantized (negated) denominator coefficients a1...an */
+    gint32 *pIn;  /**< Input history (twice \a taps, newest at \a posIn) */
+    gint32 *pOut;  /**< Output history (twice \a poles, newest at \a posOut) */
+    int posIn;                             /**< Index of newest input sample */
+    int posOut;                           /**< Index of newest output sample */
+} FLTFIXED;
+
+
+/* GLOBAL CONSTANT DECLARATIONS ***********************************************/
+
+
+/* GLOBAL VARIABLE DECLARATIONS ***********************************************/
+
+
+/* GLOBAL MACRO DEFINITIONS ***************************************************/
+
+
+/* EXPORTED FUNCTIONS *********************************************************/
+
+
+/* FUNCTION *******************************************************************/
+/** Creates a fixed-point filter by quantization of filter coefficients.
+ *
+ *  \param pFilter      Pointer to filter coefficients.
+ *  \param format       Fixed-point format.
+ *  \param rounding     Rounding mode.
+ *  \param ppFixed      Pointer to a buffer which gets the pointer to the new
+ *                      fixed-point filter (NULL on error).
+ *
+ *  \return             Zero on success, else an error number (see errno.h or
+ *                      gsl_errno.h for predefined codes).
+ ******************************************************************************/
+    int filterFixedNew (const FLTCOEFF *pFilter, FLTFIXED_FORMAT format,
+                        FLTFIXED_ROUND rounding, FLTFIXED **ppFixed);
+
+
+/* FUNCTION *******************************************************************/
+/** Filters a sequence of Q15 samples.
+ *
+ *  \param pFixed       Pointer to fixed-point filter (format FLTFIXED_Q15).
+ *  \param in           Input samples.
+ *  \param out          Buffer which gets the output samples (may be the
+ *                      same as \p in).
+ *  \param n            Number of samples.
+ *
+ ******************************************************************************/
+    void filterFixedProcessQ15 (FLTFIXED *pFixed, const gint16 *in,
+                                gint16 *out, int n);
+
+
+/* FUNCTION *******************************************************************/
+/** Filters a sequence of Q31 samples.
+ *
+ *  \param pFixed       Pointer to fixed-point filter (format FLTFIXED_Q31).
+ *  \param in           Input samples.
+ *  \param out          Buffer which gets the output samples (may be the
+ *                      same as \p in).
+ *  \param n            Number of samples.
+ *
+ ******************************************************************************/
+    void filterFixedProcessQ31 (FLTFIXED *pFixed, const gint32 *in,
+                                gint32 *out, int n);
+
+
+/* FUNCTION *******************************************************************/
+/** Filters a sequence of floating-point samples. The input samples are
+ *  quantized (with the rounding mode of the filter and saturation) to the
+ *  fixed-point format, filtered and converted back.
+ *
+ *  \param pFixed       Pointer to fixed-point filter.
+ *  \param in           Input samples (full scale is \f$\pm 1\f$).
+ *  \param out          Buffer which gets the output samples (may be the
+ *                      same as \p in).
+ *  \param n            Number of samples.
+ *
+ ******************************************************************************/
+    void filterFixedProcess (FLTFIXED *pFixed, const double *in,
+                             double *out, int n);
+
+
+/* FUNCTION *******************************************************************/
+/** Resets the filter state (all past samples are set to zero) and the
+ *  overflow counter.
+ *
+ *  \param pFixed       Pointer to fixed-point filter.
+ *
+ ******************************************************************************/
+    void filterFixedReset (FLTFIXED *pFixed);
+
+
+/* FUNCTION *******************************************************************/
+/** Free's a fixed-point filter.
+ *
+ *  \param pFixed       Pointer to fixed-point filter, formerly created by
+ *                      filterFixedNew().
+ *
+ ******************************************************************************/
+    void filterFixedFree (FLTFIXED *pFixed);
+
+
+
+#ifdef  __cplusplus
+}
+#endif
+
+
+#endif /* FILTER_FIXED_H */
+
+
+/******************************************************************************/
+/* END OF FILE                                                                */
+/******************************************************************************/
+
@@ -0,0 +1,84 @@
+/**
+ * \file        filterRemez.h
+ * \brief       Equiripple (Parks-McClellan) design of linear phase FIR filters
+ *              by Remez exchange.
+ * \copyright   Copyright (C) 2006-2022 Ralf Hoppe <dfcgen@rho62.de>
+ */
+
+#ifndef FILTER_REMEZ_H
+#define FILTER_REMEZ_H
+
+
+/* INCLUDE FILES **************************************************************/
+
+#include "dfcgen.h"
+
+
+#ifdef  __cplusplus
+extern "C" {
+#endif
+
+
+/* GLOBAL TYPE DECLARATIONS ***************************************************/
+
+
+/** Frequency band of an equiripple design. All frequencies are normalized to
+ *  the sample frequency, means they are in range \f$0\ldots 0.5\f$.
+ */
+typedef struct
+{
+    double lower;                                     /**< Lower band edge */
+    double upper;                                     /**< Upper band edge */
+    double gain;                            /**< Desired magnitude in band */
+    double weight;         /**< Weight of approximation error (positive) */
+} FLTREMEZ_BAND;
+
+
+/* GLOBAL CONSTANT DECLARATIONS ***********************************************/
+
+
+/* GLOBAL VARIABLE DECLARATIONS ***********************************************/
+
+
+/* GLOBAL MACRO DEFINITIONS ***************************************************/
+
+
+/* EXPORTED FUNCTIONS *********************************************************/
+
+
+/* FUNCTION *******************************************************************/
+/** Designs a linear phase FIR filter with minimum (weighted) Chebyshev error
+ *  in the given bands by the \e Parks-McClellan algorithm. Even degrees
+ *  result in a symmetric filter of type I, odd degrees in type II (which
+ *  forces a zero at \f$f_0/2\f$).
+ *
+ *  \param degree       Degree of filter (number of coefficients minus one).
+ *  \param bands        Number of bands.
+ *  \param band         Array of \p bands non-overlapping bands in ascending
+ *                      order.
+ *  \param coeff        Array of \p degree + 1 elements, which gets the
+ *                      (symmetric) filter coefficients.
+ *  \param pDelta       Pointer to buffer which gets the weighted deviation
+ *                      \f$\delta\f$ of the design (may be NULL). The
+ *                      deviation in band \e i is \f$\delta/w_i\f$.
+ *
+ *  \return             Zero on success, else an error number (see errno.h or
+ *                      gsl_errno.h for predefined codes).
+ ******************************************************************************/
+    int filterRemez (int degree, int bands, const FLTREMEZ_BAND band[],
+                     double coeff[], double *pDelta);
+
+
+
+#ifdef  __cplusplus
+}
+#endif
+
+
+#endif /* FILTER_REMEZ_H */
+
+
+/******************************************************************************/
+/* END OF FILE                                                                */
+/******************************************************************************/
+
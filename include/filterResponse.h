@@ -11,6 +11,9 @@
 /* INCLUDE FILES **************************************************************/
 
 #include "dfcgen.h"
+#include "filterSignal.h"
+#include "filterEngine.h"
+#include "filterFixed.h"
 
 
 #ifdef  __cplusplus
@@ -24,6 +27,7 @@ typedef struct
 {
     /* public */
     int samples;                           /**< Number of samples in interval */
+    int channels; /**< Number of channels (frames by filterResponseTimeNextFrame) */
 
     /* private */
     double curTime;                            /**< Current time (in seconds) */
@@ -33,6 +37,13 @@ typedef struct
     double *pOutBuf;                  /**< Output buffer pointer (per malloc) */
     FLTSIGNAL sig;            /**< Signal type (\e Dirac, \e Heaviside, etc.) */
     const FLTCOEFF *pFilter;                           /**< Pointer to filter */
+    FLTSIGNAL_SOURCE *pSource;  /**< User signal (only if FLTSIGNAL_USER) */
+    double *pSigBuf;         /**< Chunk buffer of input samples (per malloc) */
+    gsize sigLen;                      /**< Number of samples in \a pSigBuf */
+    gsize sigIdx;                  /**< Index of next sample in \a pSigBuf */
+    gsize chunk;               /**< Number of samples (frames) per chunk */
+    FLTENGINE *pEngine;   /**< Filter engine (NULL if the generic loop is used) */
+    FLTFIXED *pFixed;        /**< Fixed-point filter (NULL if not simulated) */
 
 } FLTRESP_TIME_WORKSPACE;
 
@@ -175,6 +186,74 @@ FLTRESP_TIME_WORKSPACE* filterResponseTimeNew (double start, double stop,
                                                FLTSIGNAL type, const FLTCOEFF* pFilter);
 
 
+/* FUNCTION *******************************************************************/
+/** This function creates an workspace for the time response of a fixed-point
+ *  filter. The input signal is quantized to the fixed-point format and
+ *  filtered by integer arithmetic (see filterFixedProcess()).
+ *
+ *  \param start        Time to start (must be positive).
+ *  \param stop         Time to stop (must be positive).
+ *  \param type         Signal type.
+ *  \param pFixed       Pointer to fixed-point filter, formerly created by
+ *                      filterFixedNew(). Its state is reset here and it must
+ *                      exist until the workspace is free'd.
+ *
+ *  \return             Pointer to an workspace for time response calculation
+ *                      via function filterResponseTimeNext(), else NULL (see
+ *                      filterResponseTimeNew()).
+ ******************************************************************************/
+FLTRESP_TIME_WORKSPACE* filterResponseTimeNewFixed (double start, double stop,
+                                                    FLTSIGNAL type,
+                                                    FLTFIXED *pFixed);
+
+
+/* FUNCTION *******************************************************************/
+/** This function creates an workspace for time response calculation on a
+ *  user defined input signal (FLTSIGNAL_USER). The signal is streamed from
+ *  its (memory mapped) file in chunks, starting at the current read position
+ *  of \p pSource. All samples up to \p start are processed too, so that the
+ *  filter state is valid at \p start. FIR filters with more coefficients
+ *  than returned by filterConvCrossover() are processed by block FFT
+ *  convolution.
+ *
+ *  \param start        Time to start (must be positive).
+ *  \param stop         Time to stop (must be positive).
+ *  \param pSource      Pointer to user signal, formerly opened by
+ *                      filterSignalOpen(). It must remain open until the
+ *                      workspace is free'd.
+ *  \param pFilter      Pointer to filter coefficients.
+ *
+ *  \return             Pointer to an workspace for time response calculation
+ *                      via function filterResponseTimeNext(), else NULL (see
+ *                      filterResponseTimeNew()).
+ ******************************************************************************/
+FLTRESP_TIME_WORKSPACE* filterResponseTimeNewUser (double start, double stop,
+                                                   FLTSIGNAL_SOURCE *pSource,
+                                                   const FLTCOEFF* pFilter);
+
+
+/* FUNCTION *******************************************************************/
+/** This function creates an workspace for a multichannel time response on a
+ *  user defined input signal (FLTSIGNAL_USER). All \a channels of \p pSource
+ *  are filtered simultaneously by one filter engine (see filterEngineNew()),
+ *  so use filterResponseTimeNextFrame() to get the output frames.
+ *
+ *  \param start        Time to start (must be positive).
+ *  \param stop         Time to stop (must be positive).
+ *  \param pSource      Pointer to user signal, formerly opened by
+ *                      filterSignalOpen(). It must remain open until the
+ *                      workspace is free'd.
+ *  \param pFilter      Pointer to filter coefficients.
+ *
+ *  \return             Pointer to an workspace for time response calculation
+ *                      via function filterResponseTimeNextFrame(), else NULL
+ *                      (see filterResponseTimeNew()).
+ ******************************************************************************/
+FLTRESP_TIME_WORKSPACE* filterResponseTimeNewFrames (double start, double stop,
+                                                     FLTSIGNAL_SOURCE *pSource,
+                                                     const FLTCOEFF* pFilter);
+
+
 /* FUNCTION *******************************************************************/
 /** Returns the next output sample for a time response.
  *
@@ -190,6 +269,23 @@ FLTRESP_TIME_WORKSPACE* filterResponseTimeNew (double start, double stop,
     double filterResponseTimeNext (FLTRESP_TIME_WORKSPACE *pWorkspace, double *pTime);
 
 
+/* FUNCTION *******************************************************************/
+/** Returns the next output frame (all channels) for a multichannel time
+ *  response.
+ *
+ *  \param pWorkspace   Pointer to time response workspace, formerly created
+ *                      by filterResponseTimeNewFrames().
+ *  \param pTime        Pointer to a variable which gets the next time value.
+ *  \param frame        Buffer which gets the output samples of all
+ *                      \a channels.
+ *
+ *  \return             Zero on success, else an error number (see errno.h or
+ *                      gsl_errno.h for predefined codes).
+ ******************************************************************************/
+    int filterResponseTimeNextFrame (FLTRESP_TIME_WORKSPACE *pWorkspace,
+                                     double *pTime, double *frame);
+
+
 /* FUNCTION *******************************************************************/
 /** Free's a time response workspace.
  *
@@ -0,0 +1,191 @@
+/**
+ * \file        filterSignal.h
+ * \brief       User defined (input) signals for time responses.
+ * \copyright   Copyright (C) 2006-2022 Ralf Hoppe <dfcgen@rho62.de>
+ */
+
+#ifndef FILTER_SIGNAL_H
+#define FILTER_SIGNAL_H
+
+
+/* INCLUDE FILES **************************************************************/
+
+#include "base.h"   /* includes config.h (include before GNU system headers) */
+
+
+#ifdef  __cplusplus
+extern "C" {
+#endif
+
+
+/* GLOBAL TYPE DECLARATIONS ***************************************************/
+
+
+/** File formats of user signals.
+ */
+typedef enum
+{
+    FLTSIGNAL_FORMAT_FLOAT32 = 0, /**< Raw 32 bit floats (host byte order) */
+    FLTSIGNAL_FORMAT_FLOAT64 = 1, /**< Raw 64 bit floats (host byte order) */
+    FLTSIGNAL_FORMAT_WAV = 2, /**< RIFF/WAVE file (PCM 8/16/24/32 bit, IEEE float) */
+
+    FLTSIGNAL_FORMAT_SIZE              /**< Size of FLTSIGNAL_FORMAT enumeration */
+} FLTSIGNAL_FORMAT;
+
+
+/** Sample encodings (private).
+ */
+typedef enum
+{
+    FLTSIGNAL_ENC_U8,                      /**< Unsigned 8 bit PCM (WAV only) */
+    FLTSIGNAL_ENC_S16LE,              /**< Signed 16 bit PCM, little endian */
+    FLTSIGNAL_ENC_S24LE,              /**< Signed 24 bit PCM, little endian */
+    FLTSIGNAL_ENC_S32LE,              /**< Signed 32 bit PCM, little endian */
+    FLTSIGNAL_ENC_F32LE,                 /**< IEEE 32 bit float, little endian */
+    FLTSIGNAL_ENC_F64LE,                 /**< IEEE 64 bit float, little endian */
+    FLTSIGNAL_ENC_F32,                /**< IEEE 32 bit float, host byte order */
+    FLTSIGNAL_ENC_F64                 /**< IEEE 64 bit float, host byte order */
+} FLTSIGNAL_ENC;
+
+
+/** User signal source. The signal file is mapped into memory, which means the
+ *  operating system pages in the data while it is streamed (in chunks) to the
+ *  filter. So even very large captures never get loaded into RAM as a whole.
+ */
+typedef struct
+{
+    /* public */
+    gsize samples;               /**< Number of samples (frames) in the file */
+    int channels;                     /**< Number of (interleaved) channels */
+    int channel;           /**< Channel to be read (0 ... \a channels - 1) */
+    double f0;     /**< Sample frequency from file header (0.0 if unknown) */
+
+    /* private */
+    GMappedFile *pMap;                             /**< Memory mapped file */
+    const guint8 *pData;                       /**< Pointer to first sample */
+    gsize pos;                           /**< Current read position (frame) */
+    int frame;                           /**< Size of one frame (in bytes) */
+    int width;                           /**< Size of one sample (in bytes) */
+    FLTSIGNAL_ENC enc;                                /**< Sample encoding */
+} FLTSIGNAL_SOURCE;
+
+
+/* GLOBAL CONSTANT DECLARATIONS ***********************************************/
+
+
+/* GLOBAL VARIABLE DECLARATIONS ***********************************************/
+
+
+/* GLOBAL MACRO DEFINITIONS ***************************************************/
+
+
+/* EXPORTED FUNCTIONS *********************************************************/
+
+
+/* FUNCTION *******************************************************************/
+/** Opens a user signal file by mapping it into memory. A raw file is assumed
+ *  to hold a single channel of floating-point samples. The format of a WAV
+ *  file is taken from its header.
+ *
+ *  \param filename     Filename of signal file (with path).
+ *  \param format       Format of file.
+ *  \param ppSource     Pointer to a buffer which gets the pointer to the new
+ *                      signal source (NULL on error).
+ *
+ *  \return             Zero on success, else an error number from errno.h.
+ ******************************************************************************/
+    int filterSignalOpen (const char *filename, FLTSIGNAL_FORMAT format,
+                          FLTSIGNAL_SOURCE **ppSource);
+
+
+/* FUNCTION *******************************************************************/
+/** Sets the current read position of a user signal.
+ *
+ *  \param pSource      Pointer to signal source.
+ *  \param pos          New position (index of sample frame).
+ *
+ *  \return             Zero on success, else ERANGE (position behind end
+ *                      of signal).
+ ******************************************************************************/
+    int filterSignalSeek (FLTSIGNAL_SOURCE *pSource, gsize pos);
+
+
+/* FUNCTION *******************************************************************/
+/** Returns the current read position of a user signal.
+ *
+ *  \param pSource      Pointer to signal source.
+ *
+ *  \return             Current position (index of sample frame).
+ ******************************************************************************/
+    gsize filterSignalTell (const FLTSIGNAL_SOURCE *pSource);
+
+
+/* FUNCTION *******************************************************************/
+/** Sets the number of interleaved channels of a raw signal file (a WAV file
+ *  holds it in its header). The read position is reset to the start.
+ *
+ *  \param pSource      Pointer to signal source.
+ *  \param channels     Number of interleaved channels.
+ *
+ *  \return             Zero on success, else EINVAL (no raw file or invalid
+ *                      number of channels).
+ ******************************************************************************/
+    int filterSignalInterleave (FLTSIGNAL_SOURCE *pSource, int channels);
+
+
+/* FUNCTION *******************************************************************/
+/** Reads the next chunk of samples (of channel \a channel) from a user signal
+ *  and converts it into doubles. PCM samples are normalized to the range
+ *  \f$[-1,1)\f$.
+ *
+ *  \param pSource      Pointer to signal source.
+ *  \param buf          Buffer which gets the samples.
+ *  \param size         Number of samples to read (size of \p buf).
+ *
+ *  \return             Number of samples read, which is less than \p size
+ *                      at end of signal.
+ ******************************************************************************/
+    gsize filterSignalRead (FLTSIGNAL_SOURCE *pSource, double *buf, gsize size);
+
+
+/* FUNCTION *******************************************************************/
+/** Reads the next chunk of sample frames (all channels) from a user signal
+ *  and converts it into doubles. The samples are stored interleaved, means
+ *  channel \e c of frame \e i is found at \p buf[i * \a channels + \e c].
+ *  PCM samples are normalized to the range \f$[-1,1)\f$.
+ *
+ *  \param pSource      Pointer to signal source.
+ *  \param buf          Buffer which gets the samples (\p size times
+ *                      \a channels elements).
+ *  \param size         Number of frames to read.
+ *
+ *  \return             Number of frames read, which is less than \p size
+ *                      at end of signal.
+ ******************************************************************************/
+    gsize filterSignalReadFrames (FLTSIGNAL_SOURCE *pSource, double *buf,
+                                  gsize size);
+
+
+/* FUNCTION *******************************************************************/
+/** Closes a user signal (unmaps the file and free's the source).
+ *
+ *  \param pSource      Pointer to signal source, formerly created by
+ *                      filterSignalOpen().
+ *
+ ******************************************************************************/
+    void filterSignalClose (FLTSIGNAL_SOURCE *pSource);
+
+
+
+#ifdef  __cplusplus
+}
+#endif
+
+
+#endif /* FILTER_SIGNAL_H */
+
+
+/******************************************************************************/
+/* END OF FILE                                                                */
+/******************************************************************************/
+
@@ -143,6 +143,52 @@ extern "C" {
     int normFilterMagnitude (FLTCOEFF *pFilter, double f, double refgain);
 
 
+/* FUNCTION *******************************************************************/
+/** Cascades two filters (series connection) into a new filter. This function
+ *  mallocs memory space for filter coefficients and roots of the new filter.
+ *  If the roots of both filters are valid, then the roots of the new filter
+ *  are valid too.
+ *
+ *  \param dest         Destination filter (output), use filterFree() to free
+ *                      all the associated memory.
+ *  \param pFilter1     Pointer to first filter.
+ *  \param pFilter2     Pointer to second filter (same sample frequency).
+ *
+ *  \return             - 0 (or GSL_SUCCESS) if okay.
+ *                      - a negative number (typically GSL_CONTINUE) if a
+ *                        coefficient or the degree has changed, but the filter
+ *                        is valid (FLTERR_WARNING).
+ *                      - a positive error number (typically from errno.h or
+ *                        gsl_errno.h) that something is wrong and no
+ *                        filter was created (FLTERR_CRITICAL).
+ ******************************************************************************/
+    int filterCascade (FLTCOEFF *dest, const FLTCOEFF *pFilter1,
+                       const FLTCOEFF *pFilter2);
+
+
+/* FUNCTION *******************************************************************/
+/** Connects two filters in parallel (sums up the outputs) into a new filter.
+ *  This function mallocs memory space for filter coefficients and roots of
+ *  the new filter. The roots of the new filter are invalid (\a factor is
+ *  zero).
+ *
+ *  \param dest         Destination filter (output), use filterFree() to free
+ *                      all the associated memory.
+ *  \param pFilter1     Pointer to first filter.
+ *  \param pFilter2     Pointer to second filter (same sample frequency).
+ *
+ *  \return             - 0 (or GSL_SUCCESS) if okay.
+ *                      - a negative number (typically GSL_CONTINUE) if a
+ *                        coefficient or the degree has changed, but the filter
+ *                        is valid (FLTERR_WARNING).
+ *                      - a positive error number (typically from errno.h or
+ *                        gsl_errno.h) that something is wrong and no
+ *                        filter was created (FLTERR_CRITICAL).
+ ******************************************************************************/
+    int filterParallel (FLTCOEFF *dest, const FLTCOEFF *pFilter1,
+                        const FLTCOEFF *pFilter2);
+
+
 #ifdef  __cplusplus
 }
 #endif
@@ -0,0 +1,209 @@
+/**
+ * \file        filterSweep.h
+ * \brief       Design-space sweep: generation and evaluation of a grid of
+ *              filter designs on a thread pool.
+ * \copyright   Copyright (C) 2006-2022 Ralf Hoppe <dfcgen@rho62.de>
+ */
+
+#ifndef FILTER_SWEEP_H
+#define FILTER_SWEEP_H
+
+
+/* INCLUDE FILES **************************************************************/
+
+#include "dfcgen.h"
+#include "filterDesign.h"
+
+#include <stdio.h>
+
+
+#ifdef  __cplusplus
+extern "C" {
+#endif
+
+
+/* GLOBAL TYPE DECLARATIONS ***************************************************/
+
+
+/** Metrics of a swept design.
+ */
+typedef enum
+{
+    FLTSWEEP_METRIC_RIPPLE = 0,                    /**< Passband ripple in dB */
+    FLTSWEEP_METRIC_STOPATT = 1,   /**< Stopband attenuation in dB (relative) */
+    FLTSWEEP_METRIC_DELAY = 2,    /**< Max. group delay variation in passband */
+    FLTSWEEP_METRIC_MACS = 3,     /**< Multiply-accumulates per sample (DF I) */
+    FLTSWEEP_METRIC_RADIUS = 4,                      /**< Maximum pole radius */
+
+    FLTSWEEP_METRIC_SIZE                    /**< Size of FLTSWEEP_METRIC enum */
+} FLTSWEEP_METRIC;
+
+
+/** Parameter grid of a sweep. Each list with zero elements keeps the value
+ *  from the base design. The sweep runs over the cartesian product of all
+ *  lists.
+ */
+typedef struct
+{
+    int types;                            /**< Number of elements in \a pType */
+    const int *pType;       /**< Filter types (type enum of the filter class) */
+    int orders;                          /**< Number of elements in \a pOrder */
+    const int *pOrder;                                     /**< Filter orders */
+    int cutoffs;                        /**< Number of elements in \a pCutoff */
+    const double *pCutoff;    /**< Cutoff (HP) or center frequencies (BP, BS) */
+    int windows;                        /**< Number of elements in \a pWindow */
+    const int *pWindow;            /**< DSP windows (linear FIR filters only) */
+} FLTSWEEP_GRID;
+
+
+/** Design of a sweep together with its metrics.
+ */
+typedef struct
+{
+    DESIGNDLG design;                                        /**< Design data */
+    int err;                  /**< Return code of the generator (or GSL_EDOM) */
+    double metric[FLTSWEEP_METRIC_SIZE];  /**< Metrics (NaN if not available) */
+} FLTSWEEP_ITEM;
+
+
+/** Design-space sweep.
+ */
+typedef struct
+{
+    FLTCLASS fltcls;                         /**< Filter class of all designs */
+    double f0;                                          /**< Sample frequency */
+    double width;     /**< Transition bandwidth excluded from pass-/stopbands */
+    int items;                             /**< Number of designs in \a pItem */
+    FLTSWEEP_ITEM *pItem;                     /**< Designs (array per malloc) */
+} FLTSWEEP;
+
+
+
+/* GLOBAL CONSTANT DECLARATIONS ***********************************************/
+
+
+/* GLOBAL VARIABLE DECLARATIONS ***********************************************/
+
+
+/* GLOBAL MACRO DEFINITIONS ***************************************************/
+
+
+/* EXPORTED FUNCTIONS *********************************************************/
+
+
+/* FUNCTION *******************************************************************/
+/** Creates a sweep over a parameter grid.
+ *
+ *  \param fltcls       Filter class (FLTCLASS_MISC, FLTCLASS_LINFIR or
+ *                      FLTCLASS_STDIIR).
+ *  \param pBase        Pointer to base design, which defines all parameters
+ *                      not in the grid.
+ *  \param pGrid        Pointer to parameter grid.
+ *  \param f0           Sample frequency.
+ *  \param width        Transition bandwidth around cutoff frequency (resp.
+ *                      band edges), which is excluded from the passband and
+ *                      stopband metrics.
+ *  \param ppSweep      Pointer to a buffer which gets the pointer to the new
+ *                      sweep (NULL on error).
+ *
+ *  \return             Zero on success, else an error number (see errno.h or
+ *                      gsl_errno.h for predefined codes).
+ ******************************************************************************/
+    int filterSweepNew (FLTCLASS fltcls, const DESIGNDLG *pBase,
+                        const FLTSWEEP_GRID *pGrid, double f0, double width,
+                        FLTSWEEP **ppSweep);
+
+
+/* FUNCTION *******************************************************************/
+/** Generates all designs of a sweep and evaluates their metrics. The designs
+ *  are distributed over a GThreadPool (one thread per processor).
+ *
+ *  \param pSweep       Pointer to sweep.
+ *
+ *  \return             Number of designs which could not be generated
+ *                      (see member \a err of FLTSWEEP_ITEM).
+ ******************************************************************************/
+    int filterSweepRun (FLTSWEEP *pSweep);
+
+
+/* FUNCTION *******************************************************************/
+/** Sorts the designs of a sweep by a metric. Designs with unavailable metric
+ *  (NaN) are sorted to the end.
+ *
+ *  \param pSweep       Pointer to sweep.
+ *  \param metric       Sort key.
+ *  \param descending   If TRUE the designs are sorted in descending order,
+ *                      else in ascending order.
+ *
+ ******************************************************************************/
+    void filterSweepSort (FLTSWEEP *pSweep, FLTSWEEP_METRIC metric,
+                          BOOL descending);
+
+
+/* FUNCTION *******************************************************************/
+/** Writes the designs of a sweep as a table (one row per design) to a stream.
+ *
+ *  \param pSweep       Pointer to sweep.
+ *  \param stream       Output stream.
+ *  \param csv          If TRUE comma separated values are written, else an
+ *                      aligned plain text table.
+ *
+ *  \return             Zero on success, else an error number from errno.h.
+ ******************************************************************************/
+    int filterSweepWrite (const FLTSWEEP *pSweep, FILE *stream, BOOL csv);
+
+
+/* FUNCTION *******************************************************************/
+/** Returns the (command line) name of a filter type.
+ *
+ *  \param fltcls       Filter class.
+ *  \param type         Filter type (type enum of the filter class).
+ *
+ *  \return             Name of filter type, NULL if unknown.
+ ******************************************************************************/
+    const char *filterSweepTypeName (FLTCLASS fltcls, int type);
+
+
+/* FUNCTION *******************************************************************/
+/** Returns the (command line) name of a DSP window of linear FIR filters.
+ *
+ *  \param dspwin       DSP window.
+ *
+ *  \return             Name of window, NULL if unknown.
+ ******************************************************************************/
+    const char *filterSweepWindowName (LINFIR_DSPWIN dspwin);
+
+
+/* FUNCTION *******************************************************************/
+/** Returns the (command line) name of a metric.
+ *
+ *  \param metric       Metric.
+ *
+ *  \return             Name of metric, NULL if unknown.
+ ******************************************************************************/
+    const char *filterSweepMetricName (FLTSWEEP_METRIC metric);
+
+
+/* FUNCTION *******************************************************************/
+/** Free's a sweep.
+ *
+ *  \param pSweep       Pointer to sweep, formerly created by
+ *                      filterSweepNew().
+ *
+ ******************************************************************************/
+    void filterSweepFree (FLTSWEEP *pSweep);
+
+
+
+#ifdef  __cplusplus
+}
+#endif
+
+
+#endif                                                      /* FILTER_SWEEP_H */
+
+
+/******************************************************************************/
+/* END OF FILE                                                                */
+/******************************************************************************/
+
@@ -48,6 +48,10 @@ typedef enum
     LINFIR_TYPE_COS2,                           /**< Square cosinus lowpass */
     LINFIR_TYPE_GAUSS,                                /**< Gaussian lowpass */
     LINFIR_TYPE_SQR,                         /**< Squared 1st order lowpass */
+    LINFIR_TYPE_REMEZ,         /**< Equiripple (Parks-McClellan), no window */
+    LINFIR_TYPE_LSQ,                 /**< Weighted least-squares, no window */
+    LINFIR_TYPE_HALFBAND,       /**< Half-band (Nyquist(2)) lowpass at f0/4 */
+    LINFIR_TYPE_NYQUIST,                 /**< Nyquist(M) lowpass at f0/(2M) */
 
     LINFIR_TYPE_SIZE
 } LINFIR_TYPE;
@@ -64,6 +68,9 @@ typedef struct
     FTRDESIGN ftr; /**< Frequency transformation data. \attention Must be the 4th element */
     LINFIR_DSPWIN dspwin;                       /**< Type of smoothing window */
     double winparm;               /**< Parameter of window, e.g. Kaiser alpha */
+    double width;            /**< Transition bandwidth (equiripple design) */
+    double ripple; /**< Maximum passband ripple in dB (equiripple design) */
+    double minatt; /**< Minimum stopband attenuation in dB (equiripple design) */
 } LINFIR_DESIGN;
 
 
@@ -71,19 +78,53 @@ typedef struct
 
 /* GLOBAL CONSTANT DECLARATIONS ***********************************************/
 
+#define LINFIR_RIPPLE_MIN       (1E-4) /**< Minimum passband ripple (equiripple) */
+#define LINFIR_RIPPLE_MAX       (10*log10(2.0)) /**< Maximum passband ripple (3dB) */
+#define LINFIR_STOPATT_MIN      (10*log10(2.0)) /**< Minimum stopband attenuation (3dB) */
+#define LINFIR_STOPATT_MAX      (300.0) /**< Maximum stopband attenuation (equiripple) */
+
 
 /* GLOBAL VARIABLE DECLARATIONS ***********************************************/
 
 
 /* GLOBAL MACRO DEFINITIONS ***************************************************/
 
+/* MACRO **********************************************************************/
+/** Checks whether a linear FIR filter type is an optimal design, which is
+ *  derived from the tolerance scheme (\a width, \a ripple, \a minatt of
+ *  LINFIR_DESIGN) instead of a DSP window.
+ *
+ *  \param type         Linear FIR filter type (LINFIR_TYPE).
+ *
+ ******************************************************************************/
+#define LINFIR_TYPE_IS_OPTIMAL(type) \
+    (((type) == LINFIR_TYPE_REMEZ) || ((type) == LINFIR_TYPE_LSQ))
+
+
+/* MACRO **********************************************************************/
+/** Checks whether a linear FIR filter type is a \e Nyquist(M) design (with
+ *  half-band as special case \f$M=2\f$). The coefficients \f$c_{n/2\pm kM}\f$
+ *  (\f$k\neq 0\f$) of these designs are exactly zero, and the degree must be
+ *  even.
+ *
+ *  \param type         Linear FIR filter type (LINFIR_TYPE).
+ *
+ ******************************************************************************/
+#define LINFIR_TYPE_IS_NYQUIST(type) \
+    (((type) == LINFIR_TYPE_HALFBAND) || ((type) == LINFIR_TYPE_NYQUIST))
+
+
 
 /* EXPORTED FUNCTIONS *********************************************************/
 
 
 /* FUNCTION *******************************************************************/
 /** Generates a linear FIR filter. The cutoff frequency always is assumed to be
- *  the 3dB point of magnitude response.
+ *  the 3dB point of magnitude response, except for equiripple and
+ *  least-squares designs (LINFIR_TYPE_REMEZ, LINFIR_TYPE_LSQ), where it is
+ *  the center of the transition band. On Nyquist(M) designs the cutoff
+ *  frequency is rounded to \f$f_0/(2M)\f$ (\f$f_0/4\f$ for half-band), and
+ *  the degree must be even.
  *
  *  \param pDesign      Pointer to linear FIR filter design data.
  *  \param pFilter      Pointer to buffer which gets the generated filter.
@@ -96,6 +137,66 @@ typedef struct
 int linFirFilterGen (LINFIR_DESIGN *pDesign, FLTCOEFF *pFilter);
 
 
+/* FUNCTION *******************************************************************/
+/** Generates a linear FIR filter like linFirFilterGen(), but leaves the
+ *  (process global) GSL error handler untouched. The caller must have
+ *  switched it off before, see gsl_set_error_handler_off(). Worker threads
+ *  use this function, because saving and restoring the handler per call
+ *  would race.
+ *
+ *  \param pDesign      Pointer to linear FIR filter design data.
+ *  \param pFilter      Pointer to buffer which gets the generated filter.
+ *
+ *  \return             Zero on success, else an error number (see errno.h or
+ *                      gsl_errno.h for predefined codes).
+ ******************************************************************************/
+int linFirFilterGenWorker (LINFIR_DESIGN *pDesign, FLTCOEFF *pFilter);
+
+
+/* FUNCTION *******************************************************************/
+/** Generates a linear FIR filter of minimum order, which meets the tolerance
+ *  scheme given by passband ripple, stopband attenuation and transition
+ *  bandwidth. The candidate orders are generated in parallel.
+ *
+ *  \param pDesign      Pointer to linear FIR filter design data. The
+ *                      element \a order gets the minimum order found.
+ *  \param pFilter      Pointer to buffer which gets the generated filter
+ *                      (\a f0 must be set).
+ *
+ *  \return             Zero on success, else an error number (see errno.h or
+ *                      gsl_errno.h for predefined codes). GSL_ETOL is
+ *                      returned if no order up to FLT_DEGREE_MAX meets the
+ *                      tolerance scheme.
+ ******************************************************************************/
+int linFirFilterMinOrderGen (LINFIR_DESIGN *pDesign, FLTCOEFF *pFilter);
+
+
+/* FUNCTION *******************************************************************/
+/** Generates a linear FIR filter by frequency sampling of an arbitrary
+ *  response, which is given on a uniform grid from zero to \f$f_0/2\f$. The
+ *  coefficients result from one inverse real FFT, truncated to the filter
+ *  degree and smoothed by a window.
+ *
+ *  \param degree       Degree of filter (number of coefficients minus one).
+ *  \param points       Number of grid points (at least 2).
+ *  \param mag          Array of \p points magnitudes.
+ *  \param phase        Array of \p points excess phases (in radians) on top
+ *                      of the delay by \p degree/2 samples, or NULL for a
+ *                      linear phase filter.
+ *  \param dspwin       Type of smoothing window.
+ *  \param winparm      Parameter of window, e.g. Kaiser alpha.
+ *  \param pFilter      Pointer to buffer which gets the generated filter.
+ *                      Notice, that memory space for polynomials will be
+ *                      allocated.
+ *
+ *  \return             Zero on success, else an error number (see errno.h or
+ *                      gsl_errno.h for predefined codes).
+ ******************************************************************************/
+int linFirFilterSampledGen (int degree, int points, const double mag[],
+                            const double phase[], LINFIR_DSPWIN dspwin,
+                            double winparm, FLTCOEFF *pFilter);
+
+
 #ifdef  __cplusplus
 }
 #endif
@@ -32,13 +32,16 @@ typedef struct
 {
     int degree;                                     /**< Degree of polynomial */
     double *coeff;               /**< Pointer to real polynomial coefficients */
-    gsl_complex *root; /**< Pointer to roots of polynomial (NULL if not evaluated) */
+    gsl_complex *root;  /**< Pointer to roots of polynomial (behind coeffs) */
+    int capacity;       /**< Maximum degree which fits into allocated memory */
 } MATHPOLY;
 
 
 
 /* GLOBAL CONSTANT DECLARATIONS ***********************************************/
 
+#define MATHPOLY_ALIGN          64 /**< Alignment of polynomial memory (bytes) */
+
 
 /* GLOBAL VARIABLE DECLARATIONS ***********************************************/
 
@@ -50,7 +53,9 @@ typedef struct
 
 
 /* FUNCTION *******************************************************************/
-/** Allocates memory space for the coefficients of a polynomial.
+/** Allocates memory space for the coefficients of a polynomial. The memory
+ *  block is the same as allocated by mathPolyMalloc() (with space for the
+ *  roots).
  *
  *  \param poly         Pointer to polynomial.
  *
@@ -60,7 +65,9 @@ typedef struct
 
 
 /* FUNCTION *******************************************************************/
-/** Allocates memory space for the roots of a polynomial.
+/** Allocates memory space for the roots of a polynomial. If the coefficients
+ *  are allocated already (by mathPolyMalloc() or mathPolyMallocCoeffs()),
+ *  then the roots have memory space too and nothing is done.
  *
  *  \param poly         Pointer to polynomial.
  *
@@ -70,7 +77,13 @@ typedef struct
 
 
 /* FUNCTION *******************************************************************/
-/** Allocates memory space for a polynomial.
+/** Allocates memory space for a polynomial. Coefficients and roots are placed
+ *  into one memory block, which is aligned to MATHPOLY_ALIGN bytes:
+ *  - \f$n+1\f$ coefficients (padded to a multiple of MATHPOLY_ALIGN bytes)
+ *  - \f$\max(n,1)\f$ roots (interleaved real and imaginary parts, as
+ *    expected by gsl_poly_complex_solve())
+ *
+ *  with \f$n\f$ the capacity (set to the degree of \p poly).
  *
  *  \param poly         Pointer to polynomial.
  *
@@ -79,6 +92,21 @@ typedef struct
     int mathPolyMalloc (MATHPOLY *poly);
 
 
+/* FUNCTION *******************************************************************/
+/** Changes the degree of a polynomial. If the new degree exceeds the capacity
+ *  of the polynomial, then a new memory block is allocated, which gets the
+ *  coefficients and roots (up to the old degree). Else only the degree is
+ *  changed (the memory is not touched).
+ *
+ *  \param poly         Pointer to polynomial (allocated by mathPolyMalloc()).
+ *  \param degree       New degree of polynomial.
+ *
+ *  \return             0 on success, else an error number (the polynomial is
+ *                      unchanged in that case).
+ ******************************************************************************/
+    int mathPolyRealloc (MATHPOLY *poly, int degree);
+
+
 /* FUNCTION *******************************************************************/
 /** Frees memory space allocated for a polynomial.
  *
@@ -88,17 +116,48 @@ typedef struct
     void mathPolyFree (MATHPOLY *poly);
 
 
+/* FUNCTION *******************************************************************/
+/** Opens a scratch arena for the calling thread. Until the matching call of
+ *  mathPolyArenaEnd() all temporary buffers of the polynomial functions (and
+ *  all polynomials allocated by mathPolyMallocScratch()) are taken from this
+ *  arena, which avoids the allocator churn when generating many filters.
+ *  Calls may be nested, then the arena is released by the outermost
+ *  mathPolyArenaEnd().
+ *
+ ******************************************************************************/
+    void mathPolyArenaBegin (void);
+
+
+/* FUNCTION *******************************************************************/
+/** Closes the scratch arena of the calling thread, opened by
+ *  mathPolyArenaBegin(). The outermost call releases all memory of the arena
+ *  in one shot, so any polynomial allocated by mathPolyMallocScratch() is
+ *  invalid afterwards.
+ *
+ ******************************************************************************/
+    void mathPolyArenaEnd (void);
+
+
+/* FUNCTION *******************************************************************/
+/** Allocates memory space for a temporary polynomial. The memory layout is
+ *  the same as from mathPolyMalloc(), but the memory is taken from the scratch
+ *  arena of the calling thread (if any, see mathPolyArenaBegin()). Use
+ *  mathPolyFree() as usual, which is a no-op for arena memory.
+ *
+ *  \param poly         Pointer to polynomial.
+ *
+ *  \return             0 on success, else an error number.
+ ******************************************************************************/
+    int mathPolyMallocScratch (MATHPOLY *poly);
+
+
 /* FUNCTION *******************************************************************/
 /** Calculates real polynomial coefficients from roots. The calculation of
  *  polynomial coefficients \f$c_i\f$ of
     \f[
     p(z)=c_n z^n + c_{n-1} z^{n-1}+ \cdots + c_2 z^2 + c_1 z + c_0
     \f]
-    is performed using the following algorithm:
-    \f[
-    p_{i+1}(z)=p_{i}(z) (z-z_i)=z p_{i}(z)-z_i p_{i}(z)
-    \f]
- *  with \f$p_{0}(z)=1\f$.
+ *  is performed by mathPolyExpand() with \e Leja ordering.
  *
  *  \param poly         Pointer to polynomial that holds the roots in \p
  *                      poly->root and gets the coefficients in \p poly->coeff.
@@ -106,18 +165,51 @@ typedef struct
  *                      roots representation to a polynomial polynomial the
  *                      coefficient \f$p_n\f$ must be multiplied as \p factor.
  *
- *  \return             GSL_SUCCESS on success, else an error number (see
+ *  \return             Zero on success, else an error number (see errno.h or
  *                      gsl_errno.h for predefined codes).
  ******************************************************************************/
     int mathPolyRoots2Coeffs (MATHPOLY *poly, double factor);
 
 
+/* FUNCTION *******************************************************************/
+/** Expands a real polynomial from its roots. The roots are combined into
+ *  real linear and quadratic factors (conjugate complex pairs), which are
+ *  multiplied in a balanced product tree
+    \f[
+    p(z)=c_n\prod_{i=1}^{m}q_i(z)=c_n\,
+    \Bigl((q_1 q_2)(q_3 q_4)\Bigr)\Bigl((q_5 q_6)(q_7 q_8)\Bigr)\cdots
+    \f]
+ *  in real arithmetic. On the upper levels of the tree the products are
+ *  computed by real FFT's, which results in
+ *  \f$O(n\log^2 n)\f$ operations (instead of \f$O(n^2)\f$ when multiplying
+ *  one linear factor after the other). Optionally the factors are sorted into
+ *  \e Leja order before (\f$O(n^2)\f$), which limits the error growth for
+ *  roots with greatly differing moduli.
+ *
+ *  \param poly         Pointer to polynomial that holds the roots in \p
+ *                      poly->root and gets the coefficients in \p poly->coeff.
+ *                      The roots must be real or conjugate complex pairs.
+ *  \param factor       Factor to be applied to all coefficients (means the
+ *                      coefficient \f$c_n\f$).
+ *  \param leja         If TRUE the factors are multiplied in \e Leja order.
+ *
+ *  \return             Zero on success, else an error number (see errno.h or
+ *                      gsl_errno.h for predefined codes).
+ ******************************************************************************/
+    int mathPolyExpand (MATHPOLY *poly, double factor, BOOL leja);
+
+
 /* FUNCTION *******************************************************************/
 /** Computes the complex roots \f$z_i\f$ associated with the polynomial
     \f[
     p(z)=c_n z^n + c_{n-1} z^{n-1}+ \cdots + c_2 z^2 + c_1 z + c_0
     \f]
  *
+ *  Polynomials of higher degree are solved by \e Aberth-Ehrlich iteration
+ *  (\f$O(n^2)\f$ per iteration), all others (and those where the iteration
+ *  fails) by the companion matrix method of gsl_poly_complex_solve()
+ *  (\f$O(n^3)\f$).
+ *
  *  \param poly         Pointer to polynomial that holds the coefficients in
  *                      \p poly->coeff and gets the roots in \p poly->roots.
  *
@@ -129,6 +221,28 @@ typedef struct
     int mathPolyCoeffs2Roots (MATHPOLY *poly);
 
 
+/* FUNCTION *******************************************************************/
+/** Computes the complex roots of a polynomial like mathPolyCoeffs2Roots(),
+ *  but starts the \e Aberth-Ehrlich iteration from the roots in
+ *  \p poly->root (warm start). After a small change of the coefficients the
+ *  old roots are good approximations, so that only a few iterations are
+ *  needed.
+ *
+ *  \param poly         Pointer to polynomial that holds the coefficients in
+ *                      \p poly->coeff and the approximations (from the
+ *                      polynomial before change) in \p poly->roots, which are
+ *                      replaced by the new roots.
+ *  \param maxiter      Maximum number of iterations.
+ *
+ *  \return             Zero on success, else an error number (see gsl_errno.h
+ *                      for predefined codes). In case of error (GSL_EMAXITER
+ *                      if the iteration not converges) the roots are
+ *                      undefined and should be computed from scratch using
+ *                      mathPolyCoeffs2Roots().
+ ******************************************************************************/
+    int mathPolyCoeffs2RootsWarm (MATHPOLY *poly, int maxiter);
+
+
 
 /* FUNCTION *******************************************************************/
 /** Adds two polynomials with scaling.
@@ -168,6 +282,26 @@ typedef struct
     void mathPolyMulBinomial (MATHPOLY *poly, int degn, double a, double b);
 
 
+/* FUNCTION *******************************************************************/
+/** Multiplies two polynomials. Polynomials of small degree are multiplied
+ *  by the schoolbook method, those where both degrees are greater than or
+ *  equal to MATHPOLY_MUL_FFT_DEGREE by real FFT's (\f$O(n\log n)\f$).
+ *  The roots of \p result are not touched.
+ *
+ *  \param result       Pointer to polynomial which gets the product. The
+ *                      coefficients vector must be large enough to get
+ *                      \f$\deg p_1+\deg p_2+1\f$ coefficients and must not
+ *                      overlap with one of the factors.
+ *  \param poly1        Pointer to first polynomial \f$p_1\f$.
+ *  \param poly2        Pointer to second polynomial \f$p_2\f$.
+ *
+ *  \return             Zero on success, else an error number (see errno.h or
+ *                      gsl_errno.h for predefined codes).
+ ******************************************************************************/
+    int mathPolyMul (MATHPOLY *result, const MATHPOLY *poly1,
+                     const MATHPOLY *poly2);
+
+
 /* FUNCTION *******************************************************************/
 /** Transforms polynomial coefficients for fractional variable substitution.
  *  The function transforms the polynomial
@@ -11,6 +11,8 @@
 /* INCLUDE FILES **************************************************************/
 
 #include "cairoPlot.h"
+#include "filterFixed.h"
+#include "filterSignal.h"
 
 
 #ifdef  __cplusplus
@@ -33,6 +35,7 @@ typedef enum
     RESPONSE_TYPE_GROUP,                                   /**< group delay */
     RESPONSE_TYPE_IMPULSE,                /**< time-domain impulse response */
     RESPONSE_TYPE_STEP,                      /**< time-domain step response */
+    RESPONSE_TYPE_SIGNAL,          /**< time-domain response on a user signal */
 
     RESPONSE_TYPE_SIZE               /**< administrative value (array size) */
 } RESPONSE_TYPE;
@@ -84,6 +87,43 @@ typedef enum
     int responsePlotDraw (cairo_t* cr, RESPONSE_TYPE type, PLOT_DIAG *pDiag);
 
 
+/* FUNCTION *******************************************************************/
+/** Sets the fixed-point simulation for all response plots. If enabled, the
+ *  response of the quantized filter is drawn (dashed) next to the ideal one.
+ *
+ *  \param format       Fixed-point format, FLTFIXED_SIZE disables the
+ *                      simulation.
+ *  \param rounding     Rounding mode.
+ *
+ ******************************************************************************/
+    void responsePlotSetFixed (FLTFIXED_FORMAT format, FLTFIXED_ROUND rounding);
+
+
+/* FUNCTION *******************************************************************/
+/** Gets the fixed-point simulation of all response plots, as set by function
+ *  responsePlotSetFixed().
+ *
+ *  \param pFormat      Pointer to buffer for fixed-point format (FLTFIXED_SIZE
+ *                      if the simulation is disabled).
+ *  \param pRounding    Pointer to buffer for rounding mode.
+ *
+ ******************************************************************************/
+    void responsePlotGetFixed (FLTFIXED_FORMAT *pFormat,
+                               FLTFIXED_ROUND *pRounding);
+
+
+/* FUNCTION *******************************************************************/
+/** Sets the user signal for the time response plot RESPONSE_TYPE_SIGNAL.
+ *  The response plot module takes over the signal source and closes it (by
+ *  filterSignalClose()) when another signal is set.
+ *
+ *  \param pSource      Pointer to user signal, formerly opened by
+ *                      filterSignalOpen(). Pass NULL to remove the signal.
+ *
+ ******************************************************************************/
+    void responsePlotSetSignal (FLTSIGNAL_SOURCE *pSource);
+
+
 
 #ifdef  __cplusplus
 }
@@ -57,6 +57,46 @@ extern "C" {
     void responseWinRedraw (RESPONSE_TYPE type);
 
 
+/* FUNCTION *******************************************************************/
+/** Selects the fixed-point format of the quantized filter, which is drawn
+ *  next to the ideal one in all response windows. This function should be
+ *  called if a \e GtkRadioMenuItem from the \e Fixed-Point submenu receives
+ *  an \e activate event.
+ *
+ *  \param menuitem     Menu item which has received the \e activate event.
+ *  \param user_data    Fixed-point format (FLTFIXED_FORMAT), FLTFIXED_SIZE
+ *                      disables the simulation.
+ *
+ ******************************************************************************/
+    void responseWinFixedActivate (GtkMenuItem* menuitem, gpointer user_data);
+
+
+/* FUNCTION *******************************************************************/
+/** Selects the rounding mode of the fixed-point simulation. This function
+ *  should be called if a \e GtkRadioMenuItem from the \e Fixed-Point
+ *  submenu receives an \e activate event.
+ *
+ *  \param menuitem     Menu item which has received the \e activate event.
+ *  \param user_data    Rounding mode (FLTFIXED_ROUND).
+ *
+ ******************************************************************************/
+    void responseWinRoundActivate (GtkMenuItem* menuitem, gpointer user_data);
+
+
+/* FUNCTION *******************************************************************/
+/** Loads the user signal of the time response plot (in window
+ *  RESPONSE_TYPE_SIGNAL) from a raw or WAV file. This function should be
+ *  called if the \e Load \e User \e Signal menu item receives an
+ *  \e activate event.
+ *
+ *  \param srcWidget    Widget which has received the \e activate event.
+ *  \param user_data    User data set when the signal handler was connected
+ *                      (unused).
+ *
+ ******************************************************************************/
+    void responseWinSignalActivate (GtkWidget* srcWidget, gpointer user_data);
+
+
 #ifdef  __cplusplus
 }
 #endif
@@ -45,7 +45,9 @@ extern "C" {
 
 
 /* FUNCTION *******************************************************************/
-/** Re-calculates the roots of transfer \f$H(z)\f$ of a filter.
+/** Re-calculates the roots of transfer \f$H(z)\f$ of a filter. If the filter
+ *  comes with a valid roots representation (\a factor is not zero), e.g.
+ *  from the standard IIR filter generator, then the roots are only redrawn.
  *
  *  \param pFilter      Pointer to filter coefficients, for which the roots
  *                      shall be calculated. Set this to NULL, if the filter
@@ -55,6 +57,22 @@ extern "C" {
     void rootsPlotUpdate (FLTCOEFF *pFilter);
 
 
+/* FUNCTION *******************************************************************/
+/** Re-calculates the roots of transfer \f$H(z)\f$ of a filter after a (small)
+ *  change of coefficients, but not of the degrees (root tracking). The roots
+ *  of the filter before change are used as start values, so that typically
+ *  a few iterations are needed to get the new roots. If the iteration not
+ *  converges, then the roots are computed from scratch.
+ *
+ *  \param pFilter      Pointer to filter coefficients, which holds the roots
+ *                      of the filter before change (or \a factor is zero if
+ *                      these are invalid). Set this to NULL, if the filter
+ *                      (and therefore the roots too) is invalid.
+ *
+ ******************************************************************************/
+    void rootsPlotTrack (FLTCOEFF *pFilter);
+
+
 
 /* FUNCTION *******************************************************************/
 /** Forces a asynchronous redraw of all transfer function roots.
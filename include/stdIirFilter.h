@@ -68,6 +68,7 @@ typedef struct
     double ripple; /**< Maximum passband (ripple) attenuation in dB (elliptic filter) */
     double minatt;  /**< Minimum stopband attenuation in dB (elliptic filter) */
     double angle;                         /**< Module angle (\e Cauer filter) */
+    double width;       /**< Transition bandwidth (minimum order calculation) */
 } STDIIR_DESIGN;
 
 
@@ -101,7 +102,10 @@ typedef struct
  *  \param pDesign      Pointer to standard IIR design data.
  *  \param pFilter      Pointer to buffer which gets the generated filter.
  *                      Notice, that memory space for polynomials will be
- *                      allocated.
+ *                      allocated. Except for \e Bessel filters the analytic
+ *                      roots of the approximation are mapped into Z domain,
+ *                      means the filter comes with valid roots (\a factor
+ *                      is not zero).
  *
  *  \return             Zero on success, else an error number (see errno.h or
  *                      gsl_errno.h for predefined codes).
@@ -109,6 +113,40 @@ typedef struct
 int stdIirFilterGen (STDIIR_DESIGN *pDesign, FLTCOEFF *pFilter);
 
 
+/* FUNCTION *******************************************************************/
+/** Generates an IIR filter like stdIirFilterGen(), but leaves the (process
+ *  global) GSL error handler untouched. The caller must have switched it off
+ *  before, see gsl_set_error_handler_off(). Worker threads use this function,
+ *  because saving and restoring the handler per call would race.
+ *
+ *  \param pDesign      Pointer to standard IIR design data.
+ *  \param pFilter      Pointer to buffer which gets the generated filter.
+ *
+ *  \return             Zero on success, else an error number (see errno.h or
+ *                      gsl_errno.h for predefined codes).
+ ******************************************************************************/
+int stdIirFilterGenWorker (STDIIR_DESIGN *pDesign, FLTCOEFF *pFilter);
+
+
+/* FUNCTION *******************************************************************/
+/** Calculates the minimum order of a standard IIR filter, which meets the
+ *  tolerance scheme given by \a ripple, \a minatt and \a width of the design.
+ *  The transition band(s) are centered at the cutoff frequency (or the band
+ *  edges). On success the order and the 3dB cutoff frequency (for \e Cauer
+ *  filters the module angle too) are set, so that the design can be passed
+ *  to stdIirFilterGen().
+ *
+ *  \param pDesign      Pointer to standard IIR design data.
+ *  \param f0           Sampling frequency.
+ *
+ *  \return             Zero on success, else an error number (see errno.h or
+ *                      gsl_errno.h for predefined codes). GSL_ETOL is
+ *                      returned if the minimum order exceeds FLT_DEGREE_MAX,
+ *                      GSL_EUNIMPL for \e Bessel filters.
+ ******************************************************************************/
+int stdIirFilterMinOrder (STDIIR_DESIGN *pDesign, double f0);
+
+
 
 #ifdef  __cplusplus
 }
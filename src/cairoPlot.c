@@ -35,6 +35,7 @@
 #define PLOT_GRID_LINE_WIDTH    (1.0)                    /**< Grid line width */
 #define PLOT_GRID_DASH_LEN      (1.0)                   /**< Grid dash length */
 #define PLOT_BOX_LINE_WIDTH     (1.0)                /**< Plot box line width */
+#define PLOT_OVERLAY_DASH_LEN   (6.0)         /**< Overlay graph dash length */
 
 
 
@@ -1344,6 +1345,60 @@ int cairoPlot2d(cairo_t* cr, PLOT_DIAG *pDiag)
 } /* cairoPlot2d() */
 
 
+
+/* FUNCTION *******************************************************************/
+/** Plots a further graph (dashed) into a diagram, which was drawn by a
+ *  preceding call of cairoPlot2d(). The axes and the graph rectangle are
+ *  taken from \p pDiag as returned by cairoPlot2d(), so only the callbacks
+ *  (and the user data pointer) of \p pDiag should be changed in between.
+ *
+ *  \param cr           \e Cairo context for drawing.
+ *  \param pDiag        Pointer to plot descriptor (after cairoPlot2d()).
+ *
+ *  \return             The number of samples taken to draw this graph
+ *                      (independent of a possible break) or a negative
+ *                      number on error.
+ ******************************************************************************/
+int cairoPlotOverlay (cairo_t* cr, PLOT_DIAG *pDiag)
+{
+    PLOT_AXIS_WORKSPACE axisX, axisY;
+    cairo_font_extents_t refsize;
+    double dash = PLOT_OVERLAY_DASH_LEN * pDiag->thickness;
+    int ret = 0;
+
+    if ((pDiag->area.width > 0) && (pDiag->area.height > 0))
+    {
+        axisX.pAxis = &pDiag->x;
+        axisX.start = pDiag->area.x;
+        axisX.stop = pDiag->area.x + pDiag->area.width;
+        axisX.ratio = w2cRatio (&pDiag->x, axisX.start, axisX.stop);
+
+        axisY.pAxis = &pDiag->y;              /* south-east orientation (see */
+        axisY.start = pDiag->area.y + pDiag->area.height;     /* cairoPlot2d) */
+        axisY.stop = pDiag->area.y;
+        axisY.ratio = w2cRatio (&pDiag->y, axisY.start, axisY.stop);
+
+        cairo_save (cr);
+        cairo_font_extents (cr, &refsize);
+        cairo_rectangle (cr, pDiag->area.x, pDiag->area.y,
+                         pDiag->area.width, pDiag->area.height);
+        cairo_clip (cr);
+        cairo_set_tolerance (cr, 1.0);
+        ret = drawGraph (cr, ((int)refsize.height + 2) / 3, pDiag, &axisX, &axisY);
+
+        PLOT_COLOR_SET (cr, pDiag->colors, PLOT_COLOR_GRAPH);
+        cairo_set_line_width (cr, pDiag->thickness);
+        cairo_set_line_join (cr, CAIRO_LINE_JOIN_ROUND);
+        cairo_set_line_cap (cr, CAIRO_LINE_CAP_BUTT);
+        cairo_set_dash (cr, &dash, 1, 0.0);
+        cairo_stroke (cr);
+        cairo_restore (cr);
+    } /* if */
+
+    return ret;
+} /* cairoPlotOverlay() */
+
+
 /* FUNCTION *******************************************************************/
 /** Checks the plot range of an axis against some predefined limits. If the
  *  range [start, stop] doesn't match these limits, it returns ERANGE and
@@ -173,6 +173,13 @@ static CFG_RESPONSE_SETTINGS respSet[RESPONSE_TYPE_SIZE] =
         {0.0, CFG_DEFAULT_T_STOP, PLOT_AXIS_FLAG_GRID},
         {0, 1, PLOT_AXIS_FLAG_GRID | PLOT_AXIS_FLAG_AUTO},
         PLOT_STYLE_CIRCLE_SAMPLE, 0, 0
+    },
+    [RESPONSE_TYPE_SIGNAL] =
+    {
+        CFG_GROUP_WINDOW "Signal",
+        {0.0, CFG_DEFAULT_T_STOP, PLOT_AXIS_FLAG_GRID},
+        {0, 1, PLOT_AXIS_FLAG_GRID | PLOT_AXIS_FLAG_AUTO},
+        PLOT_STYLE_LINE_ONLY, 0, 0
     }
 };
 
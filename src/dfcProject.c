@@ -27,16 +27,58 @@
 
 /* LOCAL TYPE DECLARATIONS ****************************************************/
 
+#define DFCPRJ_CACHE_KEYSIZE    16       /**< Maximum number of key elements */
+
+
+/** Entry of the design cache.
+ */
+typedef struct
+{
+    guint hash;                                           /**< Hash of \a key */
+    int keys;                               /**< Number of elements in \a key */
+    double key[DFCPRJ_CACHE_KEYSIZE];  /**< Design passed to generator and f0 */
+    DFCPRJ_GEN_FUNC genFunc;                     /**< Generator of the filter */
+    DESIGNDLG design;                    /**< Design as returned by generator */
+    FLTCOEFF filter;     /**< Generated filter (roots valid if factor != 0) */
+    int err;                                /**< Return code of the generator */
+} DFCPRJ_CACHE;
+
 
 /* LOCAL CONSTANT DEFINITIONS *************************************************/
 
+#define DFCPRJ_CACHE_SIZE       16      /**< Maximum number of cached designs */
+
 
 /* LOCAL FUNCTION DECLARATIONS ************************************************/
 
+static int cacheKey (FLTCLASS fltcls, const DESIGNDLG *pDesign, double f0,
+                     double key[]);
+static guint cacheHash (const double key[], int keys);
+
 
 /* LOCAL VARIABLE DEFINITIONS *************************************************/
 
 
+/** Size of the design data of each filter class (index is FLTCLASS).
+ */
+static const size_t designSize[FLTCLASS_SIZE] =
+{
+    sizeof (MISCFLT_DESIGN),                                 /* FLTCLASS_MISC */
+    sizeof (LINFIR_DESIGN),                                /* FLTCLASS_LINFIR */
+    sizeof (STDIIR_DESIGN)                                 /* FLTCLASS_STDIIR */
+};
+
+
+/** Design cache, ordered from the most recently to the least recently used
+ *  design. It is guarded by \a cacheMutex, so dfcPrjFilterGen() may be called
+ *  from any thread.
+ */
+static DFCPRJ_CACHE cache[DFCPRJ_CACHE_SIZE];
+static GMutex cacheMutex;                     /**< Mutex of \a cache (static) */
+static int cacheEntries = 0;               /**< Number of designs in \a cache */
+
+
+
 /** The active project (no memory space allocated).
  */
 static DFCPRJ_FILTER project =
@@ -68,6 +110,89 @@ static DFCPRJ_FILTER project =
 /* LOCAL FUNCTION DEFINITIONS *************************************************/
 
 
+/* FUNCTION *******************************************************************/
+/** Builds the cache key of a design. The key consists of the sample
+ *  frequency and all design data of filter class \p fltcls, field by field
+ *  (so padding bytes and unused union members never have an influence).
+ *
+ *  \param fltcls       Filter class.
+ *  \param pDesign      Pointer to design data.
+ *  \param f0           Sample frequency.
+ *  \param key          Buffer which gets the key (DFCPRJ_CACHE_KEYSIZE
+ *                      elements).
+ *
+ *  \return             Number of elements in \p key.
+ ******************************************************************************/
+static int cacheKey (FLTCLASS fltcls, const DESIGNDLG *pDesign, double f0,
+                     double key[])
+{
+    int n = 0;
+
+    key[n++] = f0;
+    key[n++] = fltcls;
+    key[n++] = pDesign->all.type;
+    key[n++] = pDesign->all.order;
+
+    if (fltcls == FLTCLASS_MISC)
+    {
+        return n;
+    } /* if */
+
+    key[n++] = pDesign->all.cutoff;
+    key[n++] = pDesign->all.ftr.type;
+    key[n++] = pDesign->all.ftr.flags;
+    key[n++] = pDesign->all.ftr.fc;
+    key[n++] = pDesign->all.ftr.bw;
+
+    if (fltcls == FLTCLASS_LINFIR)
+    {
+        key[n++] = pDesign->linFir.dspwin;
+        key[n++] = pDesign->linFir.winparm;
+        key[n++] = pDesign->linFir.width;
+        key[n++] = pDesign->linFir.ripple;
+        key[n++] = pDesign->linFir.minatt;
+    } /* if */
+    else                                                   /* FLTCLASS_STDIIR */
+    {
+        key[n++] = pDesign->stdIir.zAlgo;
+        key[n++] = pDesign->stdIir.ripple;
+        key[n++] = pDesign->stdIir.minatt;
+        key[n++] = pDesign->stdIir.angle;
+        key[n++] = pDesign->stdIir.width;
+    } /* else */
+
+    ASSERT (n <= DFCPRJ_CACHE_KEYSIZE);
+
+    return n;
+} /* cacheKey() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Calculates the (FNV-1a) hash of a cache key.
+ *
+ *  \param key          Key as built by cacheKey().
+ *  \param keys         Number of elements in \p key.
+ *
+ *  \return             Hash value.
+ ******************************************************************************/
+static guint cacheHash (const double key[], int keys)
+{
+    size_t i;
+
+    const guint8 *pByte = (const guint8 *)key;
+    guint hash = 2166136261U;                             /* FNV offset basis */
+
+    for (i = 0; i < keys * sizeof (key[0]); i++)
+    {
+        hash = (hash ^ pByte[i]) * 16777619U;                    /* FNV prime */
+    } /* for */
+
+    return hash;
+} /* cacheHash() */
+
+
+
 /* EXPORTED FUNCTION DEFINITIONS **********************************************/
 
 
@@ -272,6 +397,103 @@ void dfcPrjSetFilter (FLTCLASS type, FLTCOEFF* pFilter, DESIGNDLG *pDesign)
 
 
 
+/* FUNCTION *******************************************************************/
+/** Generates a filter from its design data, with memoization of the last
+ *  DFCPRJ_CACHE_SIZE designs. If the same design (filter class, generator,
+ *  design data and sample frequency) was generated before, the filter and
+ *  the design data returned by the generator are taken from the cache. Else
+ *  the generator is called and the (non-critical) result is cached.
+ *
+ *  \note               The cache is guarded by a mutex, which means the
+ *                      function may be called from any thread.
+ *  \note               The roots are cached as returned by the generator,
+ *                      so they are valid only if member \a factor of the
+ *                      filter is unequal to zero. Generators which leave it
+ *                      zero (e.g. linear FIR designs) provide no roots, and
+ *                      neither does a cache hit of their designs.
+ *
+ *  \param fltcls       Filter class (FLTCLASS_MISC, FLTCLASS_LINFIR or
+ *                      FLTCLASS_STDIIR).
+ *  \param genFunc      Generator function of the filter class, e.g.
+ *                      stdIirFilterGen().
+ *  \param pDesign      Pointer to design data, which may be modified by the
+ *                      generator (e.g. the derived lowpass cutoff frequency).
+ *  \param pFilter      Pointer to buffer which gets the generated filter. The
+ *                      member \a f0 must be set before calling.
+ *
+ *  \return             Return code of the generator function, see for
+ *                      example stdIirFilterGen().
+ ******************************************************************************/
+int dfcPrjFilterGen (FLTCLASS fltcls, DFCPRJ_GEN_FUNC genFunc,
+                     DESIGNDLG *pDesign, FLTCOEFF *pFilter)
+{
+    int i, err;
+    DFCPRJ_CACHE entry;
+    size_t size;
+
+    ASSERT ((fltcls >= 0) && (fltcls < FLTCLASS_SIZE));
+    size = designSize[fltcls];
+    entry.keys = cacheKey (fltcls, pDesign, pFilter->f0, entry.key);
+    entry.hash = cacheHash (entry.key, entry.keys);
+
+    g_mutex_lock (&cacheMutex);
+
+    for (i = 0; i < cacheEntries; i++)
+    {
+        if ((cache[i].hash == entry.hash) && (cache[i].keys == entry.keys) &&
+            (cache[i].genFunc == genFunc) &&
+            (memcmp (cache[i].key, entry.key,
+                     entry.keys * sizeof (entry.key[0])) == 0))
+        {
+            err = filterDuplicate (pFilter, &cache[i].filter);
+
+            if (err == 0)
+            {
+                memcpy (pDesign, &cache[i].design, size);
+                entry = cache[i];                      /* move entry to front */
+                memmove (&cache[1], &cache[0], i * sizeof (cache[0]));
+                cache[0] = entry;
+                err = entry.err;
+            } /* if */
+
+            g_mutex_unlock (&cacheMutex);
+
+            return err;
+        } /* if */
+    } /* for */
+
+    g_mutex_unlock (&cacheMutex);              /* don't lock while generating */
+    err = genFunc (pDesign, pFilter);
+
+    if (FLTERR_CRITICAL (err))
+    {
+        return err;                                         /* nothing cached */
+    } /* if */
+
+    entry.genFunc = genFunc;
+    entry.err = err;
+    memcpy (&entry.design, pDesign, size);
+
+    if (filterDuplicate (&entry.filter, pFilter) == 0)
+    {
+        g_mutex_lock (&cacheMutex);
+
+        if (cacheEntries == DFCPRJ_CACHE_SIZE)    /* drop least recently used */
+        {
+            filterFree (&cache[--cacheEntries].filter);
+        } /* if */
+
+        memmove (&cache[1], &cache[0], cacheEntries * sizeof (cache[0]));
+        cache[0] = entry;
+        cacheEntries++;
+        g_mutex_unlock (&cacheMutex);
+    } /* if */
+
+    return err;
+} /* dfcPrjFilterGen() */
+
+
+
 /* FUNCTION *******************************************************************/
 /** Sets new project information data.
  *
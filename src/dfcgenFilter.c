@@ -0,0 +1,826 @@
+/**
+ * \file        dfcgenFilter.c
+ * \brief       Command line tool \c dfcgen-filter, which applies the filter
+ *              of a DFCGen project file to a stream of samples (no GUI).
+ * \copyright   Copyright (C) 2006-2022 Ralf Hoppe <dfcgen@rho62.de>
+ */
+
+
+/* INCLUDE FILES **************************************************************/
+
+#include "packageSupport.h"  /* includes config.h (include before all others) */
+#include "dfcProject.h"
+#include "projectFile.h"
+#include "filterSignal.h"
+#include "filterEngine.h"
+#include "filterFixed.h"
+#include "filterSupport.h"
+#include "linFirFilter.h"
+
+#include <stdio.h>
+#include <errno.h>
+#include <string.h> /* strerror() */
+
+#ifdef G_OS_WIN32
+#include <io.h>     /* _setmode() */
+#include <fcntl.h>  /* _O_BINARY */
+#endif
+
+
+/* GLOBAL CONSTANT DEFINITIONS ************************************************/
+
+
+/* GLOBAL VARIABLE DEFINITIONS ************************************************/
+
+
+/* LOCAL TYPE DECLARATIONS ****************************************************/
+
+
+/* LOCAL CONSTANT DEFINITIONS *************************************************/
+
+#define FILTER_CHUNK_SIZE       16384   /**< Frames per chunk (multiple of any
+                                        *   FFT convolution block size) */
+#define FILTER_LINE_SIZE        256    /**< Max. line length of response file */
+
+
+/* LOCAL VARIABLE DEFINITIONS *************************************************/
+
+
+static gchar *optFormat = NULL;            /**< Option \c --format (argument) */
+static gchar *optEngine = NULL;            /**< Option \c --engine (argument) */
+static gint optBlock = 0;                   /**< Option \c --block (argument) */
+static gint optChannels = 1;             /**< Option \c --channels (argument) */
+static gchar *optFixed = NULL;              /**< Option \c --fixed (argument) */
+static gchar *optRound = NULL;              /**< Option \c --round (argument) */
+static gboolean optQuiet = FALSE;                         /**< Option \c --quiet */
+static gchar *optCascade = NULL;          /**< Option \c --cascade (argument) */
+static gchar *optParallel = NULL;        /**< Option \c --parallel (argument) */
+static gchar *optSave = NULL;                 /**< Option \c --save (argument) */
+static gchar *optSampled = NULL;          /**< Option \c --sampled (argument) */
+static gint optDegree = 64;                /**< Option \c --degree (argument) */
+static gdouble optRate = 44.1E3;             /**< Option \c --rate (argument) */
+static gchar *optWindow = NULL;            /**< Option \c --window (argument) */
+static gdouble optAlpha = 5.0;              /**< Option \c --alpha (argument) */
+
+
+/** Command line options.
+ */
+static GOptionEntry filterOptions[] =
+{
+    {"format", 'f', 0, G_OPTION_ARG_STRING, &optFormat,
+     N_("Sample format of input (float32, float64 or wav)"), N_("FORMAT")},
+    {"engine", 'e', 0, G_OPTION_ARG_STRING, &optEngine,
+     N_("Filter engine (auto, direct, biquad or fft)"), N_("ENGINE")},
+    {"block", 'b', 0, G_OPTION_ARG_INT, &optBlock,
+     N_("Block size of FFT convolution"), N_("N")},
+    {"channels", 'c', 0, G_OPTION_ARG_INT, &optChannels,
+     N_("Number of interleaved channels in raw input"), N_("N")},
+    {"fixed", 'x', 0, G_OPTION_ARG_STRING, &optFixed,
+     N_("Simulate a fixed-point filter (q15 or q31)"), N_("FORMAT")},
+    {"round", 'r', 0, G_OPTION_ARG_STRING, &optRound,
+     N_("Rounding of fixed-point filter (trunc, nearest or convergent)"), N_("MODE")},
+    {"quiet", 'q', 0, G_OPTION_ARG_NONE, &optQuiet,
+     N_("Do not report throughput"), NULL},
+    {"cascade", 'C', 0, G_OPTION_ARG_FILENAME, &optCascade,
+     N_("Cascade the filter with that of project FILE"), N_("FILE")},
+    {"parallel", 'p', 0, G_OPTION_ARG_FILENAME, &optParallel,
+     N_("Connect the filter in parallel with that of project FILE"), N_("FILE")},
+    {"save", 's', 0, G_OPTION_ARG_FILENAME, &optSave,
+     N_("Save the (composed) filter as project FILE"), N_("FILE")},
+    {"sampled", 'S', 0, G_OPTION_ARG_FILENAME, &optSampled,
+     N_("Design a linear FIR filter by frequency sampling of the response"
+        " in FILE (rows of frequency, magnitude and optional phase) instead"
+        " of reading PROJECT"), N_("FILE")},
+    {"degree", 'n', 0, G_OPTION_ARG_INT, &optDegree,
+     N_("Degree of frequency sampling design (default 64)"), N_("N")},
+    {"rate", 'R', 0, G_OPTION_ARG_DOUBLE, &optRate,
+     N_("Sample frequency of sampling design (default 44100)"), N_("F0")},
+    {"window", 'w', 0, G_OPTION_ARG_STRING, &optWindow,
+     N_("Window of frequency sampling design (rect, hamming, vanhann,"
+        " blackman or kaiser)"), N_("WINDOW")},
+    {"alpha", 'a', 0, G_OPTION_ARG_DOUBLE, &optAlpha,
+     N_("Parameter of Kaiser window (default 5)"), N_("ALPHA")},
+    {NULL}
+};
+
+
+/** Names of sample formats (indexed by FLTSIGNAL_FORMAT).
+ */
+static const char *filterFormatNames[FLTSIGNAL_FORMAT_SIZE] =
+{
+    "float32", "float64", "wav"
+};
+
+
+/** Names of filter engines (indexed by FLTENGINE_TYPE).
+ */
+static const char *filterEngineNames[FLTENGINE_SIZE] =
+{
+    "auto", "direct", "biquad", "fft"
+};
+
+
+/** Names of windows (indexed by LINFIR_DSPWIN).
+ */
+static const char *filterWindowNames[LINFIR_DSPWIN_SIZE] =
+{
+    "rect", "hamming", "vanhann", "blackman", "kaiser"
+};
+
+
+/** Names of fixed-point formats (indexed by FLTFIXED_FORMAT).
+ */
+static const char *filterFixedNames[FLTFIXED_SIZE] =
+{
+    "q15", "q31"
+};
+
+
+/** Names of fixed-point rounding modes (indexed by FLTFIXED_ROUND).
+ */
+static const char *filterRoundNames[FLTFIXED_ROUND_SIZE] =
+{
+    "trunc", "nearest", "convergent"
+};
+
+
+/* LOCAL MACRO DEFINITIONS ****************************************************/
+
+
+/* LOCAL FUNCTION DECLARATIONS ************************************************/
+
+static int filterLookup (const char *name, const char *names[], int size);
+static gsize filterReadStream (FILE *stream, FLTSIGNAL_FORMAT format,
+                               double *buf, gsize size);
+static gsize filterWriteStream (FILE *stream, FLTSIGNAL_FORMAT format,
+                                double *buf, gsize size);
+static int filterRun (FLTENGINE *pEngine, FLTFIXED *pFixed,
+                      FLTSIGNAL_SOURCE *pSource, FILE *in, FILE *out,
+                      FLTSIGNAL_FORMAT format, guint64 *pFrames);
+static int filterCompose (DFCPRJ_FILTER *pProject, const char *filename,
+                          BOOL parallel);
+static int filterSampled (DFCPRJ_FILTER *pProject, const char *filename,
+                          LINFIR_DSPWIN dspwin);
+
+
+/* LOCAL FUNCTION DEFINITIONS *************************************************/
+
+
+/* FUNCTION *******************************************************************/
+/** Looks up a (command line) name in a table of names.
+ *
+ *  \param name         Name to look for (may be NULL).
+ *  \param names        Table of names.
+ *  \param size         Number of names in table.
+ *
+ *  \return             Index of name in table, zero if \p name is NULL and
+ *                      a negative number if not found.
+ ******************************************************************************/
+static int filterLookup (const char *name, const char *names[], int size)
+{
+    int i;
+
+    if (name == NULL)
+    {
+        return 0;
+    } /* if */
+
+    for (i = 0; i < size; i++)
+    {
+        if (g_ascii_strcasecmp (name, names[i]) == 0)
+        {
+            return i;
+        } /* if */
+    } /* for */
+
+    return -1;
+} /* filterLookup() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Reads raw samples from a stream (pipe), which cannot be memory mapped.
+ *
+ *  \param stream       Input stream.
+ *  \param format       Sample format (FLTSIGNAL_FORMAT_FLOAT32 or
+ *                      FLTSIGNAL_FORMAT_FLOAT64).
+ *  \param buf          Buffer which gets the samples.
+ *  \param size         Size of buffer (number of samples).
+ *
+ *  \return             Number of samples read (less than \p size at end of
+ *                      stream).
+ ******************************************************************************/
+static gsize filterReadStream (FILE *stream, FLTSIGNAL_FORMAT format,
+                               double *buf, gsize size)
+{
+    gsize i, n;
+
+    if (format == FLTSIGNAL_FORMAT_FLOAT64)
+    {
+        return fread (buf, sizeof (double), size, stream);
+    } /* if */
+
+    /* Read the floats into the upper half of the buffer, then expand them
+     * from the start (no overlap, because a double is twice a float).
+     */
+    n = fread ((float *)buf + size, sizeof (float), size, stream);
+
+    for (i = 0; i < n; i++)
+    {
+        buf[i] = ((float *)buf)[size + i];
+    } /* for */
+
+    return n;
+} /* filterReadStream() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Writes raw samples to a stream.
+ *
+ *  \param stream       Output stream.
+ *  \param format       Sample format (FLTSIGNAL_FORMAT_FLOAT32 or
+ *                      FLTSIGNAL_FORMAT_FLOAT64).
+ *  \param buf          Samples to be written. On FLTSIGNAL_FORMAT_FLOAT32 the
+ *                      buffer is overwritten by the converted samples.
+ *  \param size         Number of samples.
+ *
+ *  \return             Number of samples written.
+ ******************************************************************************/
+static gsize filterWriteStream (FILE *stream, FLTSIGNAL_FORMAT format,
+                                double *buf, gsize size)
+{
+    gsize i;
+
+    if (format == FLTSIGNAL_FORMAT_FLOAT64)
+    {
+        return fwrite (buf, sizeof (double), size, stream);
+    } /* if */
+
+    for (i = 0; i < size; i++)               /* in place (forward direction) */
+    {
+        ((float *)buf)[i] = buf[i];
+    } /* for */
+
+    return fwrite (buf, sizeof (float), size, stream);
+} /* filterWriteStream() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Streams all input frames through the filter engine (or the fixed-point
+ *  filter). The output is written interleaved (same number of channels as
+ *  the input).
+ *
+ *  \param pEngine      Pointer to filter engine (NULL if \p pFixed is used).
+ *  \param pFixed       Pointer to fixed-point filter (single channel), or
+ *                      NULL if \p pEngine is used.
+ *  \param pSource      Pointer to (memory mapped) input file, or NULL if
+ *                      reading from stream \p in.
+ *  \param in           Input stream (only used if \p pSource is NULL).
+ *  \param out          Output stream.
+ *  \param format       Sample format of input.
+ *  \param pFrames      Pointer to buffer which gets the number of frames.
+ *
+ *  \return             Zero on success, else an error number (see errno.h or
+ *                      gsl_errno.h for predefined codes).
+ ******************************************************************************/
+static int filterRun (FLTENGINE *pEngine, FLTFIXED *pFixed,
+                      FLTSIGNAL_SOURCE *pSource, FILE *in, FILE *out,
+                      FLTSIGNAL_FORMAT format, guint64 *pFrames)
+{
+    gsize n, size;
+    int err = 0;
+    int chan = (pEngine != NULL) ? pEngine->channels : 1;
+    int block = (pEngine != NULL) ? pEngine->block : 1;
+    double *buf = g_malloc (FILTER_CHUNK_SIZE * chan * sizeof (double));
+
+    if (format == FLTSIGNAL_FORMAT_WAV)          /* WAV is written as floats */
+    {
+        format = FLTSIGNAL_FORMAT_FLOAT32;
+    } /* if */
+
+    *pFrames = 0;
+
+    do
+    {
+        if (pSource != NULL)
+        {
+            n = filterSignalReadFrames (pSource, buf, FILTER_CHUNK_SIZE);
+        } /* if */
+        else                             /* incomplete last frame is dropped */
+        {
+            n = filterReadStream (in, format, buf, FILTER_CHUNK_SIZE * chan) / chan;
+        } /* else */
+
+        /* Block oriented engines need complete blocks, so zero-pad the last
+         * (partial) chunk.
+         */
+        size = (n + block - 1) / block * block;
+        memset (buf + n * chan, 0, (size - n) * chan * sizeof (double));
+
+        if (pFixed != NULL)
+        {
+            filterFixedProcess (pFixed, buf, buf, size);
+        } /* if */
+        else
+        {
+            err = filterEngineProcess (pEngine, buf, buf, size);
+        } /* else */
+
+        if ((err == 0) &&
+            (filterWriteStream (out, format, buf, n * chan) != n * chan))
+        {
+            err = errno;
+        } /* if */
+
+        *pFrames += n;
+    }
+    while ((err == 0) && (n == FILTER_CHUNK_SIZE));
+
+    if ((err == 0) && (pSource == NULL) && ferror (in))
+    {
+        err = EIO;
+    } /* if */
+
+    if ((err == 0) && (fflush (out) != 0))
+    {
+        err = errno;
+    } /* if */
+
+    g_free (buf);
+
+    return err;
+} /* filterRun() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Composes the filter of a project with the filter of another project file.
+ *  The design of the project is marked as superseded.
+ *
+ *  \param pProject     Pointer to project, which filter is replaced by the
+ *                      composed one.
+ *  \param filename     Name of project file with the second filter.
+ *  \param parallel     If TRUE the filters are connected in parallel, else
+ *                      they are cascaded.
+ *
+ *  \return             Zero on success, else an error number (see errno.h or
+ *                      gsl_errno.h for predefined codes).
+ ******************************************************************************/
+static int filterCompose (DFCPRJ_FILTER *pProject, const char *filename,
+                          BOOL parallel)
+{
+    int err;
+    DFCPRJ_FILTER prj;
+    FLTCOEFF result;
+    GError *error = NULL;
+
+    memset (&prj, 0, sizeof (prj));
+    prjFileRead (filename, &prj, &error);
+
+    if (error != NULL)
+    {
+        g_printerr ("%s: %s\n", filename, error->message);
+        g_error_free (error);
+        return EINVAL;
+    } /* if */
+
+    if (parallel)
+    {
+        err = filterParallel (&result, &pProject->filter, &prj.filter);
+    } /* if */
+    else
+    {
+        err = filterCascade (&result, &pProject->filter, &prj.filter);
+    } /* else */
+
+    dfcPrjFree (&prj);
+
+    if (FLTERR_CRITICAL (err))
+    {
+        return err;
+    } /* if */
+
+    filterFree (&pProject->filter);
+    pProject->filter = result;
+    pProject->flags |= DFCPRJ_FLAG_SUPERSEDED;
+
+    return 0;
+} /* filterCompose() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Designs the filter of a project by frequency sampling (see function
+ *  linFirFilterSampledGen()) of the response in a text file. Each line of
+ *  the file holds a frequency in Hz, the magnitude and (optionally) the
+ *  phase in radians, separated by white space. Empty lines and lines
+ *  starting with '#' are ignored. The frequencies must be ascending. The
+ *  response is interpolated linearly onto a uniform grid from zero to
+ *  \f$f_0/2\f$, and it is held constant outside the range of the file.
+ *
+ *  \param pProject     Pointer to project, which gets the filter (without
+ *                      design data).
+ *  \param filename     Name of response file.
+ *  \param dspwin       Window of design.
+ *
+ *  \return             Zero on success, else an error number (see errno.h or
+ *                      gsl_errno.h for predefined codes).
+ ******************************************************************************/
+static int filterSampled (DFCPRJ_FILTER *pProject, const char *filename,
+                          LINFIR_DSPWIN dspwin)
+{
+    FILE *file;
+    char line[FILTER_LINE_SIZE], *pos, *end;
+    double value[3], *pMag, *pPhase, *pRow;
+    double freq, x;
+    int i, k, n, rows, points;
+
+    int err = 0;
+    int phases = 0;                        /* number of rows with phase value */
+    GArray *pArray = g_array_new (FALSE, FALSE, sizeof (double));
+
+    file = fopen (filename, "r");
+
+    if (file == NULL)
+    {
+        g_array_free (pArray, TRUE);
+        return errno;
+    } /* if */
+
+    while ((err == 0) && (fgets (line, sizeof (line), file) != NULL))
+    {
+        for (pos = line; g_ascii_isspace (*pos); pos++)
+        {
+            ;
+        } /* for */
+
+        if ((*pos == '\0') || (*pos == '#'))        /* empty line or comment? */
+        {
+            continue;
+        } /* if */
+
+        for (n = 0; n < 3; n++)
+        {
+            value[n] = g_ascii_strtod (pos, &end);
+
+            if (end == pos)
+            {
+                break;
+            } /* if */
+
+            pos = end;
+        } /* for */
+
+        rows = pArray->len / 3;
+        pRow = (double *) pArray->data;
+
+        if ((n < 2) || (value[0] < 0.0) ||
+            ((rows > 0) && (value[0] <= pRow[3 * (rows - 1)])))
+        {
+            err = EINVAL;             /* syntax error or descending frequency */
+        } /* if */
+
+        if (n == 3)
+        {
+            ++phases;
+        } /* if */
+        else
+        {
+            value[2] = 0.0;
+        } /* else */
+
+        g_array_append_vals (pArray, value, 3);
+    } /* while */
+
+    if ((err == 0) && ferror (file))
+    {
+        err = EIO;
+    } /* if */
+
+    fclose (file);
+    rows = pArray->len / 3;
+
+    if ((rows < 2) || ((phases > 0) && (phases != rows)))
+    {
+        err = EINVAL;                     /* phase must be given for all rows */
+    } /* if */
+
+    if (err != 0)
+    {
+        g_array_free (pArray, TRUE);
+        return err;
+    } /* if */
+
+
+    /* Interpolate the response onto the uniform grid of the design.
+     */
+    points = GSL_MAX_INT (rows, optDegree + 1);
+    pMag = g_malloc (2 * points * sizeof (double));
+    pPhase = pMag + points;
+    pRow = (double *) pArray->data;
+
+    for (i = 0, k = 0; i < points; i++)
+    {
+        freq = 0.5 * optRate * i / (points - 1);
+
+        while ((k < rows - 2) && (freq > pRow[3 * (k + 1)]))
+        {
+            ++k;                                /* find interval of frequency */
+        } /* while */
+
+        x = (freq - pRow[3 * k]) / (pRow[3 * (k + 1)] - pRow[3 * k]);
+        x = GSL_MAX_DBL (0.0, GSL_MIN_DBL (1.0, x));      /* hold at the ends */
+        pMag[i] = (1.0 - x) * pRow[3 * k + 1] + x * pRow[3 * k + 4];
+        pPhase[i] = (1.0 - x) * pRow[3 * k + 2] + x * pRow[3 * k + 5];
+    } /* for */
+
+    g_array_free (pArray, TRUE);
+
+    memset (pProject, 0, sizeof (*pProject));
+    pProject->fltcls = FLTCLASS_MISC;
+    pProject->design.miscFlt.type = MISCFLT_UNKNOWN;  /* no design data (raw) */
+    pProject->filter.f0 = optRate;
+
+    err = linFirFilterSampledGen (optDegree, points, pMag,
+                                  (phases > 0) ? pPhase : NULL, dspwin,
+                                  optAlpha, &pProject->filter);
+    g_free (pMag);
+
+    return FLTERR_CRITICAL (err) ? err : 0;
+} /* filterSampled() */
+
+
+
+/* EXPORTED FUNCTION DEFINITIONS **********************************************/
+
+
+int main (int argc, char *argv[])
+{
+    DFCPRJ_FILTER prj;
+    GOptionContext *ctx;
+    gint64 usec;
+    guint64 frames;
+    gboolean parsed;
+    int format, engine, fixed, rounding, window, first;
+    int err = 0;
+    GError *error = NULL;
+    FLTSIGNAL_SOURCE *pSource = NULL;
+    FLTENGINE *pEngine = NULL;
+    FLTFIXED *pFixed = NULL;
+    FILE *in = stdin, *out = stdout;
+
+#ifdef ENABLE_NLS
+    gchar* localedir = getPackageDirectory (DIR_ID_LOCALE);
+
+#ifdef G_OS_WIN32
+    /* bindtextdomain() is not UTF-8 aware
+     */
+    gchar* tmp = g_win32_locale_filename_from_utf8 (localedir);
+
+    g_free (localedir);
+    localedir = tmp;
+#endif /* G_OS_WIN32 */
+
+    bindtextdomain (GETTEXT_PACKAGE, localedir);
+    g_free (localedir);
+    bind_textdomain_codeset (GETTEXT_PACKAGE, "UTF-8");
+    textdomain (GETTEXT_PACKAGE);
+#endif
+
+    ctx = g_option_context_new (_("PROJECT [INPUT [OUTPUT]]"));
+    g_option_context_set_summary (
+        ctx, _("Filters the samples from file INPUT by the filter of DFCGen"
+               " project PROJECT and writes the result to file OUTPUT. If"
+               " INPUT or OUTPUT is omitted or \"-\", the standard input"
+               " resp. output is used. If option --save is given without"
+               " INPUT, then the (composed) filter is saved only. With option"
+               " --sampled the argument PROJECT must be omitted."));
+    g_option_context_add_main_entries (ctx, filterOptions, GETTEXT_PACKAGE);
+
+    parsed = g_option_context_parse (ctx, &argc, &argv, &error);
+    first = (optSampled != NULL) ? 1 : 2;          /* index of argument INPUT */
+
+    if (!parsed || (argc < first) || (argc > first + 2))
+    {
+        if (error != NULL)
+        {
+            g_printerr ("%s\n", error->message);
+            g_error_free (error);
+        } /* if */
+        else
+        {
+            gchar *help = g_option_context_get_help (ctx, TRUE, NULL);
+
+            g_printerr ("%s", help);
+            g_free (help);
+        } /* else */
+
+        g_option_context_free (ctx);
+        return 2;
+    } /* if */
+
+    g_option_context_free (ctx);
+    format = filterLookup (optFormat, filterFormatNames, FLTSIGNAL_FORMAT_SIZE);
+    engine = filterLookup (optEngine, filterEngineNames, FLTENGINE_SIZE);
+    fixed = (optFixed == NULL) ? FLTFIXED_SIZE
+        : filterLookup (optFixed, filterFixedNames, FLTFIXED_SIZE);
+    rounding = (optRound == NULL) ? FLTFIXED_ROUND_NEAREST
+        : filterLookup (optRound, filterRoundNames, FLTFIXED_ROUND_SIZE);
+    window = filterLookup (optWindow, filterWindowNames, LINFIR_DSPWIN_SIZE);
+
+    if ((format < 0) || (engine < 0) || (fixed < 0) || (rounding < 0) ||
+        (window < 0) || (optBlock < 0) || (optChannels < 1) ||
+        (optRate < FLT_SAMPLE_MIN) || (optRate > FLT_SAMPLE_MAX))
+    {
+        g_printerr (_("Invalid option argument\n"));
+        return 2;
+    } /* if */
+
+    memset (&prj, 0, sizeof (prj));
+
+    if (optSampled != NULL)                  /* design by frequency sampling? */
+    {
+        err = filterSampled (&prj, optSampled, window);
+
+        if (err != 0)
+        {
+            g_printerr (_("%s: Cannot design filter (%s)\n"), optSampled,
+                        strerror (err));
+            return 1;
+        } /* if */
+    } /* if */
+    else
+    {
+        prjFileRead (argv[1], &prj, &error);
+
+        if (error != NULL)
+        {
+            g_printerr ("%s: %s\n", argv[1], error->message);
+            g_error_free (error);
+            return 1;
+        } /* if */
+    } /* else */
+
+    if (optCascade != NULL)
+    {
+        err = filterCompose (&prj, optCascade, FALSE);
+    } /* if */
+
+    if ((err == 0) && (optParallel != NULL))
+    {
+        err = filterCompose (&prj, optParallel, TRUE);
+    } /* if */
+
+    if (err != 0)
+    {
+        g_printerr (_("Cannot compose filters (%s)\n"), strerror (err));
+        dfcPrjFree (&prj);
+        return 1;
+    } /* if */
+
+    if (optSave != NULL)
+    {
+        err = prjFileWrite (optSave, &prj);
+
+        if ((err != 0) || (argc == first))
+        {
+            if (err != 0)
+            {
+                g_printerr ("%s: %s\n", optSave, strerror (err));
+            } /* if */
+
+            dfcPrjFree (&prj);
+            return (err == 0) ? 0 : 1;
+        } /* if */
+    } /* if */
+
+    if ((argc > first) && (strcmp (argv[first], "-") != 0))
+    {
+        err = filterSignalOpen (argv[first], format, &pSource);
+
+        if ((err == 0) && (format != FLTSIGNAL_FORMAT_WAV))
+        {
+            err = filterSignalInterleave (pSource, optChannels);
+        } /* if */
+    } /* if */
+    else if (format == FLTSIGNAL_FORMAT_WAV)       /* header needs mmap/seek */
+    {
+        err = EINVAL;
+    } /* else if */
+
+    if ((err == 0) && (fixed != FLTFIXED_SIZE))     /* fixed-point filter? */
+    {
+        if (((pSource != NULL) ? pSource->channels : optChannels) != 1)
+        {
+            err = EINVAL;                 /* single channel simulation only */
+        } /* if */
+        else
+        {
+            err = filterFixedNew (&prj.filter, fixed, rounding, &pFixed);
+        } /* else */
+
+        if (err != 0)
+        {
+            g_printerr (_("Cannot create %s fixed-point filter (%s)\n"),
+                        filterFixedNames[fixed], strerror (err));
+            filterSignalClose (pSource);
+            dfcPrjFree (&prj);
+            return 1;
+        } /* if */
+    } /* if */
+
+    if ((err == 0) && (pFixed == NULL))
+    {
+        err = filterEngineNew (&prj.filter, engine, optBlock,
+                               (pSource != NULL) ? pSource->channels : optChannels,
+                               &pEngine);
+        if (err != 0)
+        {
+            g_printerr (_("Cannot create %s filter engine (%s)\n"),
+                        filterEngineNames[engine], strerror (err));
+            filterSignalClose (pSource);
+            dfcPrjFree (&prj);
+            return 1;
+        } /* if */
+    } /* if */
+
+    if ((err == 0) && (argc > first + 1) &&
+        (strcmp (argv[first + 1], "-") != 0))
+    {
+        out = fopen (argv[first + 1], "wb");
+
+        if (out == NULL)
+        {
+            err = errno;
+        } /* if */
+    } /* if */
+
+    if (err == 0)
+    {
+#ifdef G_OS_WIN32
+        if (pSource == NULL)
+        {
+            _setmode (_fileno (in), _O_BINARY);
+        } /* if */
+
+        _setmode (_fileno (out), _O_BINARY);
+#endif
+
+        usec = g_get_monotonic_time ();
+        err = filterRun (pEngine, pFixed, pSource, in, out, format, &frames);
+        usec = g_get_monotonic_time () - usec;
+
+        if ((err == 0) && !optQuiet && (pFixed != NULL))
+        {
+            g_printerr (_("%" G_GUINT64_FORMAT " samples filtered by %s"
+                          " fixed-point filter (%d fractional bits,"
+                          " %" G_GSIZE_FORMAT " overflows, %.3g samples/s)\n"),
+                        frames, filterFixedNames[pFixed->format], pFixed->frac,
+                        pFixed->overflows, (usec > 0) ? 1E6 * frames / usec : 0.0);
+        } /* if */
+
+        if ((err == 0) && !optQuiet && (pEngine != NULL))
+        {
+            g_printerr (_("%" G_GUINT64_FORMAT " frames (%d channels) filtered"
+                          " by %s engine (%.3g frames/s)\n"), frames,
+                        pEngine->channels, filterEngineNames[pEngine->type],
+                        (usec > 0) ? 1E6 * frames / usec : 0.0);
+        } /* if */
+    } /* if */
+
+    if (err != 0)
+    {
+        g_printerr ("%s\n", strerror (err));
+    } /* if */
+
+    if ((out != stdout) && (out != NULL))
+    {
+        fclose (out);
+    } /* if */
+
+    if (pSource != NULL)
+    {
+        filterSignalClose (pSource);
+    } /* if */
+
+    if (pEngine != NULL)
+    {
+        filterEngineFree (pEngine);
+    } /* if */
+
+    if (pFixed != NULL)
+    {
+        filterFixedFree (pFixed);
+    } /* if */
+
+    dfcPrjFree (&prj);
+
+    return (err == 0) ? 0 : 1;
+} /* main() */
+
+
+/******************************************************************************/
+/* END OF FILE                                                                */
+/******************************************************************************/
@@ -0,0 +1,472 @@
+/**
+ * \file        dfcgenSweep.c
+ * \brief       Command line tool \c dfcgen-sweep, which sweeps the design of
+ *              a DFCGen project file over a parameter grid and writes a table
+ *              of metrics (no GUI).
+ * \copyright   Copyright (C) 2006-2022 Ralf Hoppe <dfcgen@rho62.de>
+ */
+
+
+/* INCLUDE FILES **************************************************************/
+
+#include "packageSupport.h"  /* includes config.h (include before all others) */
+#include "dfcProject.h"
+#include "projectFile.h"
+#include "filterSweep.h"
+
+#include <stdio.h>
+#include <errno.h>
+#include <string.h> /* strerror() */
+
+
+/* GLOBAL CONSTANT DEFINITIONS ************************************************/
+
+
+/* GLOBAL VARIABLE DEFINITIONS ************************************************/
+
+
+/* LOCAL TYPE DECLARATIONS ****************************************************/
+
+
+/* LOCAL CONSTANT DEFINITIONS *************************************************/
+
+#define SWEEP_LIST_MAX          4096     /**< Max. number of values in a list */
+
+
+/* LOCAL VARIABLE DEFINITIONS *************************************************/
+
+
+static gchar *optType = NULL;                /**< Option \c --type (argument) */
+static gchar *optOrder = NULL;              /**< Option \c --order (argument) */
+static gchar *optCutoff = NULL;            /**< Option \c --cutoff (argument) */
+static gchar *optWindow = NULL;            /**< Option \c --window (argument) */
+static gdouble optWidth = 0.0;              /**< Option \c --width (argument) */
+static gchar *optSort = NULL;                /**< Option \c --sort (argument) */
+static gboolean optDescending = FALSE;            /**< Option \c --descending */
+static gboolean optCsv = FALSE;                          /**< Option \c --csv */
+static gboolean optQuiet = FALSE;                      /**< Option \c --quiet */
+
+
+/** Command line options.
+ */
+static GOptionEntry sweepOptions[] =
+{
+    {"type", 't', 0, G_OPTION_ARG_STRING, &optType,
+     N_("Comma separated list of filter types (e.g. butterworth,chebyshev)"),
+     N_("LIST")},
+    {"order", 'o', 0, G_OPTION_ARG_STRING, &optOrder,
+     N_("Comma separated list of orders or ranges FROM:TO[:STEP]"), N_("LIST")},
+    {"cutoff", 'c', 0, G_OPTION_ARG_STRING, &optCutoff,
+     N_("Comma separated list of cutoff (center) frequencies or ranges"
+        " FROM:TO[:STEP]"), N_("LIST")},
+    {"window", 'w', 0, G_OPTION_ARG_STRING, &optWindow,
+     N_("Comma separated list of DSP windows (linear FIR filters only)"),
+     N_("LIST")},
+    {"width", 'W', 0, G_OPTION_ARG_DOUBLE, &optWidth,
+     N_("Transition bandwidth excluded from the passband and stopband metrics"),
+     N_("HZ")},
+    {"sort", 's', 0, G_OPTION_ARG_STRING, &optSort,
+     N_("Sort by metric (ripple, stopatt, delay, macs or radius)"),
+     N_("METRIC")},
+    {"descending", 'd', 0, G_OPTION_ARG_NONE, &optDescending,
+     N_("Sort in descending order"), NULL},
+    {"csv", 0, 0, G_OPTION_ARG_NONE, &optCsv,
+     N_("Write comma separated values"), NULL},
+    {"quiet", 'q', 0, G_OPTION_ARG_NONE, &optQuiet,
+     N_("Do not report the number of designs and the runtime"), NULL},
+    {NULL}
+};
+
+
+/* LOCAL MACRO DEFINITIONS ****************************************************/
+
+
+/* LOCAL FUNCTION DECLARATIONS ************************************************/
+
+static const char *sweepName (FLTCLASS fltcls, int index);
+static int sweepParseValues (const char *list, BOOL integer, GArray *array);
+static int sweepParseNames (const char *list, FLTCLASS fltcls, GArray *array);
+
+
+/* LOCAL FUNCTION DEFINITIONS *************************************************/
+
+
+/* FUNCTION *******************************************************************/
+/** Returns the (command line) name of a filter type or DSP window.
+ *
+ *  \param fltcls       Filter class of the type. If FLTCLASS_NOTDEF is
+ *                      passed then \p index is a DSP window.
+ *  \param index        Filter type resp. DSP window.
+ *
+ *  \return             Name, NULL if \p index is out of range.
+ ******************************************************************************/
+static const char *sweepName (FLTCLASS fltcls, int index)
+{
+    if (fltcls == FLTCLASS_NOTDEF)
+    {
+        return filterSweepWindowName (index);
+    } /* if */
+
+    return filterSweepTypeName (fltcls, index);
+} /* sweepName() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Parses a (command line) list of values. The list elements are separated
+ *  by commas, and each element is a single value or a range
+ *  \c FROM:TO[:STEP] (with default step one).
+ *
+ *  \param list         List to be parsed (may be NULL).
+ *  \param integer      If TRUE the values must be integers and are appended
+ *                      as \c int to \p array, else as \c double.
+ *  \param array        Array, which gets the values.
+ *
+ *  \return             Zero on success, else an error number from errno.h.
+ ******************************************************************************/
+static int sweepParseValues (const char *list, BOOL integer, GArray *array)
+{
+    gchar **elem, **range;
+    gchar *end;
+    double x, value[3];
+    int i, j, n, tmp;
+
+    int err = 0;
+
+    if (list == NULL)
+    {
+        return 0;
+    } /* if */
+
+    elem = g_strsplit (list, ",", -1);
+
+    for (i = 0; (err == 0) && (elem[i] != NULL); i++)
+    {
+        range = g_strsplit (elem[i], ":", -1);
+        value[2] = 1.0;                                       /* default step */
+
+        for (n = 0; (err == 0) && (range[n] != NULL); n++)
+        {
+            if (n >= 3)
+            {
+                err = EINVAL;
+                break;
+            } /* if */
+
+            value[n] = g_ascii_strtod (range[n], &end);
+
+            if ((end == range[n]) || (*end != '\0') || !gsl_finite (value[n]) ||
+                (integer && ((value[n] != floor (value[n])) ||
+                             (fabs (value[n]) > G_MAXINT))))
+            {
+                err = EINVAL;
+            } /* if */
+        } /* for */
+
+        if ((err == 0) && (n != 1))                   /* range FROM:TO[:STEP] */
+        {
+            if ((n == 0) || (value[2] <= 0.0) || (value[1] < value[0]) ||
+                ((value[1] - value[0]) / value[2] >= SWEEP_LIST_MAX))
+            {
+                err = EINVAL;
+            } /* if */
+            else
+            {
+                n = 1 + floor ((value[1] - value[0]) / value[2] *
+                               (1.0 + DBL_EPSILON));
+            } /* else */
+        } /* if */
+
+        for (j = 0; (err == 0) && (j < n); j++)
+        {
+            if (array->len >= SWEEP_LIST_MAX)
+            {
+                err = EINVAL;
+            } /* if */
+            else
+            {
+                x = value[0] + j * value[2];
+
+                if (integer)
+                {
+                    tmp = (int) x;
+                    g_array_append_val (array, tmp);
+                } /* if */
+                else
+                {
+                    g_array_append_val (array, x);
+                } /* else */
+            } /* else */
+        } /* for */
+
+        g_strfreev (range);
+    } /* for */
+
+    g_strfreev (elem);
+
+    return err;
+} /* sweepParseValues() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Parses a (command line) list of filter types or DSP windows. The list
+ *  elements are separated by commas.
+ *
+ *  \param list         List to be parsed (may be NULL).
+ *  \param fltcls       Filter class of the types. If FLTCLASS_NOTDEF is
+ *                      passed the list is a list of DSP windows.
+ *  \param array        Array, which gets the types resp. windows (as \c int).
+ *
+ *  \return             Zero on success, else an error number from errno.h.
+ ******************************************************************************/
+static int sweepParseNames (const char *list, FLTCLASS fltcls, GArray *array)
+{
+    gchar **elem;
+    const char *name;
+    int i, index;
+
+    int err = 0;
+
+    if (list == NULL)
+    {
+        return 0;
+    } /* if */
+
+    elem = g_strsplit (list, ",", -1);
+
+    for (i = 0; (err == 0) && (elem[i] != NULL); i++)
+    {
+        index = 0;
+        name = sweepName (fltcls, index);
+
+        while ((name != NULL) && (g_ascii_strcasecmp (elem[i], name) != 0))
+        {
+            name = sweepName (fltcls, ++index);
+        } /* while */
+
+        if (name == NULL)
+        {
+            err = EINVAL;
+        } /* if */
+        else
+        {
+            g_array_append_val (array, index);
+        } /* else */
+    } /* for */
+
+    g_strfreev (elem);
+
+    return err;
+} /* sweepParseNames() */
+
+
+
+/* EXPORTED FUNCTION DEFINITIONS **********************************************/
+
+
+/* FUNCTION *******************************************************************/
+/** Main function of \c dfcgen-sweep.
+ *
+ *  \param argc         Number of command line arguments.
+ *  \param argv         Command line arguments.
+ *
+ *  \return             Zero on success, one on processing errors and two on
+ *                      invalid command line arguments.
+ ******************************************************************************/
+int main (int argc, char *argv[])
+{
+    DFCPRJ_FILTER prj;
+    FLTSWEEP_GRID grid;
+    GOptionContext *ctx;
+    gint64 usec;
+    int failed, metric;
+    int err = 0;
+    double width;
+    GError *error = NULL;
+    FLTSWEEP *pSweep = NULL;
+    FILE *out = stdout;
+    GArray *types = g_array_new (FALSE, FALSE, sizeof(int));
+    GArray *orders = g_array_new (FALSE, FALSE, sizeof(int));
+    GArray *cutoffs = g_array_new (FALSE, FALSE, sizeof(double));
+    GArray *windows = g_array_new (FALSE, FALSE, sizeof(int));
+
+#ifdef ENABLE_NLS
+    gchar* localedir = getPackageDirectory (DIR_ID_LOCALE);
+
+#ifdef G_OS_WIN32
+    /* bindtextdomain() is not UTF-8 aware
+     */
+    gchar* tmp = g_win32_locale_filename_from_utf8 (localedir);
+
+    g_free (localedir);
+    localedir = tmp;
+#endif                                                          /* G_OS_WIN32 */
+
+    bindtextdomain (GETTEXT_PACKAGE, localedir);
+    g_free (localedir);
+    bind_textdomain_codeset (GETTEXT_PACKAGE, "UTF-8");
+    textdomain (GETTEXT_PACKAGE);
+#endif
+
+    ctx = g_option_context_new (_("PROJECT [OUTPUT]"));
+    g_option_context_set_summary (
+        ctx, _("Generates the design of DFCGen project PROJECT for all"
+               " combinations of the given types, orders, cutoff frequencies"
+               " and windows, and writes a table of metrics (passband ripple,"
+               " stopband attenuation, group delay variation in samples,"
+               " multiply-accumulates per sample and maximum pole radius) to"
+               " file OUTPUT. If OUTPUT is omitted or \"-\", the standard"
+               " output is used. Parameters not given are taken from the"
+               " project."));
+    g_option_context_add_main_entries (ctx, sweepOptions, GETTEXT_PACKAGE);
+
+    if (!g_option_context_parse (ctx, &argc, &argv, &error) ||
+        (argc < 2) || (argc > 3))
+    {
+        if (error != NULL)
+        {
+            g_printerr ("%s\n", error->message);
+            g_error_free (error);
+        } /* if */
+        else
+        {
+            gchar *help = g_option_context_get_help (ctx, TRUE, NULL);
+
+            g_printerr ("%s", help);
+            g_free (help);
+        } /* else */
+
+        g_option_context_free (ctx);
+        return 2;
+    } /* if */
+
+    g_option_context_free (ctx);
+    memset (&prj, 0, sizeof (prj));
+    prjFileRead (argv[1], &prj, &error);
+
+    if (error != NULL)
+    {
+        g_printerr ("%s: %s\n", argv[1], error->message);
+        g_error_free (error);
+        return 1;
+    } /* if */
+
+    metric = FLTSWEEP_METRIC_SIZE;                              /* no sorting */
+
+    if (optSort != NULL)
+    {
+        metric = 0;
+
+        while ((metric < FLTSWEEP_METRIC_SIZE) &&
+               (g_ascii_strcasecmp (optSort,
+                                    filterSweepMetricName (metric)) != 0))
+        {
+            ++metric;
+        } /* while */
+
+        if (metric == FLTSWEEP_METRIC_SIZE)
+        {
+            err = EINVAL;
+        } /* if */
+    } /* if */
+
+    if ((err != 0) || (prj.fltcls == FLTCLASS_NOTDEF) ||
+        (sweepParseNames (optType, prj.fltcls, types) != 0) ||
+        (sweepParseValues (optOrder, TRUE, orders) != 0) ||
+        (sweepParseValues (optCutoff, FALSE, cutoffs) != 0) ||
+        (sweepParseNames (optWindow, FLTCLASS_NOTDEF, windows) != 0) ||
+        (optWidth < 0.0))
+    {
+        g_printerr (_("Invalid option argument\n"));
+        dfcPrjFree (&prj);
+        return 2;
+    } /* if */
+
+    width = optWidth;
+
+    if (width <= 0.0)                     /* take transition band from design */
+    {
+        if (prj.fltcls == FLTCLASS_LINFIR)
+        {
+            width = prj.design.linFir.width;
+        } /* if */
+        else if (prj.fltcls == FLTCLASS_STDIIR)
+        {
+            width = prj.design.stdIir.width;
+        } /* else if */
+    } /* if */
+
+    grid.types = types->len;
+    grid.pType = (const int *) types->data;
+    grid.orders = orders->len;
+    grid.pOrder = (const int *) orders->data;
+    grid.cutoffs = cutoffs->len;
+    grid.pCutoff = (const double *) cutoffs->data;
+    grid.windows = windows->len;
+    grid.pWindow = (const int *) windows->data;
+
+    err = filterSweepNew (prj.fltcls, &prj.design, &grid, prj.filter.f0,
+                          width, &pSweep);
+
+    if (err != 0)
+    {
+        g_printerr (_("Cannot create sweep (%s)\n"), strerror (err));
+    } /* if */
+
+    if ((err == 0) && (argc > 2) && (strcmp (argv[2], "-") != 0))
+    {
+        out = fopen (argv[2], "w");
+
+        if (out == NULL)
+        {
+            err = errno;
+            g_printerr ("%s: %s\n", argv[2], strerror (err));
+        } /* if */
+    } /* if */
+
+    if (err == 0)
+    {
+        usec = g_get_monotonic_time ();
+        failed = filterSweepRun (pSweep);
+        usec = g_get_monotonic_time () - usec;
+
+        if (metric < FLTSWEEP_METRIC_SIZE)
+        {
+            filterSweepSort (pSweep, metric, optDescending);
+        } /* if */
+
+        err = filterSweepWrite (pSweep, out, optCsv);
+
+        if (err != 0)
+        {
+            g_printerr ("%s\n", strerror (err));
+        } /* if */
+
+        if (!optQuiet)
+        {
+            g_printerr (_("%d designs swept (%d failed) in %.3g s\n"),
+                        pSweep->items, failed, 1E-6 * usec);
+        } /* if */
+    } /* if */
+
+    if ((out != stdout) && (out != NULL) && (fclose (out) != 0) && (err == 0))
+    {
+        err = errno;
+        g_printerr ("%s: %s\n", argv[2], strerror (err));
+    } /* if */
+
+    filterSweepFree (pSweep);
+    g_array_free (types, TRUE);
+    g_array_free (orders, TRUE);
+    g_array_free (cutoffs, TRUE);
+    g_array_free (windows, TRUE);
+    dfcPrjFree (&prj);
+
+    return (err == 0) ? 0 : 1;
+} /* main() */
+
+
+/******************************************************************************/
+/* END OF FILE                                                                */
+/******************************************************************************/
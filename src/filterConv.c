@@ -0,0 +1,415 @@
+/**
+ * \file        filterConv.c
+ * \brief       Block FFT convolution of long FIR filters (partitioned
+ *              overlap-save).
+ * \copyright   Copyright (C) 2006-2022 Ralf Hoppe <dfcgen@rho62.de>
+ */
+
+
+/* INCLUDE FILES **************************************************************/
+
+#include "filterConv.h"
+
+#include <string.h> /* memset(), memcpy(), memmove() */
+#include <limits.h> /* INT_MAX */
+#include <gsl/gsl_fft_real.h>
+#include <gsl/gsl_fft_halfcomplex.h>
+
+
+/* GLOBAL CONSTANT DEFINITIONS ************************************************/
+
+
+/* GLOBAL VARIABLE DEFINITIONS ************************************************/
+
+
+/* LOCAL TYPE DECLARATIONS ****************************************************/
+
+
+/* LOCAL CONSTANT DEFINITIONS *************************************************/
+
+#define FLTCONV_BLOCK_MIN       64             /**< Minimum block size */
+#define FLTCONV_BLOCK_MAX       4096           /**< Maximum block size */
+#define FLTCONV_BENCH_TAPS      8 /**< Number of taps on first crossover test */
+#define FLTCONV_BENCH_SAMPLES   8192 /**< Samples per crossover measurement */
+
+
+/* LOCAL VARIABLE DEFINITIONS *************************************************/
+
+static gsize convCrossover = 0; /**< Cached crossover (0 if not measured yet) */
+
+
+/* LOCAL MACRO DEFINITIONS ****************************************************/
+
+
+/* LOCAL FUNCTION DECLARATIONS ************************************************/
+
+static int convBlockSize (int taps, int block);
+static void convDirect (const MATHPOLY *pPoly, const double *in, double *out, int n);
+static gint64 convBenchDirect (const MATHPOLY *pPoly, double *buf);
+static gint64 convBenchFft (const MATHPOLY *pPoly, double *buf);
+static int convMeasureCrossover (void);
+
+
+/* LOCAL FUNCTION DEFINITIONS *************************************************/
+
+
+/* FUNCTION *******************************************************************/
+/** Rounds up a block size to the next power of two in range
+ *  FLTCONV_BLOCK_MIN ... FLTCONV_BLOCK_MAX.
+ *
+ *  \param taps         Number of FIR coefficients.
+ *  \param block        Requested block size (zero for default).
+ *
+ *  \return             Block size.
+ ******************************************************************************/
+static int convBlockSize (int taps, int block)
+{
+    int size = FLTCONV_BLOCK_MIN;
+
+    if (block <= 0)              /* default: four partitions (at least) */
+    {
+        block = taps / 4;
+    } /* if */
+
+    while ((size < block) && (size < FLTCONV_BLOCK_MAX))
+    {
+        size *= 2;
+    } /* while */
+
+    return size;
+} /* convBlockSize() */
+
+
+/* FUNCTION *******************************************************************/
+/** Direct form FIR convolution (reference for crossover measurement). All
+ *  samples before \p in are assumed to be zero.
+ *
+ *  \param pPoly        Pointer to FIR polynomial.
+ *  \param in           Input samples.
+ *  \param out          Buffer which gets the output samples.
+ *  \param n            Number of samples.
+ *
+ ******************************************************************************/
+static void convDirect (const MATHPOLY *pPoly, const double *in, double *out, int n)
+{
+    int i, k, kmax;
+    double sum;
+
+    for (i = 0; i < n; i++)
+    {
+        sum = 0.0;
+        kmax = GSL_MIN_INT (i, pPoly->degree);
+
+        for (k = 0; k <= kmax; k++)
+        {
+            sum += pPoly->coeff[k] * in[i - k];
+        } /* for */
+
+        out[i] = sum;
+    } /* for */
+} /* convDirect() */
+
+
+/* FUNCTION *******************************************************************/
+/** Measures the time of direct form convolution.
+ *
+ *  \param pPoly        Pointer to FIR polynomial.
+ *  \param buf          Buffer of size 2 FLTCONV_BENCH_SAMPLES, the first half
+ *                      holding input samples.
+ *
+ *  \return             Elapsed time in microseconds.
+ ******************************************************************************/
+static gint64 convBenchDirect (const MATHPOLY *pPoly, double *buf)
+{
+    gint64 start = g_get_monotonic_time ();
+
+    convDirect (pPoly, buf, buf + FLTCONV_BENCH_SAMPLES, FLTCONV_BENCH_SAMPLES);
+
+    return g_get_monotonic_time () - start;
+} /* convBenchDirect() */
+
+
+/* FUNCTION *******************************************************************/
+/** Measures the time of block FFT convolution (inclusive setup).
+ *
+ *  \param pPoly        Pointer to FIR polynomial.
+ *  \param buf          Buffer of size 2 FLTCONV_BENCH_SAMPLES, the first half
+ *                      holding input samples.
+ *
+ *  \return             Elapsed time in microseconds, or a negative number
+ *                      on error.
+ ******************************************************************************/
+static gint64 convBenchFft (const MATHPOLY *pPoly, double *buf)
+{
+    int err;
+    FLTCONV_WORKSPACE *pConv;
+
+    gint64 start = g_get_monotonic_time ();
+
+    pConv = filterConvNew (pPoly, 0);
+
+    if (pConv == NULL)
+    {
+        return -1;
+    } /* if */
+
+    err = filterConvProcess (pConv, buf, buf + FLTCONV_BENCH_SAMPLES,
+                             FLTCONV_BENCH_SAMPLES);
+    filterConvFree (pConv);
+
+    if (err != 0)
+    {
+        return -1;
+    } /* if */
+
+    return g_get_monotonic_time () - start;
+} /* convBenchFft() */
+
+
+/* FUNCTION *******************************************************************/
+/** Measures the number of FIR coefficients above which the block FFT
+ *  convolution is faster than the direct form.
+ *
+ *  \return             Number of taps (crossover threshold), INT_MAX if the
+ *                      FFT never wins (or out of memory).
+ ******************************************************************************/
+static int convMeasureCrossover (void)
+{
+    int i;
+    double *buf;
+    gint64 tfft;
+    MATHPOLY poly;
+
+    int taps = INT_MAX;                             /* preset: FFT never wins */
+
+    poly.degree = FLT_DEGREE_MAX;
+    buf = g_malloc (2 * FLTCONV_BENCH_SAMPLES * sizeof(double));
+
+    if ((buf == NULL) || (mathPolyMallocCoeffs (&poly) != 0))
+    {
+        g_free (buf);
+        return taps;
+    } /* if */
+
+    for (i = 0; i <= poly.degree; i++)         /* some non-trivial response */
+    {
+        poly.coeff[i] = 1.0 / (1 + i);
+    } /* for */
+
+    for (i = 0; i < FLTCONV_BENCH_SAMPLES; i++)
+    {
+        buf[i] = (i & 1) ? 0.5 : -0.25;
+    } /* for */
+
+    for (i = FLTCONV_BENCH_TAPS; i <= FLT_DEGREE_MAX + 1; i *= 2)
+    {
+        poly.degree = i - 1;
+        tfft = convBenchFft (&poly, buf);
+
+        if ((tfft >= 0) && (tfft < convBenchDirect (&poly, buf)))
+        {
+            taps = i;
+            break;
+        } /* if */
+    } /* for */
+
+    DEBUG_LOG ("FFT convolution crossover at %d taps", taps);
+
+    mathPolyFree (&poly);
+    g_free (buf);
+
+    return taps;
+} /* convMeasureCrossover() */
+
+
+
+/* EXPORTED FUNCTION DEFINITIONS **********************************************/
+
+
+/* FUNCTION *******************************************************************/
+/** Returns the number of FIR coefficients above which the block FFT
+ *  convolution is faster than the direct form (sample by sample). The
+ *  crossover is measured on first call and cached afterwards. The function
+ *  may be called from any thread; concurrent first calls block until the
+ *  one measurement has finished.
+ *
+ *  \return             Number of taps (crossover threshold).
+ ******************************************************************************/
+int filterConvCrossover (void)
+{
+    if (g_once_init_enter (&convCrossover))           /* not measured before? */
+    {
+        g_once_init_leave (&convCrossover, convMeasureCrossover ());
+    } /* if */
+
+    return (int) convCrossover;
+} /* filterConvCrossover() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Creates a workspace for block FFT convolution.
+ *
+ *  \param pPoly        Pointer to FIR polynomial (impulse response).
+ *  \param block        Requested block size, means latency (rounded up to
+ *                      a power of two). Pass zero for a block size derived
+ *                      from the filter length.
+ *
+ *  \return             Pointer to workspace on success, else NULL (out of
+ *                      memory).
+ ******************************************************************************/
+FLTCONV_WORKSPACE* filterConvNew (const MATHPOLY *pPoly, int block)
+{
+    int i, len;
+    double *pSpec;
+    FLTCONV_WORKSPACE *pConv = g_malloc (sizeof (FLTCONV_WORKSPACE));
+
+    if (pConv == NULL)
+    {
+        return NULL;
+    } /* if */
+
+    pConv->taps = pPoly->degree + 1;
+    pConv->block = convBlockSize (pConv->taps, block);
+    pConv->size = 2 * pConv->block;
+    pConv->parts = (pConv->taps + pConv->block - 1) / pConv->block;
+
+    pConv->pPart =                      /* one malloc for all buffers */
+        g_malloc ((2 * pConv->parts + 2) * pConv->size * sizeof(double));
+
+    if (pConv->pPart == NULL)
+    {
+        g_free (pConv);
+        return NULL;
+    } /* if */
+
+    pConv->pDelay = pConv->pPart + pConv->parts * pConv->size;
+    pConv->pIn = pConv->pDelay + pConv->parts * pConv->size;
+    pConv->pAcc = pConv->pIn + pConv->size;
+
+    for (i = 0, pSpec = pConv->pPart; i < pConv->parts; i++, pSpec += pConv->size)
+    {
+        len = GSL_MIN_INT (pConv->block, pConv->taps - i * pConv->block);
+        memset (pSpec, 0, pConv->size * sizeof(double));
+        memcpy (pSpec, &pPoly->coeff[i * pConv->block], len * sizeof(double));
+
+        if (gsl_fft_real_radix2_transform (pSpec, 1, pConv->size) != GSL_SUCCESS)
+        {
+            filterConvFree (pConv);
+            return NULL;
+        } /* if */
+    } /* for */
+
+    filterConvReset (pConv);
+
+    return pConv;
+} /* filterConvNew() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Filters a sequence of samples by block FFT convolution. Input and output
+ *  buffer may be the same.
+ *
+ *  \param pConv        Pointer to workspace, formerly created by
+ *                      filterConvNew().
+ *  \param in           Input samples.
+ *  \param out          Buffer which gets the output samples.
+ *  \param n            Number of samples (must be a multiple of the block
+ *                      size \a block).
+ *
+ *  \return             Zero on success, else an error number (see errno.h or
+ *                      gsl_errno.h for predefined codes).
+ ******************************************************************************/
+int filterConvProcess (FLTCONV_WORKSPACE *pConv, const double *in,
+                       double *out, int n)
+{
+    int i, k, half, err;
+    double *x, *h, *acc;
+
+    ASSERT (n % pConv->block == 0);
+
+    half = pConv->size / 2;
+    acc = pConv->pAcc;
+
+    for (; n > 0; n -= pConv->block, in += pConv->block, out += pConv->block)
+    {
+        memmove (pConv->pIn, pConv->pIn + pConv->block,       /* slide input */
+                 pConv->block * sizeof(double));
+        memcpy (pConv->pIn + pConv->block, in, pConv->block * sizeof(double));
+
+        pConv->head = (pConv->head + pConv->parts - 1) % pConv->parts;
+        x = pConv->pDelay + pConv->head * pConv->size;
+        memcpy (x, pConv->pIn, pConv->size * sizeof(double));
+
+        err = gsl_fft_real_radix2_transform (x, 1, pConv->size);
+
+        if (err != GSL_SUCCESS)
+        {
+            return err;
+        } /* if */
+
+        memset (acc, 0, pConv->size * sizeof(double));
+
+        for (i = 0, h = pConv->pPart; i < pConv->parts; i++, h += pConv->size)
+        {                            /* multiply-accumulate in halfcomplex */
+            x = pConv->pDelay + ((pConv->head + i) % pConv->parts) * pConv->size;
+            acc[0] += x[0] * h[0];
+            acc[half] += x[half] * h[half];
+
+            for (k = 1; k < half; k++)
+            {
+                acc[k] += x[k] * h[k] - x[pConv->size - k] * h[pConv->size - k];
+                acc[pConv->size - k] += x[k] * h[pConv->size - k]
+                    + x[pConv->size - k] * h[k];
+            } /* for */
+        } /* for */
+
+        err = gsl_fft_halfcomplex_radix2_inverse (acc, 1, pConv->size);
+
+        if (err != GSL_SUCCESS)
+        {
+            return err;
+        } /* if */
+
+        memcpy (out, acc + pConv->block, pConv->block * sizeof(double));
+    } /* for */
+
+    return 0;
+} /* filterConvProcess() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Resets the convolution state (all past input samples are set to zero).
+ *
+ *  \param pConv        Pointer to workspace.
+ *
+ ******************************************************************************/
+void filterConvReset (FLTCONV_WORKSPACE *pConv)
+{
+    memset (pConv->pDelay, 0, pConv->parts * pConv->size * sizeof(double));
+    memset (pConv->pIn, 0, pConv->size * sizeof(double));
+    pConv->head = 0;
+} /* filterConvReset() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Free's a block FFT convolution workspace.
+ *
+ *  \param pConv        Pointer to workspace, formerly created by
+ *                      filterConvNew().
+ *
+ ******************************************************************************/
+void filterConvFree (FLTCONV_WORKSPACE *pConv)
+{
+    g_free (pConv->pPart);
+    g_free (pConv);
+} /* filterConvFree() */
+
+
+
+/******************************************************************************/
+/* END OF FILE                                                                */
+/******************************************************************************/
@@ -0,0 +1,1138 @@
+/**
+ * \file        filterEngine.c
+ * \brief       Filter engines for (fast) block processing of sample streams.
+ * \copyright   Copyright (C) 2006-2022 Ralf Hoppe <dfcgen@rho62.de>
+ */
+
+
+/* INCLUDE FILES **************************************************************/
+
+#include "mathMisc.h"
+#include "filterEngine.h"
+
+#include <errno.h>
+#include <stdlib.h> /* qsort() */
+#include <string.h> /* memset(), memcpy() */
+#include <gsl/gsl_complex_math.h>
+
+
+/* GLOBAL CONSTANT DEFINITIONS ************************************************/
+
+
+/* GLOBAL VARIABLE DEFINITIONS ************************************************/
+
+
+/* LOCAL TYPE DECLARATIONS ****************************************************/
+
+/** Real quadratic (or linear) factor \f$1+c_1 z^{-1}+c_2 z^{-2}\f$ of a
+ *  polynomial in \f$z^{-1}\f$.
+ */
+typedef struct
+{
+    double c1, c2;                                         /**< Coefficients */
+    gsl_complex z;     /**< Representative root (imaginary part not negative) */
+    BOOL used;                         /**< Already assigned to a section? */
+} FLTENGINE_QUAD;
+
+
+/* LOCAL CONSTANT DEFINITIONS *************************************************/
+
+#define FLTENGINE_REAL_EPS      1E-8 /**< Relative limit for real roots */
+#define FLTENGINE_UNROLL_MAX    16  /**< Maximum degree of unrolled kernels */
+#define FLTENGINE_CHECK_SIZE    1024   /**< Samples per kernel check block */
+#define FLTENGINE_CHECK_LOOPS   64      /**< Blocks per kernel check (time) */
+#define FLTENGINE_CHECK_EPS     1E-12    /**< Relative kernel check tolerance */
+
+
+/* LOCAL VARIABLE DEFINITIONS *************************************************/
+
+#ifdef DEBUG
+static gsize engineChecked = 0;   /**< Kernels checked against generic loop? */
+#endif
+
+
+/* LOCAL MACRO DEFINITIONS ****************************************************/
+
+
+/* MACRO **********************************************************************/
+/** Updates state element \p k-1 of the direct form II (transposed) from
+ *  input \c x, output \c y and the next state element \p k (see macro
+ *  FLTENGINE_DF2T_KERNEL).
+ *
+ *  \param k            Index of coefficients (a constant).
+ *
+ ******************************************************************************/
+#define FLTENGINE_DF2T_TAP(k)                                   \
+    s[(k) - 1] = b[k] * x - a[k] * y + s[k];
+
+
+/* MACRO **********************************************************************/
+/** Sequences of FLTENGINE_DF2T_TAP() for the inner state elements of a
+ *  direct form II (transposed) of degree \e n (FLTENGINE_DF2T_TAPS_n).
+ ******************************************************************************/
+#define FLTENGINE_DF2T_TAPS_1
+#define FLTENGINE_DF2T_TAPS_2 FLTENGINE_DF2T_TAPS_1 FLTENGINE_DF2T_TAP(1)
+#define FLTENGINE_DF2T_TAPS_3 FLTENGINE_DF2T_TAPS_2 FLTENGINE_DF2T_TAP(2)
+#define FLTENGINE_DF2T_TAPS_4 FLTENGINE_DF2T_TAPS_3 FLTENGINE_DF2T_TAP(3)
+#define FLTENGINE_DF2T_TAPS_5 FLTENGINE_DF2T_TAPS_4 FLTENGINE_DF2T_TAP(4)
+#define FLTENGINE_DF2T_TAPS_6 FLTENGINE_DF2T_TAPS_5 FLTENGINE_DF2T_TAP(5)
+#define FLTENGINE_DF2T_TAPS_7 FLTENGINE_DF2T_TAPS_6 FLTENGINE_DF2T_TAP(6)
+#define FLTENGINE_DF2T_TAPS_8 FLTENGINE_DF2T_TAPS_7 FLTENGINE_DF2T_TAP(7)
+#define FLTENGINE_DF2T_TAPS_9 FLTENGINE_DF2T_TAPS_8 FLTENGINE_DF2T_TAP(8)
+#define FLTENGINE_DF2T_TAPS_10 FLTENGINE_DF2T_TAPS_9 FLTENGINE_DF2T_TAP(9)
+#define FLTENGINE_DF2T_TAPS_11 FLTENGINE_DF2T_TAPS_10 FLTENGINE_DF2T_TAP(10)
+#define FLTENGINE_DF2T_TAPS_12 FLTENGINE_DF2T_TAPS_11 FLTENGINE_DF2T_TAP(11)
+#define FLTENGINE_DF2T_TAPS_13 FLTENGINE_DF2T_TAPS_12 FLTENGINE_DF2T_TAP(12)
+#define FLTENGINE_DF2T_TAPS_14 FLTENGINE_DF2T_TAPS_13 FLTENGINE_DF2T_TAP(13)
+#define FLTENGINE_DF2T_TAPS_15 FLTENGINE_DF2T_TAPS_14 FLTENGINE_DF2T_TAP(14)
+#define FLTENGINE_DF2T_TAPS_16 FLTENGINE_DF2T_TAPS_15 FLTENGINE_DF2T_TAP(15)
+
+
+/* MACRO **********************************************************************/
+/** Defines the fully unrolled direct form II (transposed) kernel function
+ *  engineDirect\e n() for a filter of (constant) degree \p n. Coefficients
+ *  and state are copied into local arrays of constant size, which are
+ *  accessed by constant indices only. So the compiler is able to hold them
+ *  in registers while processing a block of samples.
+ *
+ *  \param n            Degree of filter (1 ... FLTENGINE_UNROLL_MAX).
+ *
+ ******************************************************************************/
+#define FLTENGINE_DF2T_KERNEL(n)                                        \
+static void engineDirect##n (FLTENGINE *pEngine, const double *in,      \
+                             double *out, int size)                     \
+{                                                                       \
+    int i;                                                              \
+    double x, y, b[(n) + 1], a[(n) + 1], s[n];                          \
+                                                                        \
+    memcpy (b, pEngine->pNum, sizeof(b));                               \
+    memcpy (a, pEngine->pDen, sizeof(a));                               \
+    memcpy (s, pEngine->pState, sizeof(s));                             \
+                                                                        \
+    for (i = 0; i < size; i++)                                          \
+    {                                                                   \
+        x = in[i];                                                      \
+        y = b[0] * x + s[0];                                            \
+        FLTENGINE_DF2T_TAPS_##n                                         \
+        s[(n) - 1] = b[n] * x - a[n] * y;                               \
+        out[i] = y;                                                     \
+    } /* for */                                                         \
+                                                                        \
+    memcpy (pEngine->pState, s, sizeof(s));                             \
+} /* engineDirect##n() */
+
+
+/* LOCAL FUNCTION DECLARATIONS ************************************************/
+
+static int engineRoots (const MATHPOLY *poly, BOOL valid, gsl_complex *root);
+static int engineCmpQuad (const void *p1, const void *p2);
+static int engineCmpReal (const void *p1, const void *p2);
+static int engineQuadratics (const gsl_complex *root, int n, FLTENGINE_QUAD *pQuad);
+static int engineNewBiquad (FLTENGINE *pEngine, const FLTCOEFF *pFilter);
+static int engineNewDirect (FLTENGINE *pEngine, const FLTCOEFF *pFilter);
+static int engineNewFft (FLTENGINE *pEngine, const FLTCOEFF *pFilter, int block);
+static void engineDirectGeneric (FLTENGINE *pEngine, const double *in,
+                                 double *out, int n);
+static void engineDirectMulti (FLTENGINE *pEngine, const double *in,
+                               double *out, int n);
+static void engineBiquadMulti (FLTENGINE *pEngine, const double *in,
+                               double *out, int n);
+static int engineFftMulti (FLTENGINE *pEngine, const double *in,
+                           double *out, int n);
+
+#ifdef DEBUG
+static int engineCheckKernels (void);
+#endif
+
+
+/* LOCAL FUNCTION DEFINITIONS *************************************************/
+
+
+/* Unrolled direct form II (transposed) kernels, degree 1 ... 16.
+ */
+FLTENGINE_DF2T_KERNEL(1)
+FLTENGINE_DF2T_KERNEL(2)
+FLTENGINE_DF2T_KERNEL(3)
+FLTENGINE_DF2T_KERNEL(4)
+FLTENGINE_DF2T_KERNEL(5)
+FLTENGINE_DF2T_KERNEL(6)
+FLTENGINE_DF2T_KERNEL(7)
+FLTENGINE_DF2T_KERNEL(8)
+FLTENGINE_DF2T_KERNEL(9)
+FLTENGINE_DF2T_KERNEL(10)
+FLTENGINE_DF2T_KERNEL(11)
+FLTENGINE_DF2T_KERNEL(12)
+FLTENGINE_DF2T_KERNEL(13)
+FLTENGINE_DF2T_KERNEL(14)
+FLTENGINE_DF2T_KERNEL(15)
+FLTENGINE_DF2T_KERNEL(16)
+
+
+/** Unrolled direct form II (transposed) kernels, indexed by degree (there is
+ *  no kernel for degree zero).
+ */
+static void (* const engineDirectKernels[FLTENGINE_UNROLL_MAX + 1])
+    (FLTENGINE *pEngine, const double *in, double *out, int size) =
+{
+    NULL,
+    engineDirect1,
+    engineDirect2,
+    engineDirect3,
+    engineDirect4,
+    engineDirect5,
+    engineDirect6,
+    engineDirect7,
+    engineDirect8,
+    engineDirect9,
+    engineDirect10,
+    engineDirect11,
+    engineDirect12,
+    engineDirect13,
+    engineDirect14,
+    engineDirect15,
+    engineDirect16
+};
+
+
+/* FUNCTION *******************************************************************/
+/** Gets the roots of a polynomial in \e Z domain.
+ *
+ *  \param poly         Pointer to polynomial.
+ *  \param valid        If TRUE the roots in \p poly are valid (copy only).
+ *  \param root         Buffer which gets the \e Z domain roots.
+ *
+ *  \return             Zero on success, else an error number (see errno.h or
+ *                      gsl_errno.h for predefined codes).
+ ******************************************************************************/
+static int engineRoots (const MATHPOLY *poly, BOOL valid, gsl_complex *root)
+{
+    int i, err;
+    MATHPOLY tmp;
+
+    if (valid || (poly->degree == 0))
+    {
+        memcpy (root, poly->root, poly->degree * sizeof(root[0]));
+        return 0;
+    } /* if */
+
+    tmp.degree = poly->degree;
+    err = mathPolyMalloc (&tmp);
+
+    if (err == 0)
+    {
+        memcpy (tmp.coeff, poly->coeff, (1 + poly->degree) * sizeof(tmp.coeff[0]));
+        err = mathPolyCoeffs2Roots (&tmp);
+
+        for (i = 0; (err == 0) && (i < tmp.degree); i++)
+        {                          /* roots of 1/z polynomial -> Z domain */
+            root[i] = gsl_complex_inverse (tmp.root[i]);
+        } /* for */
+
+        mathPolyFree (&tmp);
+    } /* if */
+
+    return err;
+} /* engineRoots() */
+
+
+/* FUNCTION *******************************************************************/
+/** Compares two quadratics by radius of their roots (for qsort).
+ *
+ *  \param p1           Pointer to first FLTENGINE_QUAD.
+ *  \param p2           Pointer to second FLTENGINE_QUAD.
+ *
+ *  \return             -1, 0 or 1 if first radius is less, equal or greater.
+ ******************************************************************************/
+static int engineCmpQuad (const void *p1, const void *p2)
+{
+    double r1 = gsl_complex_abs (((const FLTENGINE_QUAD *)p1)->z);
+    double r2 = gsl_complex_abs (((const FLTENGINE_QUAD *)p2)->z);
+
+    return (r1 > r2) - (r1 < r2);
+} /* engineCmpQuad() */
+
+
+/* FUNCTION *******************************************************************/
+/** Compares two doubles (for qsort).
+ *
+ *  \param p1           Pointer to first double.
+ *  \param p2           Pointer to second double.
+ *
+ *  \return             -1, 0 or 1 if first value is less, equal or greater.
+ ******************************************************************************/
+static int engineCmpReal (const void *p1, const void *p2)
+{
+    double x1 = *(const double *)p1;
+    double x2 = *(const double *)p2;
+
+    return (x1 > x2) - (x1 < x2);
+} /* engineCmpReal() */
+
+
+/* FUNCTION *******************************************************************/
+/** Combines the roots of a real polynomial into real quadratic factors. Each
+ *  complex root is combined with its conjugate, real roots are combined in
+ *  ascending order (the last one may remain as linear factor).
+ *
+ *  \param root         Roots in \e Z domain.
+ *  \param n            Number of roots.
+ *  \param pQuad        Buffer which gets the quadratics (n elements at least).
+ *
+ *  \return             Number of quadratics on success, else a negative
+ *                      number (unpaired complex roots or out of memory).
+ ******************************************************************************/
+static int engineQuadratics (const gsl_complex *root, int n, FLTENGINE_QUAD *pQuad)
+{
+    int i, reals = 0, cplx = 0, quads = 0;
+    double *pReal = g_malloc ((n + 1) * sizeof(double));
+
+    if (pReal == NULL)
+    {
+        return -1;
+    } /* if */
+
+    for (i = 0; i < n; i++)
+    {
+        if (fabs (GSL_IMAG (root[i])) <=
+            FLTENGINE_REAL_EPS * (1.0 + gsl_complex_abs (root[i])))
+        {
+            pReal[reals++] = GSL_REAL (root[i]);
+        } /* if */
+        else
+        {
+            if (GSL_IMAG (root[i]) > 0.0)      /* take one of conjugate pair */
+            {
+                pQuad[quads].c1 = -2.0 * GSL_REAL (root[i]);
+                pQuad[quads].c2 = gsl_complex_abs2 (root[i]);
+                pQuad[quads].z = root[i];
+                ++quads;
+            } /* if */
+
+            ++cplx;
+        } /* else */
+    } /* for */
+
+    if (2 * quads != cplx)                       /* not a real polynomial? */
+    {
+        g_free (pReal);
+        return -1;
+    } /* if */
+
+    qsort (pReal, reals, sizeof(double), engineCmpReal);
+
+    for (i = 0; i < reals; i += 2, quads++)
+    {
+        if (i + 1 < reals)
+        {
+            pQuad[quads].c1 = -(pReal[i] + pReal[i + 1]);
+            pQuad[quads].c2 = pReal[i] * pReal[i + 1];
+            pQuad[quads].z = gsl_complex_rect (pReal[i + 1], 0.0);
+        } /* if */
+        else                                           /* linear factor */
+        {
+            pQuad[quads].c1 = -pReal[i];
+            pQuad[quads].c2 = 0.0;
+            pQuad[quads].z = gsl_complex_rect (pReal[i], 0.0);
+        } /* else */
+    } /* for */
+
+    for (i = 0; i < quads; i++)
+    {
+        pQuad[i].used = FALSE;
+    } /* for */
+
+    g_free (pReal);
+    return quads;
+} /* engineQuadratics() */
+
+
+/* FUNCTION *******************************************************************/
+/** Initializes a filter engine with a cascade of second order sections. The
+ *  poles are ordered by increasing radius, and each pole pair gets the
+ *  nearest (still unassigned) zero pair, starting with the poles next to the
+ *  unit circle.
+ *
+ *  \param pEngine      Pointer to filter engine.
+ *  \param pFilter      Pointer to filter coefficients.
+ *
+ *  \return             Zero on success, else an error number (see errno.h or
+ *                      gsl_errno.h for predefined codes).
+ ******************************************************************************/
+static int engineNewBiquad (FLTENGINE *pEngine, const FLTCOEFF *pFilter)
+{
+    int i, k, best, nq, err;
+    double dist, mindist;
+    FLTENGINE_QUAD *pNumQuad, *pDenQuad;
+    gsl_complex *root;
+    FLTENGINE_SOS *pSos;
+
+    int dq = -1;
+    int size = 1 + GSL_MAX_INT (pFilter->num.degree, pFilter->den.degree);
+    double gain = mathTryDiv (pFilter->num.coeff[0], pFilter->den.coeff[0]);
+
+    if (!gsl_finite (gain) || (gain == 0.0))        /* leading delay (b_0=0)? */
+    {
+        return GSL_EDOM;
+    } /* if */
+
+    root = g_malloc (size * sizeof(gsl_complex));
+    pNumQuad = g_malloc (2 * size * sizeof(FLTENGINE_QUAD));
+
+    if ((root == NULL) || (pNumQuad == NULL))
+    {
+        g_free (root);
+        g_free (pNumQuad);
+        return ENOMEM;
+    } /* if */
+
+    pDenQuad = pNumQuad + size;
+    err = engineRoots (&pFilter->num, pFilter->factor != 0.0, root);
+    nq = (err == 0) ? engineQuadratics (root, pFilter->num.degree, pNumQuad) : -1;
+
+    if (nq >= 0)
+    {
+        err = engineRoots (&pFilter->den, pFilter->factor != 0.0, root);
+        dq = (err == 0) ? engineQuadratics (root, pFilter->den.degree, pDenQuad) : -1;
+    } /* if */
+
+    g_free (root);
+
+    if ((nq < 0) || (dq < 0))
+    {
+        g_free (pNumQuad);
+        return (err != 0) ? err : GSL_EFAILED;
+    } /* if */
+
+    pEngine->degree = GSL_MAX_INT (1, GSL_MAX_INT (nq, dq));
+    pEngine->pSos = g_malloc (pEngine->degree * sizeof(FLTENGINE_SOS));
+    pEngine->pState = g_malloc (2 * pEngine->degree * pEngine->channels
+                                * sizeof(double));
+
+    if ((pEngine->pSos == NULL) || (pEngine->pState == NULL))
+    {
+        g_free (pNumQuad);
+        return ENOMEM;
+    } /* if */
+
+    qsort (pDenQuad, dq, sizeof(FLTENGINE_QUAD), engineCmpQuad);
+
+    for (i = 0, pSos = pEngine->pSos; i < pEngine->degree; i++, pSos++)
+    {
+        pSos->b0 = 1.0;
+        pSos->b1 = pSos->b2 = pSos->a1 = pSos->a2 = 0.0;
+
+        if (i < dq)
+        {
+            pSos->a1 = pDenQuad[i].c1;
+            pSos->a2 = pDenQuad[i].c2;
+        } /* if */
+    } /* for */
+
+    for (i = dq - 1; i >= 0; i--)           /* poles next to unit circle 1st */
+    {
+        best = -1;
+        mindist = GSL_POSINF;
+
+        for (k = 0; k < nq; k++)
+        {
+            dist = gsl_complex_abs (gsl_complex_sub (pNumQuad[k].z, pDenQuad[i].z));
+
+            if (!pNumQuad[k].used && (dist < mindist))
+            {
+                mindist = dist;
+                best = k;
+            } /* if */
+        } /* for */
+
+        if (best >= 0)
+        {
+            pNumQuad[best].used = TRUE;
+            pEngine->pSos[i].b1 = pNumQuad[best].c1;
+            pEngine->pSos[i].b2 = pNumQuad[best].c2;
+        } /* if */
+    } /* for */
+
+    for (k = 0, i = dq; k < nq; k++)       /* zeros left (more zeros than poles) */
+    {
+        if (!pNumQuad[k].used)
+        {
+            pEngine->pSos[i].b1 = pNumQuad[k].c1;
+            pEngine->pSos[i].b2 = pNumQuad[k].c2;
+            ++i;
+        } /* if */
+    } /* for */
+
+    pEngine->pSos[0].b0 *= gain;              /* factor into first section */
+    pEngine->pSos[0].b1 *= gain;
+    pEngine->pSos[0].b2 *= gain;
+
+    g_free (pNumQuad);
+    return 0;
+} /* engineNewBiquad() */
+
+
+/* FUNCTION *******************************************************************/
+/** Initializes a filter engine with the direct form II (transposed).
+ *
+ *  \param pEngine      Pointer to filter engine.
+ *  \param pFilter      Pointer to filter coefficients.
+ *
+ *  \return             Zero on success, else an error number (see errno.h or
+ *                      gsl_errno.h for predefined codes).
+ ******************************************************************************/
+static int engineNewDirect (FLTENGINE *pEngine, const FLTCOEFF *pFilter)
+{
+    int i;
+    double a0 = pFilter->den.coeff[0];
+
+    if (a0 == 0.0)
+    {
+        return GSL_EDOM;
+    } /* if */
+
+    pEngine->degree = GSL_MAX_INT (pFilter->num.degree, pFilter->den.degree);
+    pEngine->pNum = g_malloc0 (2 * (pEngine->degree + 1) * sizeof(double));
+    pEngine->pState = g_malloc ((pEngine->degree + 1) * pEngine->channels
+                                * sizeof(double));
+    pEngine->pFrame = g_malloc (pEngine->channels * sizeof(double));
+
+    if ((pEngine->pNum == NULL) || (pEngine->pState == NULL) ||
+        (pEngine->pFrame == NULL))
+    {
+        return ENOMEM;
+    } /* if */
+
+    pEngine->pDen = pEngine->pNum + pEngine->degree + 1;
+
+    for (i = 0; i <= pFilter->num.degree; i++)
+    {
+        pEngine->pNum[i] = pFilter->num.coeff[i] / a0;
+    } /* for */
+
+    for (i = 0; i <= pFilter->den.degree; i++)
+    {
+        pEngine->pDen[i] = pFilter->den.coeff[i] / a0;
+    } /* for */
+
+    return 0;
+} /* engineNewDirect() */
+
+
+/* FUNCTION *******************************************************************/
+/** Initializes a filter engine with block FFT convolution.
+ *
+ *  \param pEngine      Pointer to filter engine.
+ *  \param pFilter      Pointer to filter coefficients (FIR filter).
+ *  \param block        Block size (zero for default).
+ *
+ *  \return             Zero on success, else an error number (see errno.h or
+ *                      gsl_errno.h for predefined codes).
+ ******************************************************************************/
+static int engineNewFft (FLTENGINE *pEngine, const FLTCOEFF *pFilter, int block)
+{
+    int i, c;
+    MATHPOLY poly;
+
+    if ((pFilter->den.degree != 0) || (pFilter->den.coeff[0] == 0.0))
+    {
+        return EINVAL;
+    } /* if */
+
+    poly.degree = pFilter->num.degree;
+
+    if (mathPolyMallocCoeffs (&poly) != 0)
+    {
+        return ENOMEM;
+    } /* if */
+
+    for (i = 0; i <= poly.degree; i++)
+    {
+        poly.coeff[i] = pFilter->num.coeff[i] / pFilter->den.coeff[0];
+    } /* for */
+
+    pEngine->ppConv = g_malloc0 (pEngine->channels * sizeof(FLTCONV_WORKSPACE *));
+
+    for (c = 0; (pEngine->ppConv != NULL) && (c < pEngine->channels); c++)
+    {
+        pEngine->ppConv[c] = filterConvNew (&poly, block);
+
+        if (pEngine->ppConv[c] == NULL)
+        {
+            mathPolyFree (&poly);
+            return ENOMEM;
+        } /* if */
+    } /* for */
+
+    mathPolyFree (&poly);
+
+    if (pEngine->ppConv == NULL)
+    {
+        return ENOMEM;
+    } /* if */
+
+    pEngine->block = pEngine->ppConv[0]->block;
+
+    if (pEngine->channels > 1)       /* deinterleave buffer (one channel) */
+    {
+        pEngine->pFrame = g_malloc (pEngine->block * sizeof(double));
+
+        if (pEngine->pFrame == NULL)
+        {
+            return ENOMEM;
+        } /* if */
+    } /* if */
+
+    return 0;
+} /* engineNewFft() */
+
+
+/* FUNCTION *******************************************************************/
+/** Filters interleaved sample frames by the direct form II (transposed). The
+ *  state element \e k of channel \e c is found at \a pState[k * \a channels
+ *  + \e c], so all loops over the channels work on adjacent data.
+ *
+ *  \param pEngine      Pointer to filter engine (FLTENGINE_DIRECT).
+ *  \param in           Input samples.
+ *  \param out          Buffer which gets the output samples.
+ *  \param n            Number of frames.
+ *
+ ******************************************************************************/
+static void engineDirectMulti (FLTENGINE *pEngine, const double *in,
+                               double *out, int n)
+{
+    int i, k, c;
+    double *s, *y;
+
+    int chan = pEngine->channels;
+    int deg = pEngine->degree;
+    double *x = pEngine->pFrame;
+    const double *b = pEngine->pNum;
+    const double *a = pEngine->pDen;
+
+    for (i = 0; i < n; i++)
+    {
+        memcpy (x, in + i * chan, chan * sizeof(double));    /* maybe in-place */
+        y = out + i * chan;
+        s = pEngine->pState;
+
+        for (c = 0; c < chan; c++)
+        {
+            y[c] = b[0] * x[c] + s[c];
+        } /* for */
+
+        for (k = 1; k < deg; k++, s += chan)
+        {
+            for (c = 0; c < chan; c++)
+            {
+                s[c] = b[k] * x[c] - a[k] * y[c] + s[chan + c];
+            } /* for */
+        } /* for */
+
+        if (deg > 0)
+        {
+            for (c = 0; c < chan; c++)
+            {
+                s[c] = b[deg] * x[c] - a[deg] * y[c];
+            } /* for */
+        } /* if */
+    } /* for */
+} /* engineDirectMulti() */
+
+
+/* FUNCTION *******************************************************************/
+/** Filters a sequence of samples by the direct form II (transposed) of any
+ *  degree (single channel). This is the generic counterpart of the unrolled
+ *  kernels engineDirect\e n().
+ *
+ *  \param pEngine      Pointer to filter engine (FLTENGINE_DIRECT).
+ *  \param in           Input samples.
+ *  \param out          Buffer which gets the output samples.
+ *  \param n            Number of samples.
+ *
+ ******************************************************************************/
+static void engineDirectGeneric (FLTENGINE *pEngine, const double *in,
+                                 double *out, int n)
+{
+    int i, k;
+    double x, y;
+
+    int deg = pEngine->degree;
+    double *s = pEngine->pState;
+    const double *b = pEngine->pNum;
+    const double *a = pEngine->pDen;
+
+    for (i = 0; i < n; i++)
+    {
+        x = in[i];
+        y = b[0] * x + s[0];
+
+        for (k = 1; k < deg; k++)
+        {
+            s[k - 1] = b[k] * x - a[k] * y + s[k];
+        } /* for */
+
+        if (deg > 0)
+        {
+            s[deg - 1] = b[deg] * x - a[deg] * y;
+        } /* if */
+
+        out[i] = y;
+    } /* for */
+} /* engineDirectGeneric() */
+
+
+/* FUNCTION *******************************************************************/
+/** Filters interleaved sample frames by a cascade of second order sections.
+ *  The two state elements of section \e k are held in \a pState[2k *
+ *  \a channels] and \a pState[(2k + 1) * \a channels] (channel-minor).
+ *
+ *  \param pEngine      Pointer to filter engine (FLTENGINE_BIQUAD).
+ *  \param in           Input samples.
+ *  \param out          Buffer which gets the output samples.
+ *  \param n            Number of frames.
+ *
+ ******************************************************************************/
+static void engineBiquadMulti (FLTENGINE *pEngine, const double *in,
+                               double *out, int n)
+{
+    int i, k, c;
+    double x, y;
+    double *s1, *s2, *py;
+    const double *px;
+    const FLTENGINE_SOS *pSos;
+
+    int chan = pEngine->channels;
+    const double *pIn = in;
+
+    for (k = 0, pSos = pEngine->pSos; k < pEngine->degree; k++, pSos++)
+    {
+        s1 = pEngine->pState + 2 * k * chan;
+        s2 = s1 + chan;
+
+        for (i = 0; i < n; i++)
+        {
+            px = pIn + i * chan;
+            py = out + i * chan;
+
+            for (c = 0; c < chan; c++)
+            {
+                x = px[c];
+                y = pSos->b0 * x + s1[c];
+                s1[c] = pSos->b1 * x - pSos->a1 * y + s2[c];
+                s2[c] = pSos->b2 * x - pSos->a2 * y;
+                py[c] = y;
+            } /* for */
+        } /* for */
+
+        pIn = out;                            /* next section works in-place */
+    } /* for */
+} /* engineBiquadMulti() */
+
+
+/* FUNCTION *******************************************************************/
+/** Filters interleaved sample frames by block FFT convolution. Each channel
+ *  has its own convolution workspace, so the frames are deinterleaved block
+ *  by block.
+ *
+ *  \param pEngine      Pointer to filter engine (FLTENGINE_FFT).
+ *  \param in           Input samples.
+ *  \param out          Buffer which gets the output samples.
+ *  \param n            Number of frames (multiple of \a block).
+ *
+ *  \return             Zero on success, else an error number (see errno.h or
+ *                      gsl_errno.h for predefined codes).
+ ******************************************************************************/
+static int engineFftMulti (FLTENGINE *pEngine, const double *in,
+                           double *out, int n)
+{
+    int i, c, pos, err;
+
+    int chan = pEngine->channels;
+    double *buf = pEngine->pFrame;
+
+    for (pos = 0; pos < n; pos += pEngine->block)
+    {
+        for (c = 0; c < chan; c++)
+        {
+            for (i = 0; i < pEngine->block; i++)
+            {
+                buf[i] = in[(pos + i) * chan + c];
+            } /* for */
+
+            err = filterConvProcess (pEngine->ppConv[c], buf, buf,
+                                     pEngine->block);
+            if (err != 0)
+            {
+                return err;
+            } /* if */
+
+            for (i = 0; i < pEngine->block; i++)
+            {
+                out[(pos + i) * chan + c] = buf[i];
+            } /* for */
+        } /* for */
+    } /* for */
+
+    return 0;
+} /* engineFftMulti() */
+
+
+
+#ifdef DEBUG
+
+/* FUNCTION *******************************************************************/
+/** Checks the unrolled direct form kernels against engineDirectGeneric() on a
+ *  (stable) filter of each degree 1 ... FLTENGINE_UNROLL_MAX, and logs the
+ *  processing time of both (debug builds only).
+ *
+ *  \return             Always one (for g_once_init_leave()).
+ ******************************************************************************/
+static int engineCheckKernels (void)
+{
+    int i, loop, deg;
+    gint64 start, unrolled, generic;
+    FLTENGINE engine;
+    double num[FLTENGINE_UNROLL_MAX + 1], den[FLTENGINE_UNROLL_MAX + 1];
+    double state[2][FLTENGINE_UNROLL_MAX + 1];
+    double in[FLTENGINE_CHECK_SIZE], out[2][FLTENGINE_CHECK_SIZE];
+
+    for (i = 0; i < FLTENGINE_CHECK_SIZE; i++)         /* deterministic noise */
+    {
+        in[i] = ((i * 7919) % 257) / 128.0 - 1.0;
+    } /* for */
+
+    for (i = 0; i <= FLTENGINE_UNROLL_MAX; i++)      /* sum of |a[k]| below 1 */
+    {
+        num[i] = 1.0 / (i + 1);
+        den[i] = ldexp ((i % 2) ? -1.0 : 1.0, -i - 1);
+    } /* for */
+
+    den[0] = 1.0;
+    memset (&engine, 0, sizeof(engine));
+    engine.type = FLTENGINE_DIRECT;
+    engine.channels = engine.block = 1;
+    engine.pNum = num;
+    engine.pDen = den;
+
+    for (deg = 1; deg <= FLTENGINE_UNROLL_MAX; deg++)
+    {
+        engine.degree = deg;
+        memset (state, 0, sizeof(state));
+
+        engine.pState = state[0];
+        start = g_get_monotonic_time ();
+
+        for (loop = 0; loop < FLTENGINE_CHECK_LOOPS; loop++)
+        {
+            engineDirectKernels[deg] (&engine, in, out[0],
+                                      FLTENGINE_CHECK_SIZE);
+        } /* for */
+
+        unrolled = g_get_monotonic_time () - start;
+        engine.pState = state[1];
+        start = g_get_monotonic_time ();
+
+        for (loop = 0; loop < FLTENGINE_CHECK_LOOPS; loop++)
+        {
+            engineDirectGeneric (&engine, in, out[1], FLTENGINE_CHECK_SIZE);
+        } /* for */
+
+        generic = g_get_monotonic_time () - start;
+
+        for (i = 0; i < FLTENGINE_CHECK_SIZE; i++)        /* FMA may differ */
+        {
+            ASSERT (fabs (out[0][i] - out[1][i]) <=
+                    FLTENGINE_CHECK_EPS * (1.0 + fabs (out[1][i])));
+        } /* for */
+
+        for (i = 0; i < deg; i++)
+        {
+            ASSERT (fabs (state[0][i] - state[1][i]) <=
+                    FLTENGINE_CHECK_EPS * (1.0 + fabs (state[1][i])));
+        } /* for */
+
+        DEBUG_LOG ("Direct form degree %d: unrolled %" G_GINT64_FORMAT
+                   " us, generic %" G_GINT64_FORMAT " us (%d samples)", deg,
+                   unrolled, generic,
+                   FLTENGINE_CHECK_LOOPS * FLTENGINE_CHECK_SIZE);
+    } /* for */
+
+    return 1;
+} /* engineCheckKernels() */
+
+#endif /* DEBUG */
+
+
+
+/* EXPORTED FUNCTION DEFINITIONS **********************************************/
+
+
+/* FUNCTION *******************************************************************/
+/** Creates a filter engine. On FLTENGINE_AUTO the engine is chosen from the
+ *  filter: FIR filters with at least filterConvCrossover() coefficients use
+ *  block FFT convolution, IIR filters of degree greater than two are split
+ *  into second order sections and all others use the direct form. Filters
+ *  with a leading delay (\f$b_0=0\f$) have no gain factor for the first
+ *  section, therefore FLTENGINE_BIQUAD falls back to FLTENGINE_DIRECT on them.
+ *
+ *  \param pFilter      Pointer to filter coefficients. If the roots are
+ *                      invalid (\a factor is zero) they are computed here.
+ *  \param type         Requested engine type.
+ *  \param block        Block size of FFT convolution (zero for default).
+ *  \param channels     Number of interleaved channels (one at least).
+ *  \param ppEngine     Pointer to a buffer which gets the pointer to the new
+ *                      engine (NULL on error).
+ *
+ *  \return             Zero on success, else an error number (see errno.h or
+ *                      gsl_errno.h for predefined codes).
+ ******************************************************************************/
+int filterEngineNew (const FLTCOEFF *pFilter, FLTENGINE_TYPE type,
+                     int block, int channels, FLTENGINE **ppEngine)
+{
+    int err;
+    FLTENGINE *pEngine;
+
+    *ppEngine = NULL;
+
+#ifdef DEBUG
+    if (g_once_init_enter (&engineChecked))
+    {
+        g_once_init_leave (&engineChecked, engineCheckKernels ());
+    } /* if */
+#endif
+
+    if (channels < 1)
+    {
+        return EINVAL;
+    } /* if */
+
+    pEngine = g_malloc0 (sizeof (FLTENGINE));
+
+    if (pEngine == NULL)
+    {
+        return ENOMEM;
+    } /* if */
+
+    if (type == FLTENGINE_AUTO)
+    {
+        if (pFilter->den.degree == 0)
+        {
+            type = (pFilter->num.degree + 1 >= filterConvCrossover ())
+                ? FLTENGINE_FFT : FLTENGINE_DIRECT;
+        } /* if */
+        else
+        {
+            type = (GSL_MAX_INT (pFilter->num.degree, pFilter->den.degree) > 2)
+                ? FLTENGINE_BIQUAD : FLTENGINE_DIRECT;
+        } /* else */
+    } /* if */
+
+    if ((type == FLTENGINE_BIQUAD) &&
+        ((pFilter->num.coeff[0] == 0.0) || (pFilter->den.coeff[0] == 0.0)))
+    {                       /* leading delay, roots of 1/z polynomial invalid */
+        DEBUG_LOG ("Filter engine falls back to direct form (leading delay)");
+        type = FLTENGINE_DIRECT;
+    } /* if */
+
+    pEngine->type = type;
+    pEngine->block = 1;
+    pEngine->channels = channels;
+
+    switch (type)
+    {
+        case FLTENGINE_FFT:
+            err = engineNewFft (pEngine, pFilter, block);
+            break;
+
+        case FLTENGINE_BIQUAD:
+            err = engineNewBiquad (pEngine, pFilter);
+            break;
+
+        case FLTENGINE_DIRECT:
+            err = engineNewDirect (pEngine, pFilter);
+            break;
+
+        default:
+            ASSERT (0);
+            err = EINVAL;
+    } /* switch */
+
+    if (err != 0)
+    {
+        DEBUG_LOG ("Filter engine %d failed (error %d)", type, err);
+        filterEngineFree (pEngine);
+        return err;
+    } /* if */
+
+    filterEngineReset (pEngine);
+    *ppEngine = pEngine;
+
+    return 0;
+} /* filterEngineNew() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Filters a sequence of (interleaved) sample frames. Input and output buffer
+ *  may be the same.
+ *
+ *  \param pEngine      Pointer to filter engine.
+ *  \param in           Input samples (\p n times \a channels elements).
+ *  \param out          Buffer which gets the output samples.
+ *  \param n            Number of frames (must be a multiple of \a block).
+ *
+ *  \return             Zero on success, else an error number (see errno.h or
+ *                      gsl_errno.h for predefined codes).
+ ******************************************************************************/
+int filterEngineProcess (FLTENGINE *pEngine, const double *in,
+                         double *out, int n)
+{
+    int i, k, deg;
+    double x, y, s1, s2;
+    const double *pIn;
+    FLTENGINE_SOS *pSos;
+
+    if (pEngine->channels > 1)
+    {
+        switch (pEngine->type)
+        {
+            case FLTENGINE_FFT:
+                return engineFftMulti (pEngine, in, out, n);
+
+            case FLTENGINE_BIQUAD:
+                engineBiquadMulti (pEngine, in, out, n);
+                return 0;
+
+            case FLTENGINE_DIRECT:
+                engineDirectMulti (pEngine, in, out, n);
+                return 0;
+
+            default:
+                ASSERT (0);
+                return EINVAL;
+        } /* switch */
+    } /* if */
+
+    switch (pEngine->type)                         /* single channel kernels */
+    {
+        case FLTENGINE_FFT:
+            return filterConvProcess (pEngine->ppConv[0], in, out, n);
+
+        case FLTENGINE_BIQUAD:           /* section by section (over block) */
+            pIn = in;
+
+            for (k = 0, pSos = pEngine->pSos; k < pEngine->degree; k++, pSos++)
+            {
+                s1 = pEngine->pState[2 * k];
+                s2 = pEngine->pState[2 * k + 1];
+
+                for (i = 0; i < n; i++)
+                {
+                    x = pIn[i];
+                    y = pSos->b0 * x + s1;
+                    s1 = pSos->b1 * x - pSos->a1 * y + s2;
+                    s2 = pSos->b2 * x - pSos->a2 * y;
+                    out[i] = y;
+                } /* for */
+
+                pEngine->pState[2 * k] = s1;
+                pEngine->pState[2 * k + 1] = s2;
+                pIn = out;                    /* next section works in-place */
+            } /* for */
+            break;
+
+        case FLTENGINE_DIRECT:
+            deg = pEngine->degree;
+
+            if ((deg > 0) && (deg <= FLTENGINE_UNROLL_MAX))   /* unrolled? */
+            {
+                engineDirectKernels[deg] (pEngine, in, out, n);
+            } /* if */
+            else
+            {
+                engineDirectGeneric (pEngine, in, out, n);
+            } /* else */
+            break;
+
+        default:
+            ASSERT (0);
+            return EINVAL;
+    } /* switch */
+
+    return 0;
+} /* filterEngineProcess() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Resets the filter state (all past samples are set to zero).
+ *
+ *  \param pEngine      Pointer to filter engine.
+ *
+ ******************************************************************************/
+void filterEngineReset (FLTENGINE *pEngine)
+{
+    int c;
+
+    switch (pEngine->type)
+    {
+        case FLTENGINE_FFT:
+            for (c = 0; c < pEngine->channels; c++)
+            {
+                filterConvReset (pEngine->ppConv[c]);
+            } /* for */
+            break;
+
+        case FLTENGINE_BIQUAD:
+            memset (pEngine->pState, 0,
+                    2 * pEngine->degree * pEngine->channels * sizeof(double));
+            break;
+
+        case FLTENGINE_DIRECT:
+            memset (pEngine->pState, 0,
+                    (pEngine->degree + 1) * pEngine->channels * sizeof(double));
+            break;
+
+        default:
+            ASSERT (0);
+    } /* switch */
+} /* filterEngineReset() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Free's a filter engine.
+ *
+ *  \param pEngine      Pointer to filter engine, formerly created by
+ *                      filterEngineNew().
+ *
+ ******************************************************************************/
+void filterEngineFree (FLTENGINE *pEngine)
+{
+    int c;
+
+    if (pEngine->ppConv != NULL)
+    {
+        for (c = 0; c < pEngine->channels; c++)
+        {
+            if (pEngine->ppConv[c] != NULL)
+            {
+                filterConvFree (pEngine->ppConv[c]);
+            } /* if */
+        } /* for */
+
+        g_free (pEngine->ppConv);
+    } /* if */
+
+    g_free (pEngine->pFrame);
+    g_free (pEngine->pNum);
+    g_free (pEngine->pSos);
+    g_free (pEngine->pState);
+    g_free (pEngine);
+} /* filterEngineFree() */
+
+
+
+/******************************************************************************/
+/* END OF FILE                                                                */
+/******************************************************************************/
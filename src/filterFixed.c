@@ -0,0 +1,608 @@
+/**
+ * \file        filterFixed.c
+ * \brief       Fixed-point (Q15/Q31) filter simulation.
+ * \copyright   Copyright (C) 2006-2022 Ralf Hoppe <dfcgen@rho62.de>
+ */
+
+
+/* INCLUDE FILES **************************************************************/
+
+#include "mathMisc.h"
+#include "filterSupport.h"
+#include "filterFixed.h"
+
+#include <errno.h>
+#include <string.h> /* memset(), memcpy() */
+
+
+/* GLOBAL CONSTANT DEFINITIONS ************************************************/
+
+
+/* GLOBAL VARIABLE DEFINITIONS ************************************************/
+
+
+/* LOCAL TYPE DECLARATIONS ****************************************************/
+
+
+/* LOCAL CONSTANT DEFINITIONS *************************************************/
+
+#define FLTFIXED_CHUNK          256 /**< Samples per chunk on format conversion */
+
+
+/* LOCAL VARIABLE DEFINITIONS *************************************************/
+
+
+/* LOCAL MACRO DEFINITIONS ****************************************************/
+
+
+/* MACRO **********************************************************************/
+/** Number of bits of a word in fixed-point format.
+ *
+ *  \param format       Fixed-point format (FLTFIXED_FORMAT).
+ *
+ ******************************************************************************/
+#define FLTFIXED_BITS(format)   (((format) == FLTFIXED_Q15) ? 16 : 32)
+
+
+/* MACRO **********************************************************************/
+/** Greatest (positive) value of a word in fixed-point format.
+ *
+ *  \param format       Fixed-point format (FLTFIXED_FORMAT).
+ *
+ ******************************************************************************/
+#define FLTFIXED_MAX(format)    \
+    ((gint64)((G_GUINT64_CONSTANT(1) << (FLTFIXED_BITS(format) - 1)) - 1))
+
+
+/* MACRO **********************************************************************/
+/** Shifts an accumulator \p acc right by \p shift bits, regarding the rounding
+ *  offsets \p half and \p odd (see fixedRoundOffsets()). There is no branch,
+ *  so the rounding mode costs nothing in the kernels.
+ *
+ *  \param acc          Accumulator value (gint64).
+ *  \param shift        Number of bits to shift.
+ *  \param half         Half of an LSB after shift (zero on truncation).
+ *  \param odd          One on convergent rounding, else zero.
+ *
+ ******************************************************************************/
+#define FLTFIXED_SHIFT(acc, shift, half, odd)                           \
+    (((acc) + (half) - (odd) + (((acc) >> (shift)) & (odd))) >> (shift))
+
+
+/* MACRO **********************************************************************/
+/** Saturates \p val to the range \f$[-max-1, max]\f$ and counts an overflow.
+ *
+ *  \param val          Value (gint64), which is saturated in place.
+ *  \param max          Greatest positive value.
+ *  \param count        Overflow counter (incremented on saturation).
+ *
+ ******************************************************************************/
+#define FLTFIXED_SATURATE(val, max, count)                              \
+    do                                                                  \
+    {                                                                   \
+        (count) += ((val) > (max)) | ((val) < -(max) - 1);              \
+        (val) = ((val) > (max)) ? (max) : (val);                        \
+        (val) = ((val) < -(max) - 1) ? -(max) - 1 : (val);              \
+    } while (0)
+
+
+/* LOCAL FUNCTION DECLARATIONS ************************************************/
+
+static void fixedRoundOffsets (FLTFIXED_ROUND rounding, int shift,
+                               gint64 *pHalf, gint64 *pOdd);
+static int fixedQuantize (FLTFIXED *pFixed, const FLTCOEFF *pFilter);
+static void fixedKernelQ15 (FLTFIXED *pFixed, gint32 *buf, int n);
+static void fixedKernelQ31 (FLTFIXED *pFixed, gint32 *buf, int n);
+static void fixedKernel (FLTFIXED *pFixed, gint32 *buf, int n);
+
+
+/* LOCAL FUNCTION DEFINITIONS *************************************************/
+
+
+/* FUNCTION *******************************************************************/
+/** Computes the offsets used by macro FLTFIXED_SHIFT() for a rounding mode.
+ *
+ *  \param rounding     Rounding mode.
+ *  \param shift        Number of bits to shift (may be zero).
+ *  \param pHalf        Pointer to buffer which gets half of an LSB after
+ *                      shift (zero on truncation).
+ *  \param pOdd         Pointer to buffer which gets one on convergent
+ *                      rounding, else zero.
+ *
+ ******************************************************************************/
+static void fixedRoundOffsets (FLTFIXED_ROUND rounding, int shift,
+                               gint64 *pHalf, gint64 *pOdd)
+{
+    *pHalf = *pOdd = 0;
+
+    if ((shift > 0) && (rounding != FLTFIXED_ROUND_TRUNC))
+    {
+        *pHalf = G_GINT64_CONSTANT(1) << (shift - 1);
+
+        if (rounding == FLTFIXED_ROUND_CONVERGENT)
+        {
+            *pOdd = 1;
+        } /* if */
+    } /* if */
+} /* fixedRoundOffsets() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Quantizes the filter coefficients. The coefficients are normalized to
+ *  \f$a_0=1\f$ and scaled by \f$2^{frac}\f$, where \a frac is the greatest
+ *  number of fractional bits which lets the largest coefficient fit into the
+ *  wordlength. Each coefficient is rounded to nearest. The quantized values
+ *  are stored in \a coeff too (as floating-point numbers).
+ *
+ *  \param pFixed       Pointer to fixed-point filter (\a format, \a taps and
+ *                      \a poles must be set).
+ *  \param pFilter      Pointer to filter coefficients.
+ *
+ *  \return             Zero on success, else an error number (see errno.h or
+ *                      gsl_errno.h for predefined codes).
+ ******************************************************************************/
+static int fixedQuantize (FLTFIXED *pFixed, const FLTCOEFF *pFilter)
+{
+    int i, exponent;
+    double a0, scale, val;
+
+    double cmax = 0.0;
+    gint64 wmax = FLTFIXED_MAX(pFixed->format);
+
+    a0 = pFilter->den.coeff[0];
+
+    if (a0 == 0.0)
+    {
+        return EDOM;
+    } /* if */
+
+    for (i = 0; i <= pFilter->num.degree; i++)
+    {
+        cmax = GSL_MAX_DBL (cmax, fabs (pFilter->num.coeff[i] / a0));
+    } /* for */
+
+    for (i = 1; i <= pFilter->den.degree; i++)
+    {
+        cmax = GSL_MAX_DBL (cmax, fabs (pFilter->den.coeff[i] / a0));
+    } /* for */
+
+    (void)frexp (cmax, &exponent);               /* cmax = m * 2^exponent */
+    pFixed->frac = FLTFIXED_BITS(pFixed->format) - 1 - GSL_MAX_INT (exponent, 0);
+
+    if (floor (ldexp (cmax, pFixed->frac) + 0.5) > wmax)    /* rounds up? */
+    {
+        --pFixed->frac;
+    } /* if */
+
+    if (pFixed->frac < pFixed->guard)   /* coefficients much greater than 1 */
+    {
+        return ERANGE;
+    } /* if */
+
+    scale = ldexp (1.0, pFixed->frac);
+
+    for (i = 0; i < pFixed->taps; i++)
+    {
+        val = floor (pFilter->num.coeff[i] / a0 * scale + 0.5);
+        pFixed->pNum[i] = (gint32) val;
+        pFixed->coeff.num.coeff[i] = val / scale;
+    } /* for */
+
+    pFixed->coeff.den.coeff[0] = 1.0;
+
+    for (i = 0; i < pFixed->poles; i++)
+    {
+        val = floor (pFilter->den.coeff[i + 1] / a0 * scale + 0.5);
+        pFixed->pDen[i] = (gint32) -val;          /* subtracted in kernels */
+        pFixed->coeff.den.coeff[i + 1] = val / scale;
+    } /* for */
+
+    return 0;
+} /* fixedQuantize() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Q15 kernel. Products of 16 bit words fit exactly into 32 bit, which are
+ *  summed up in a 64 bit accumulator. The history is held twice in linear
+ *  buffers, so that the sum of products runs over contiguous memory (without
+ *  wrap-around) and may be vectorized by the compiler.
+ *
+ *  \param pFixed       Pointer to fixed-point filter.
+ *  \param buf          Samples (in place), in the range of 16 bit words.
+ *  \param n            Number of samples.
+ *
+ ******************************************************************************/
+static void fixedKernelQ15 (FLTFIXED *pFixed, gint32 *buf, int n)
+{
+    int i, k;
+    gint64 acc, half, odd;
+    const gint32 *x, *y;
+
+    int taps = pFixed->taps;
+    int poles = pFixed->poles;
+    int shift = pFixed->frac;
+    gint64 wmax = FLTFIXED_MAX(FLTFIXED_Q15);
+    const gint32 *b = pFixed->pNum;
+    const gint32 *a = pFixed->pDen;
+
+    fixedRoundOffsets (pFixed->rounding, shift, &half, &odd);
+
+    for (i = 0; i < n; i++)
+    {
+        pFixed->posIn = (pFixed->posIn == 0) ? taps - 1 : pFixed->posIn - 1;
+        pFixed->pIn[pFixed->posIn] = pFixed->pIn[pFixed->posIn + taps] = buf[i];
+        x = &pFixed->pIn[pFixed->posIn];
+        y = &pFixed->pOut[pFixed->posOut];
+        acc = 0;
+
+        for (k = 0; k < taps; k++)
+        {
+            acc += b[k] * x[k];
+        } /* for */
+
+        for (k = 0; k < poles; k++)
+        {
+            acc += a[k] * y[k];
+        } /* for */
+
+        acc = FLTFIXED_SHIFT(acc, shift, half, odd);
+        FLTFIXED_SATURATE(acc, wmax, pFixed->overflows);
+        buf[i] = (gint32) acc;
+
+        if (poles > 0)
+        {
+            pFixed->posOut = (pFixed->posOut == 0) ? poles - 1 : pFixed->posOut - 1;
+            pFixed->pOut[pFixed->posOut] = pFixed->pOut[pFixed->posOut + poles] = buf[i];
+        } /* if */
+    } /* for */
+} /* fixedKernelQ15() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Q31 kernel. Products of 32 bit words need 64 bit, so each product is
+ *  shifted right by \a guard bits before it is summed up in the 64 bit
+ *  accumulator (which then cannot overflow). See fixedKernelQ15() for the
+ *  history buffers.
+ *
+ *  \param pFixed       Pointer to fixed-point filter.
+ *  \param buf          Samples (in place).
+ *  \param n            Number of samples.
+ *
+ ******************************************************************************/
+static void fixedKernelQ31 (FLTFIXED *pFixed, gint32 *buf, int n)
+{
+    int i, k;
+    gint64 acc, half, odd;
+    const gint32 *x, *y;
+
+    int taps = pFixed->taps;
+    int poles = pFixed->poles;
+    int guard = pFixed->guard;
+    int shift = pFixed->frac - guard;
+    gint64 wmax = FLTFIXED_MAX(FLTFIXED_Q31);
+    const gint32 *b = pFixed->pNum;
+    const gint32 *a = pFixed->pDen;
+
+    fixedRoundOffsets (pFixed->rounding, shift, &half, &odd);
+
+    for (i = 0; i < n; i++)
+    {
+        pFixed->posIn = (pFixed->posIn == 0) ? taps - 1 : pFixed->posIn - 1;
+        pFixed->pIn[pFixed->posIn] = pFixed->pIn[pFixed->posIn + taps] = buf[i];
+        x = &pFixed->pIn[pFixed->posIn];
+        y = &pFixed->pOut[pFixed->posOut];
+        acc = 0;
+
+        for (k = 0; k < taps; k++)
+        {
+            acc += ((gint64)b[k] * x[k]) >> guard;
+        } /* for */
+
+        for (k = 0; k < poles; k++)
+        {
+            acc += ((gint64)a[k] * y[k]) >> guard;
+        } /* for */
+
+        acc = FLTFIXED_SHIFT(acc, shift, half, odd);
+        FLTFIXED_SATURATE(acc, wmax, pFixed->overflows);
+        buf[i] = (gint32) acc;
+
+        if (poles > 0)
+        {
+            pFixed->posOut = (pFixed->posOut == 0) ? poles - 1 : pFixed->posOut - 1;
+            pFixed->pOut[pFixed->posOut] = pFixed->pOut[pFixed->posOut + poles] = buf[i];
+        } /* if */
+    } /* for */
+} /* fixedKernelQ31() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Filters a sequence of samples by the kernel associated with the format.
+ *
+ *  \param pFixed       Pointer to fixed-point filter.
+ *  \param buf          Samples (in place).
+ *  \param n            Number of samples.
+ *
+ ******************************************************************************/
+static void fixedKernel (FLTFIXED *pFixed, gint32 *buf, int n)
+{
+    if (pFixed->format == FLTFIXED_Q15)
+    {
+        fixedKernelQ15 (pFixed, buf, n);
+    } /* if */
+    else
+    {
+        fixedKernelQ31 (pFixed, buf, n);
+    } /* else */
+} /* fixedKernel() */
+
+
+
+/* EXPORTED FUNCTION DEFINITIONS **********************************************/
+
+
+/* FUNCTION *******************************************************************/
+/** Creates a fixed-point filter by quantization of filter coefficients.
+ *
+ *  \param pFilter      Pointer to filter coefficients.
+ *  \param format       Fixed-point format.
+ *  \param rounding     Rounding mode.
+ *  \param ppFixed      Pointer to a buffer which gets the pointer to the new
+ *                      fixed-point filter (NULL on error).
+ *
+ *  \return             Zero on success, else an error number (see errno.h or
+ *                      gsl_errno.h for predefined codes).
+ ******************************************************************************/
+int filterFixedNew (const FLTCOEFF *pFilter, FLTFIXED_FORMAT format,
+                    FLTFIXED_ROUND rounding, FLTFIXED **ppFixed)
+{
+    int err, size;
+    FLTFIXED *pFixed;
+
+    *ppFixed = NULL;
+
+    if ((format >= FLTFIXED_SIZE) || (rounding >= FLTFIXED_ROUND_SIZE))
+    {
+        return EINVAL;
+    } /* if */
+
+    pFixed = g_malloc0 (sizeof (FLTFIXED));
+
+    if (pFixed == NULL)
+    {
+        return ENOMEM;
+    } /* if */
+
+    pFixed->format = format;
+    pFixed->rounding = rounding;
+    pFixed->taps = pFilter->num.degree + 1;
+    pFixed->poles = pFilter->den.degree;
+    size = pFixed->taps + pFixed->poles;
+
+    if (format == FLTFIXED_Q31) /* guard bits for sum of size products */
+    {
+        while ((1 << pFixed->guard) < size)
+        {
+            ++pFixed->guard;
+        } /* while */
+    } /* if */
+
+    pFixed->coeff.f0 = pFilter->f0;
+    pFixed->coeff.factor = 0.0;                    /* roots are not valid */
+    pFixed->coeff.num.degree = pFilter->num.degree;
+    pFixed->coeff.den.degree = pFilter->den.degree;
+
+    err = filterMalloc (&pFixed->coeff);
+
+    if (err != 0)
+    {
+        g_free (pFixed);
+        return err;
+    } /* if */
+
+    pFixed->pNum = g_malloc (size * sizeof(pFixed->pNum[0]));
+    pFixed->pIn = g_malloc (2 * size * sizeof(pFixed->pIn[0]));
+
+    if ((pFixed->pNum == NULL) || (pFixed->pIn == NULL))
+    {
+        filterFixedFree (pFixed);
+        return ENOMEM;
+    } /* if */
+
+    pFixed->pDen = pFixed->pNum + pFixed->taps;
+    pFixed->pOut = pFixed->pIn + 2 * pFixed->taps;
+
+    err = fixedQuantize (pFixed, pFilter);
+
+    if (err != 0)
+    {
+        DEBUG_LOG ("Fixed-point quantization failed (error %d)", err);
+        filterFixedFree (pFixed);
+        return err;
+    } /* if */
+
+    filterFixedReset (pFixed);
+    *ppFixed = pFixed;
+
+    return 0;
+} /* filterFixedNew() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Filters a sequence of Q15 samples.
+ *
+ *  \param pFixed       Pointer to fixed-point filter (format FLTFIXED_Q15).
+ *  \param in           Input samples.
+ *  \param out          Buffer which gets the output samples (may be the
+ *                      same as \p in).
+ *  \param n            Number of samples.
+ *
+ ******************************************************************************/
+void filterFixedProcessQ15 (FLTFIXED *pFixed, const gint16 *in,
+                            gint16 *out, int n)
+{
+    int i, len;
+    gint32 buf[FLTFIXED_CHUNK];
+
+    ASSERT (pFixed->format == FLTFIXED_Q15);
+
+    while (n > 0)
+    {
+        len = GSL_MIN_INT (n, FLTFIXED_CHUNK);
+
+        for (i = 0; i < len; i++)
+        {
+            buf[i] = in[i];
+        } /* for */
+
+        fixedKernelQ15 (pFixed, buf, len);
+
+        for (i = 0; i < len; i++)
+        {
+            out[i] = (gint16) buf[i];
+        } /* for */
+
+        in += len;
+        out += len;
+        n -= len;
+    } /* while */
+} /* filterFixedProcessQ15() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Filters a sequence of Q31 samples.
+ *
+ *  \param pFixed       Pointer to fixed-point filter (format FLTFIXED_Q31).
+ *  \param in           Input samples.
+ *  \param out          Buffer which gets the output samples (may be the
+ *                      same as \p in).
+ *  \param n            Number of samples.
+ *
+ ******************************************************************************/
+void filterFixedProcessQ31 (FLTFIXED *pFixed, const gint32 *in,
+                            gint32 *out, int n)
+{
+    ASSERT (pFixed->format == FLTFIXED_Q31);
+
+    if (out != in)
+    {
+        memmove (out, in, n * sizeof(out[0]));
+    } /* if */
+
+    fixedKernelQ31 (pFixed, out, n);
+} /* filterFixedProcessQ31() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Filters a sequence of floating-point samples. The input samples are
+ *  quantized (with the rounding mode of the filter and saturation) to the
+ *  fixed-point format, filtered and converted back.
+ *
+ *  \param pFixed       Pointer to fixed-point filter.
+ *  \param in           Input samples (full scale is \f$\pm 1\f$).
+ *  \param out          Buffer which gets the output samples (may be the
+ *                      same as \p in).
+ *  \param n            Number of samples.
+ *
+ ******************************************************************************/
+void filterFixedProcess (FLTFIXED *pFixed, const double *in,
+                         double *out, int n)
+{
+    int i, len;
+    double val;
+    gint64 word;
+    gint32 buf[FLTFIXED_CHUNK];
+
+    gint64 wmax = FLTFIXED_MAX(pFixed->format);
+    double scale = ldexp (1.0, FLTFIXED_BITS(pFixed->format) - 1);
+
+    while (n > 0)
+    {
+        len = GSL_MIN_INT (n, FLTFIXED_CHUNK);
+
+        for (i = 0; i < len; i++)
+        {
+            val = GSL_MAX_DBL (GSL_MIN_DBL (in[i] * scale, scale), -scale - 1.0);
+
+            switch (pFixed->rounding)
+            {
+                case FLTFIXED_ROUND_TRUNC:
+                    val = floor (val);
+                    break;
+
+                case FLTFIXED_ROUND_NEAREST:
+                    val = floor (val + 0.5);
+                    break;
+
+                case FLTFIXED_ROUND_CONVERGENT:        /* default FPU mode */
+                    val = rint (val);
+                    break;
+
+                default:
+                    ASSERT (0);
+            } /* switch */
+
+            word = (gint64) val;
+            FLTFIXED_SATURATE(word, wmax, pFixed->overflows);
+            buf[i] = (gint32) word;
+        } /* for */
+
+        fixedKernel (pFixed, buf, len);
+
+        for (i = 0; i < len; i++)
+        {
+            out[i] = buf[i] / scale;
+        } /* for */
+
+        in += len;
+        out += len;
+        n -= len;
+    } /* while */
+} /* filterFixedProcess() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Resets the filter state (all past samples are set to zero) and the
+ *  overflow counter.
+ *
+ *  \param pFixed       Pointer to fixed-point filter.
+ *
+ ******************************************************************************/
+void filterFixedReset (FLTFIXED *pFixed)
+{
+    memset (pFixed->pIn, 0,
+            2 * (pFixed->taps + pFixed->poles) * sizeof(pFixed->pIn[0]));
+    pFixed->posIn = pFixed->posOut = 0;
+    pFixed->overflows = 0;
+} /* filterFixedReset() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Free's a fixed-point filter.
+ *
+ *  \param pFixed       Pointer to fixed-point filter, formerly created by
+ *                      filterFixedNew().
+ *
+ ******************************************************************************/
+void filterFixedFree (FLTFIXED *pFixed)
+{
+    filterFree (&pFixed->coeff);
+    g_free (pFixed->pNum);
+    g_free (pFixed->pIn);
+    g_free (pFixed);
+} /* filterFixedFree() */
+
+
+
+/******************************************************************************/
+/* END OF FILE                                                                */
+/******************************************************************************/
@@ -0,0 +1,608 @@
+/**
+ * \file        filterRemez.c
+ * \brief       Equiripple (Parks-McClellan) design of linear phase FIR filters
+ *              by Remez exchange.
+ * \copyright   Copyright (C) 2006-2022 Ralf Hoppe <dfcgen@rho62.de>
+ */
+
+
+/* INCLUDE FILES **************************************************************/
+
+#include "filterRemez.h"
+
+#include <string.h> /* memcpy(), memmove() */
+#include <limits.h> /* INT_MIN */
+
+
+/* GLOBAL CONSTANT DEFINITIONS ************************************************/
+
+
+/* GLOBAL VARIABLE DEFINITIONS ************************************************/
+
+
+/* LOCAL TYPE DECLARATIONS ****************************************************/
+
+/** Workspace of the Remez exchange. The approximating function is a
+ *  polynomial \f$P(x)\f$ of degree \a r - 1 in \f$x=\cos 2\pi f\f$, which is
+ *  represented by its values at the \a r + 1 points of the extremal set
+ *  (barycentric \e Lagrange interpolation). So the evaluation on the grid
+ *  needs no trigonometric functions at all.
+ */
+typedef struct
+{
+    int r;                 /**< Number of cosine functions (approximation) */
+    int grid;                                  /**< Number of grid points */
+    int bands;                                         /**< Number of bands */
+    double delta;                           /**< Current deviation (signed) */
+    double *x;                   /**< Grid points \f$x=\cos 2\pi f\f$ */
+    double *des;                        /**< Desired function on grid */
+    double *wt;                          /**< Weight function on grid */
+    double *err;                      /**< Weighted error on grid */
+    double *xe;          /**< Abscissas of the extremal set (\a r + 1) */
+    double *ad;   /**< Barycentric weights of the extremal set (\a r + 1) */
+    double *y;                  /**< Interpolation values (\a r + 1) */
+    int *ext;               /**< Grid indices of extremal set (\a r + 1) */
+    int *expo;        /**< Binary exponents of weights (\a r + 1, scratch) */
+    int *cand;                /**< Candidates for the next extremal set */
+    int *first;        /**< First grid index of each band (\a bands + 1) */
+} FLTREMEZ_WORK;
+
+
+/* LOCAL CONSTANT DEFINITIONS *************************************************/
+
+#define FLTREMEZ_DENSITY        16      /**< Grid points per extremal point */
+#define FLTREMEZ_MAXITER        40          /**< Maximum number of exchanges */
+#define FLTREMEZ_EPSILON        1E-6 /**< Relative tolerance of convergence */
+#define FLTREMEZ_TOLERANCE      1E-2 /**< Accepted tolerance (no convergence) */
+
+
+/* LOCAL VARIABLE DEFINITIONS *************************************************/
+
+
+/* LOCAL MACRO DEFINITIONS ****************************************************/
+
+
+/* LOCAL FUNCTION DECLARATIONS ************************************************/
+
+static int remezGrid (FLTREMEZ_WORK *pWork, const FLTREMEZ_BAND band[],
+                      double delf, BOOL typeII);
+static void remezWeights (const double x[], int n, double w[], int expo[]);
+static void remezInterpolate (FLTREMEZ_WORK *pWork);
+static double remezEval (const FLTREMEZ_WORK *pWork, double x);
+static double remezError (FLTREMEZ_WORK *pWork);
+static int remezExtremals (FLTREMEZ_WORK *pWork);
+
+
+/* LOCAL FUNCTION DEFINITIONS *************************************************/
+
+
+/* FUNCTION *******************************************************************/
+/** Sets up the dense frequency grid. Every band gets (at least one) equally
+ *  spaced grid points, including its edges. For filters of type II the
+ *  approximation problem is transformed by \f$Q(f)=\cos\pi f\f$ (desired
+ *  function divided, weight multiplied), and grid points at \f$f_0/2\f$ are
+ *  omitted (because of the zero there).
+ *
+ *  \param pWork        Pointer to workspace. If \p pWork->x is NULL, then the
+ *                      grid points are only counted.
+ *  \param band         Array of \p pWork->bands bands.
+ *  \param delf         Grid spacing.
+ *  \param typeII       TRUE for filters of type II (odd degree).
+ *
+ *  \return             Number of grid points.
+ ******************************************************************************/
+static int remezGrid (FLTREMEZ_WORK *pWork, const FLTREMEZ_BAND band[],
+                      double delf, BOOL typeII)
+{
+    int i, b, points;
+    double f, upper, q;
+
+    int grid = 0;
+
+    for (b = 0; b < pWork->bands; b++)
+    {
+        upper = band[b].upper;
+
+        if (typeII && (upper > 0.5 - delf))
+        {
+            upper = GSL_MAX_DBL (band[b].lower, 0.5 - delf);
+        } /* if */
+
+        points = 1 + (int) ((upper - band[b].lower) / delf + 0.5);
+
+        if (pWork->x != NULL)
+        {
+            pWork->first[b] = grid;
+
+            for (i = 0; i < points; i++)
+            {
+                f = band[b].lower;
+
+                if (points > 1)
+                {
+                    f += i * (upper - band[b].lower) / (points - 1);
+                } /* if */
+
+                q = typeII ? cos (M_PI * f) : 1.0;
+                pWork->x[grid + i] = cos (2.0 * M_PI * f);
+                pWork->des[grid + i] = band[b].gain / q;
+                pWork->wt[grid + i] = band[b].weight * q;
+            } /* for */
+        } /* if */
+
+        grid += points;
+    } /* for */
+
+    if (pWork->x != NULL)
+    {
+        pWork->first[pWork->bands] = grid;
+    } /* if */
+
+    return grid;
+} /* remezGrid() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Computes the barycentric weights
+    \f[
+    w_k=\prod_{j\neq k}\frac{1}{2(x_k-x_j)}
+    \f]
+ *  of a set of points. The products easily leave the range of double
+ *  precision numbers for some hundred points (clustered at the band edges),
+ *  therefore mantissa and binary exponent are accumulated separately. The
+ *  weights are returned scaled by a common factor, which cancels out in all
+ *  barycentric formulas.
+ *
+ *  \param x            Array of \p n (distinct) points.
+ *  \param n            Number of points.
+ *  \param w            Array of \p n elements, which gets the (scaled) weights.
+ *  \param expo         Workspace of \p n elements.
+ *
+ ******************************************************************************/
+static void remezWeights (const double x[], int n, double w[], int expo[])
+{
+    int j, k, e;
+    double prod;
+
+    int maxexp = INT_MIN;
+
+    for (k = 0; k < n; k++)
+    {
+        prod = 1.0;
+        expo[k] = 0;
+
+        for (j = 0; j < n; j++)
+        {
+            if (j != k)
+            {
+                prod = frexp (prod * 2.0 * (x[k] - x[j]), &e);
+                expo[k] -= e;
+            } /* if */
+        } /* for */
+
+        w[k] = 1.0 / prod;
+        maxexp = GSL_MAX_INT (maxexp, expo[k]);
+    } /* for */
+
+    for (k = 0; k < n; k++)                    /* apply the common scaling */
+    {
+        w[k] = ldexp (w[k], expo[k] - maxexp);
+    } /* for */
+} /* remezWeights() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Solves the interpolation problem on the current extremal set. The
+ *  deviation \f$\delta\f$ follows from the condition that the divided
+ *  difference of order \f$r\f$ of \f$P(x)\f$ vanishes:
+    \f[
+    \delta=\frac{\sum_k a_k D(x_k)}{\sum_k a_k (-1)^k/W(x_k)}
+    \f]
+ *  Then \f$P(x)\f$ is represented by the values
+ *  \f$y_k=D(x_k)-(-1)^k\delta/W(x_k)\f$ at all \f$r+1\f$ points. They lie
+ *  on a polynomial of degree \f$r-1\f$, but interpolating through all of
+ *  them (instead of \f$r\f$ only) avoids an extrapolation to the outermost
+ *  point, which is numerically unstable for higher degrees.
+ *
+ *  \param pWork        Pointer to workspace.
+ *
+ ******************************************************************************/
+static void remezInterpolate (FLTREMEZ_WORK *pWork)
+{
+    int k, idx;
+
+    double num = 0.0, den = 0.0, sign = 1.0;
+    int r = pWork->r;
+
+    for (k = 0; k <= r; k++)
+    {
+        pWork->xe[k] = pWork->x[pWork->ext[k]];
+    } /* for */
+
+    remezWeights (pWork->xe, r + 1, pWork->ad, pWork->expo);
+
+    for (k = 0; k <= r; k++)
+    {
+        idx = pWork->ext[k];
+        num += pWork->ad[k] * pWork->des[idx];
+        den += sign * pWork->ad[k] / pWork->wt[idx];
+        sign = -sign;
+    } /* for */
+
+    pWork->delta = num / den;
+    sign = 1.0;
+
+    for (k = 0; k <= r; k++)
+    {
+        idx = pWork->ext[k];
+        pWork->y[k] = pWork->des[idx] - sign * pWork->delta / pWork->wt[idx];
+        sign = -sign;
+    } /* for */
+
+} /* remezInterpolate() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Evaluates the approximating polynomial \f$P(x)\f$ by the barycentric
+ *  formula
+    \f[
+    P(x)=\frac{\sum_k a_k y_k/(x-x_k)}{\sum_k a_k/(x-x_k)}
+    \f]
+ *
+ *  \param pWork        Pointer to workspace.
+ *  \param x            Argument \f$x=\cos 2\pi f\f$.
+ *
+ *  \return             Value \f$P(x)\f$.
+ ******************************************************************************/
+static double remezEval (const FLTREMEZ_WORK *pWork, double x)
+{
+    int k;
+    double tmp;
+
+    double num = 0.0, den = 0.0;
+
+    for (k = 0; k <= pWork->r; k++)
+    {
+        tmp = x - pWork->xe[k];
+
+        if (tmp == 0.0)                                /* interpolation point */
+        {
+            return pWork->y[k];
+        } /* if */
+
+        tmp = pWork->ad[k] / tmp;
+        num += tmp * pWork->y[k];
+        den += tmp;
+    } /* for */
+
+    return num / den;
+} /* remezEval() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Computes the weighted error \f$E=W(D-P)\f$ on the whole grid.
+ *
+ *  \param pWork        Pointer to workspace.
+ *
+ *  \return             Maximum of \f$|E|\f$.
+ ******************************************************************************/
+static double remezError (FLTREMEZ_WORK *pWork)
+{
+    int i;
+
+    double maxerr = 0.0;
+
+    for (i = 0; i < pWork->grid; i++)
+    {
+        pWork->err[i] = pWork->wt[i] * (pWork->des[i] - remezEval (pWork, pWork->x[i]));
+        maxerr = GSL_MAX_DBL (maxerr, fabs (pWork->err[i]));
+    } /* for */
+
+    return maxerr;
+} /* remezError() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Searches the next extremal set. All local extrema of the error in each
+ *  band with a magnitude not less than \f$|\delta|\f$ become candidates.
+ *  Neighbours of same sign are merged (keeping the greater one), then
+ *  surplus candidates are removed (smallest magnitude first) such that the
+ *  alternation is kept. If there are too few of them (may happen in the
+ *  first iterations of high degree designs), the largest gaps are filled up
+ *  with grid points.
+ *
+ *  \param pWork        Pointer to workspace.
+ *
+ *  \return             Number of points in the new extremal set. If it is
+ *                      \p pWork->r + 1, then \p pWork->ext is updated.
+ ******************************************************************************/
+static int remezExtremals (FLTREMEZ_WORK *pWork)
+{
+    int i, b, k, small, last;
+    double e;
+    BOOL peak;
+
+    int count = 0;
+    int *cand = pWork->cand;
+    double *err = pWork->err;
+    double limit = fabs (pWork->delta) * (1.0 - FLTREMEZ_EPSILON);
+
+    for (b = 0; b < pWork->bands; b++)
+    {
+        last = pWork->first[b + 1] - 1;
+
+        for (i = pWork->first[b]; i <= last; i++)
+        {
+            e = err[i];
+
+            if (e >= 0.0)
+            {
+                peak = ((i == pWork->first[b]) || (e >= err[i - 1])) &&
+                       ((i == last) || (e > err[i + 1]));
+            } /* if */
+            else
+            {
+                peak = ((i == pWork->first[b]) || (e <= err[i - 1])) &&
+                       ((i == last) || (e < err[i + 1]));
+            } /* else */
+
+            if (peak && (fabs (e) >= limit))
+            {
+                if ((count > 0) &&                 /* same sign as before? */
+                    ((e >= 0.0) == (err[cand[count - 1]] >= 0.0)))
+                {
+                    if (fabs (e) > fabs (err[cand[count - 1]]))
+                    {
+                        cand[count - 1] = i;
+                    } /* if */
+                } /* if */
+                else
+                {
+                    cand[count++] = i;
+                } /* else */
+            } /* if */
+        } /* for */
+    } /* for */
+
+    while (count > pWork->r + 1)                       /* remove surplus */
+    {
+        small = 0;
+
+        for (k = 1; k < count; k++)
+        {
+            if (fabs (err[cand[k]]) < fabs (err[cand[small]]))
+            {
+                small = k;
+            } /* if */
+        } /* for */
+
+        if ((small > 0) && (small < count - 1))
+        {
+            if (count == pWork->r + 2)     /* only one to remove: take an end */
+            {
+                small = (fabs (err[cand[0]]) < fabs (err[cand[count - 1]]))
+                    ? 0 : count - 1;
+            } /* if */
+            else           /* remove inner one, then merge its neighbours */
+            {
+                memmove (&cand[small], &cand[small + 1],
+                         (count - small - 1) * sizeof(cand[0]));
+                --count;
+
+                if (fabs (err[cand[small - 1]]) < fabs (err[cand[small]]))
+                {
+                    --small;
+                } /* if */
+            } /* else */
+        } /* if */
+
+        memmove (&cand[small], &cand[small + 1],
+                 (count - small - 1) * sizeof(cand[0]));
+        --count;
+    } /* while */
+
+    while ((count > 0) && (count < pWork->r + 1)) /* fill the largest gaps */
+    {
+        small = -1;                        /* means gap in front of cand[0] */
+        last = cand[0] - pWork->first[0];             /* length of the gap */
+
+        for (k = 0; k < count; k++)
+        {
+            i = ((k < count - 1) ? cand[k + 1] : pWork->grid) - cand[k];
+
+            if (i > last)
+            {
+                last = i;
+                small = k;
+            } /* if */
+        } /* for */
+
+        if (last < 2)                        /* no more grid points free */
+        {
+            break;
+        } /* if */
+
+        i = (small < 0) ? 0 : cand[small] + last / 2;
+        memmove (&cand[small + 2], &cand[small + 1],
+                 (count - small - 1) * sizeof(cand[0]));
+        cand[small + 1] = i;
+        ++count;
+    } /* while */
+
+    if (count == pWork->r + 1)
+    {
+        memcpy (pWork->ext, cand, count * sizeof(cand[0]));
+    } /* if */
+
+    return count;
+} /* remezExtremals() */
+
+
+
+/* EXPORTED FUNCTION DEFINITIONS **********************************************/
+
+
+/* FUNCTION *******************************************************************/
+/** Designs a linear phase FIR filter with minimum (weighted) Chebyshev error
+ *  in the given bands by the \e Parks-McClellan algorithm. Even degrees
+ *  result in a symmetric filter of type I, odd degrees in type II (which
+ *  forces a zero at \f$f_0/2\f$).
+ *
+ *  \param degree       Degree of filter (number of coefficients minus one).
+ *  \param bands        Number of bands.
+ *  \param band         Array of \p bands non-overlapping bands in ascending
+ *                      order.
+ *  \param coeff        Array of \p degree + 1 elements, which gets the
+ *                      (symmetric) filter coefficients.
+ *  \param pDelta       Pointer to buffer which gets the weighted deviation
+ *                      \f$\delta\f$ of the design (may be NULL). The
+ *                      deviation in band \e i is \f$\delta/w_i\f$.
+ *
+ *  \return             Zero on success, else an error number (see errno.h or
+ *                      gsl_errno.h for predefined codes).
+ ******************************************************************************/
+int filterRemez (int degree, int bands, const FLTREMEZ_BAND band[],
+                 double coeff[], double *pDelta)
+{
+    FLTREMEZ_WORK work;
+    int i, m, idx, iter, taps, half;
+    double maxerr, sum, delf, *pCos;
+    void *pMem;
+
+    BOOL typeII = GSL_IS_ODD (degree);
+
+    if ((degree < 1) || (bands < 1))
+    {
+        return GSL_EDOM;
+    } /* if */
+
+    for (i = 0, delf = 0.0; i < bands; i++)                 /* check bands */
+    {
+        if ((band[i].lower < ((i > 0) ? band[i - 1].upper : 0.0)) ||
+            (band[i].upper < band[i].lower) || (band[i].upper > 0.5) ||
+            (band[i].weight <= 0.0))
+        {
+            return GSL_EDOM;
+        } /* if */
+
+        delf += band[i].upper - band[i].lower;            /* total width */
+    } /* for */
+
+    if (delf <= 0.0)
+    {
+        return GSL_EDOM;
+    } /* if */
+
+    work.r = typeII ? (degree + 1) / 2 : degree / 2 + 1;
+    work.bands = bands;
+    work.x = NULL;
+    delf /= FLTREMEZ_DENSITY * work.r;                   /* grid spacing */
+    work.grid = remezGrid (&work, band, delf, typeII);
+
+    if (work.grid < work.r + 1)
+    {
+        return GSL_EDOM;
+    } /* if */
+
+    taps = degree + 1;
+    pMem = g_malloc ((4 * work.grid + 3 * (work.r + 1) + 2 * taps) * sizeof(double)
+                     + (2 * (work.r + 1) + work.grid + bands + 1) * sizeof(int));
+
+    if (pMem == NULL)
+    {
+        return ENOMEM;
+    } /* if */
+
+    work.x = pMem;
+    work.des = work.x + work.grid;
+    work.wt = work.des + work.grid;
+    work.err = work.wt + work.grid;
+    work.xe = work.err + work.grid;
+    work.ad = work.xe + work.r + 1;
+    work.y = work.ad + work.r + 1;
+    pCos = work.y + work.r + 1;
+    work.ext = (int *) (pCos + 2 * taps);
+    work.expo = work.ext + work.r + 1;
+    work.cand = work.expo + work.r + 1;
+    work.first = work.cand + work.grid;
+
+    (void) remezGrid (&work, band, delf, typeII);
+
+    for (i = 0; i <= work.r; i++)        /* initial guess: equally spaced */
+    {
+        work.ext[i] = (int) ((double) i * (work.grid - 1) / work.r);
+    } /* for */
+
+    for (iter = 0; iter < FLTREMEZ_MAXITER; iter++)
+    {
+        remezInterpolate (&work);
+        maxerr = remezError (&work);
+
+        if ((maxerr - fabs (work.delta) <= FLTREMEZ_EPSILON * maxerr) ||
+            (remezExtremals (&work) != work.r + 1))
+        {
+            break;
+        } /* if */
+    } /* for */
+
+    if (maxerr - fabs (work.delta) > FLTREMEZ_TOLERANCE * maxerr)
+    {
+        DEBUG_LOG ("Remez exchange has not converged");
+        g_free (pMem);
+
+        return GSL_EMAXITER;
+    } /* if */
+
+    /* The coefficients follow from samples of the amplitude response
+     * A(f)=Q(f)P(cos 2pi f) at f=m/taps by an inverse DFT (symmetric).
+     */
+    for (i = 0; i < 2 * taps; i++)
+    {
+        pCos[i] = cos (M_PI * i / taps);
+    } /* for */
+
+    half = (taps - 1) / 2;
+
+    for (m = 0; m <= half; m++)               /* samples (in error array) */
+    {
+        work.err[m] = remezEval (&work, pCos[2 * m]);
+
+        if (typeII)
+        {
+            work.err[m] *= pCos[m];
+        } /* if */
+    } /* for */
+
+    for (i = 0; i <= degree / 2; i++)
+    {
+        sum = work.err[0];
+
+        for (m = 1; m <= half; m++)
+        {
+            idx = (m * (2 * i - degree)) % (2 * taps);
+            sum += 2.0 * work.err[m] * pCos[(idx < 0) ? idx + 2 * taps : idx];
+        } /* for */
+
+        coeff[i] = coeff[degree - i] = sum / taps;
+    } /* for */
+
+    if (pDelta != NULL)
+    {
+        *pDelta = fabs (work.delta);
+    } /* if */
+
+    g_free (pMem);
+
+    return 0;
+} /* filterRemez() */
+
+
+
+/******************************************************************************/
+/* END OF FILE                                                                */
+/******************************************************************************/
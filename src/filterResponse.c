@@ -10,7 +10,7 @@
 #include "mathMisc.h"
 #include "filterResponse.h"
 
-#include <string.h> /* memset() */
+#include <string.h> /* memset(), memcpy() */
 
 
 /* GLOBAL CONSTANT DEFINITIONS ************************************************/
@@ -25,6 +25,9 @@
 /* LOCAL CONSTANT DEFINITIONS *************************************************/
 
 #define FLTRESP_TIME_SAMPLES_LIMIT      2048   /**< Maximum number of samples */
+#define FLTRESP_SIGNAL_CHUNK            4096 /**< User signal samples per chunk */
+#define FLTRESP_SIGNAL_SETTLE           32768   /**< Settling on user signals */
+#define FLTRESP_TIME_CHUNK              256   /**< Samples per chunk (others) */
 
 
 /* LOCAL VARIABLE DEFINITIONS *************************************************/
@@ -61,11 +64,20 @@
 
 /* LOCAL FUNCTION DECLARATIONS ************************************************/
 
-static gsl_complex evalPolyZ(double omega, const MATHPOLY *poly);
+static void evalPolyZ(double omega, const MATHPOLY *poly,
+                      double *pRe, double *pIm);
 static double evalPolyAngleZ(double omega, const MATHPOLY *poly);
 static double evalPolyGroupZ(double omega, const MATHPOLY *poly);
-static double timeResponseGetNext (double time, FLTSIGNAL sig);
+static double timeResponseGetNext (FLTRESP_TIME_WORKSPACE *pWorkspace);
 static double timeResponseProcNext (FLTRESP_TIME_WORKSPACE *pWorkspace);
+static int timeResponseFrameNext (FLTRESP_TIME_WORKSPACE *pWorkspace,
+                                  double *frame);
+static FLTRESP_TIME_WORKSPACE* timeResponseNew (double start, double stop,
+                                                FLTSIGNAL type,
+                                                FLTSIGNAL_SOURCE *pSource,
+                                                BOOL frames,
+                                                const FLTCOEFF* pFilter,
+                                                FLTFIXED *pFixed);
 
 
 /* LOCAL FUNCTION DEFINITIONS *************************************************/
@@ -75,40 +87,50 @@ static double timeResponseProcNext (FLTRESP_TIME_WORKSPACE *pWorkspace);
 /** Evaluates complex magnitude associated with a polynomial in \e Z domain.
  *  The function returns the complex magnitude of the numerator or denominator
  *  polynomial of a time-discrete system at the circular frequency
- *  \f$\omega=2\pi f/f_0\f$. The calculation is performed by the following
- *  algorithm:
+ *  \f$\omega=2\pi f/f_0\f$. The polynomial is split into even and odd
+ *  coefficients, which are evaluated by two independent \e Horner chains in
+ *  \f$w=z^{-2}\f$ (real and imaginary part held in separate variables):
     \f{eqnarray*}
         H(z) &=& a_0+a_1 z^{-1}+a_2 z^{-2}+\cdots a_n z^{-n} \\ 
-             &=& (\cdots((a_n z^{-1}+a_{n-1}) z^{-1}+a_{n-2})z^{-1}+\cdots+a_0
+             &=& (a_0+a_2 w+a_4 w^2+\cdots)+z^{-1}(a_1+a_3 w+a_5 w^2+\cdots)
     \f}
- *  with \f$z^{-1}=\exp(-j\omega)\f$.
+ *  with \f$z^{-1}=\exp(-j\omega)\f$. Both chains do not depend on each
+ *  other, which halves the length of the dependency chain of the loop.
  *
  *  \param omega        Angular frequency in rad/s.
  *  \param poly         Pointer to polynomial coefficients in \e Z domain.
+ *  \param pRe          Pointer to buffer which gets the real part.
+ *  \param pIm          Pointer to buffer which gets the imaginary part.
  *
- *  \return
  ******************************************************************************/
-static gsl_complex evalPolyZ(double omega, const MATHPOLY *poly)
+static void evalPolyZ(double omega, const MATHPOLY *poly,
+                      double *pRe, double *pIm)
 {
-    gsl_complex result;
-    double *pCoeff;
+    double tmp;
 
-    int i = poly->degree;
-    double reOld = 0.0;               /* real part of last value in iteration */
-    double sinOmega = sin(omega);
+    int m = poly->degree / 2;
+    double reEven = poly->coeff[2 * m];             /* even coefficients */
+    double imEven = 0.0;
+    double reOdd = (2 * m < poly->degree) ? poly->coeff[2 * m + 1] : 0.0;
+    double imOdd = 0.0;
     double cosOmega = cos(omega);
+    double sinOmega = sin(omega);
+    double cos2Omega = cos(2.0 * omega);
+    double sin2Omega = sin(2.0 * omega);
 
-    GSL_SET_COMPLEX(&result, 0.0, 0.0);
-
-    for (pCoeff = &poly->coeff[poly->degree]; i >= 0; i--, pCoeff--)
+    for (--m; m >= 0; m--)
     {
-        GSL_SET_COMPLEX(&result,
-                        reOld * cosOmega + GSL_IMAG(result) * sinOmega + *pCoeff,
-                        GSL_IMAG(result) * cosOmega - reOld * sinOmega);
-        reOld = GSL_REAL(result);
+        tmp = reEven * cos2Omega + imEven * sin2Omega + poly->coeff[2 * m];
+        imEven = imEven * cos2Omega - reEven * sin2Omega;
+        reEven = tmp;
+
+        tmp = reOdd * cos2Omega + imOdd * sin2Omega + poly->coeff[2 * m + 1];
+        imOdd = imOdd * cos2Omega - reOdd * sin2Omega;
+        reOdd = tmp;
     } /* for */
 
-    return result;
+    *pRe = reEven + reOdd * cosOmega + imOdd * sinOmega;
+    *pIm = imEven + imOdd * cosOmega - reOdd * sinOmega;
 } /* evalPolyZ() */
 
 
@@ -131,7 +153,11 @@ static gsl_complex evalPolyZ(double omega, const MATHPOLY *poly)
  ******************************************************************************/
 static double evalPolyAngleZ(double omega, const MATHPOLY *poly)
 {
-    return gsl_complex_arg (evalPolyZ(omega, poly));
+    double re, im;
+
+    evalPolyZ(omega, poly, &re, &im);
+
+    return atan2 (im, re);
 } /* evalPolyAngleZ() */
 
 
@@ -151,6 +177,10 @@ static double evalPolyAngleZ(double omega, const MATHPOLY *poly)
     T_g(\omega)=\frac{\imop'[B(\omega)]\reop[B(\omega)]-\reop'[B(\omega)]\imop[B(\omega)]}{H^2(\omega)}
     \f]
  *
+ *  The polynomial and its derivative are evaluated by two independent
+ *  \e Horner chains (real and imaginary part in separate variables), which
+ *  need one pair of sin() and cos() only.
+ *
  *  \param omega        Frequency ratio \f$2\pi f/f_0\f$.
  *  \param poly         Pointer to polynomial coefficients in \e Z domain.
  *
@@ -161,46 +191,67 @@ static double evalPolyAngleZ(double omega, const MATHPOLY *poly)
 static double evalPolyGroupZ(double omega, const MATHPOLY *poly)
 {
     int i;
-    double cosOmega, sinOmega;
-    double *pCoeff;
+    double tmp;
 
-    double rpart = 0.0, ipart = 0.0;
-    double rdiff = 0.0, idiff = 0.0;
+    int n = poly->degree;
+    double rpart = poly->coeff[n];                          /* sum of a_i z^i */
+    double ipart = 0.0;
+    double rdiff = n * poly->coeff[n];                    /* sum of i a_i z^i */
+    double idiff = 0.0;
+    double cosOmega = cos(omega);
+    double sinOmega = sin(omega);
 
-    for (i = 0, pCoeff = poly->coeff; i <= poly->degree; i++, pCoeff++)
+    for (i = n - 1; i >= 0; i--)
     {
-        cosOmega = cos(i * omega);
-        sinOmega = sin(i * omega);
-        rpart += *pCoeff * cosOmega;
-        ipart += *pCoeff * sinOmega;
-        rdiff += *pCoeff * i * sinOmega;
-        idiff += *pCoeff * i * cosOmega;
+        tmp = rpart * cosOmega - ipart * sinOmega + poly->coeff[i];
+        ipart = rpart * sinOmega + ipart * cosOmega;
+        rpart = tmp;
+
+        tmp = rdiff * cosOmega - idiff * sinOmega + i * poly->coeff[i];
+        idiff = rdiff * sinOmega + idiff * cosOmega;
+        rdiff = tmp;
     } /* for */
 
-    return mathTryDiv (rpart * idiff + ipart * rdiff, rpart * rpart + ipart * ipart);
+    return mathTryDiv (rpart * rdiff + ipart * idiff, rpart * rpart + ipart * ipart);
 } /* evalPolyGroupZ() */
 
 
 
 /* FUNCTION *******************************************************************/
-/** Returns the next input sample for a time response.
+/** Returns the next input sample for a time response. User signals are read
+ *  chunk-wise into the workspace buffer. Behind the end of a user signal the
+ *  input is assumed to be zero.
  *
- *  \param xtime        Time in seconds.
- *  \param sig          The signal for which the next sample shall be returned.
+ *  \param pWorkspace   Pointer to time response workspace, formerly created
+ *                      by filterResponseTimeNew() or filterResponseTimeNewUser().
  *
- *  \return             Sample value associated with passed signal and time.
+ *  \return             Sample value associated with signal and current time.
  ******************************************************************************/
-static double timeResponseGetNext (double xtime, FLTSIGNAL sig)
+static double timeResponseGetNext (FLTRESP_TIME_WORKSPACE *pWorkspace)
 {
-    switch (sig)
+    switch (pWorkspace->sig)
     {
         case FLTSIGNAL_HEAVISIDE:
             return 1.0;
 
         case FLTSIGNAL_DIRAC:
-            return (xtime == 0.0) ? 1.0 : 0.0;
+            return (pWorkspace->curTime == 0.0) ? 1.0 : 0.0;
 
         case FLTSIGNAL_USER:
+            if (pWorkspace->sigIdx >= pWorkspace->sigLen)   /* chunk empty? */
+            {
+                pWorkspace->sigIdx = 0;
+                pWorkspace->sigLen = filterSignalRead (pWorkspace->pSource,
+                                                       pWorkspace->pSigBuf,
+                                                       pWorkspace->chunk);
+                if (pWorkspace->sigLen == 0)              /* end of signal */
+                {
+                    return 0.0;
+                } /* if */
+            } /* if */
+
+            return pWorkspace->pSigBuf[pWorkspace->sigIdx++];
+
         default:
             ASSERT (0);
     } /* switch */
@@ -210,7 +261,9 @@ static double timeResponseGetNext (double xtime, FLTSIGNAL sig)
 
 
 /* FUNCTION *******************************************************************/
-/** Processes the next input value on a time response.
+/** Processes the next input value on a time response. If the workspace has a
+ *  filter engine (or a fixed-point filter), the input is filtered chunk by
+ *  chunk (see timeResponseFrameNext()), else sample by sample.
  *
  *  \param pWorkspace   Pointer to time response workspace, formerly created
  *                      by filterResponseTimeNew().
@@ -226,10 +279,16 @@ static double timeResponseProcNext (FLTRESP_TIME_WORKSPACE *pWorkspace)
     int i;
     double *p;                                   /* pointer to in/out samples */
     const MATHPOLY *poly;
+    double osample, isample;
 
-    double osample = 0.0;                                    /* output sample */
-    double isample = timeResponseGetNext (pWorkspace->curTime,
-                                          pWorkspace->sig);
+    if ((pWorkspace->pEngine != NULL) || (pWorkspace->pFixed != NULL))
+    {
+        return (timeResponseFrameNext (pWorkspace, &osample) == 0)
+            ? osample : GSL_POSINF;
+    } /* if */
+
+    osample = 0.0;                                           /* output sample */
+    isample = timeResponseGetNext (pWorkspace);
     *pWorkspace->pCurIn = isample;         /* put new value into input buffer */
     p = pWorkspace->pCurIn;                             /* hold pointer to it */
     poly = &pWorkspace->pFilter->num;                    /* for faster access */
@@ -259,6 +318,284 @@ static double timeResponseProcNext (FLTRESP_TIME_WORKSPACE *pWorkspace)
 } /* timeResponseProcNext() */
 
 
+/* FUNCTION *******************************************************************/
+/** Processes the next input frame on a time response by the filter engine
+ *  (or the fixed-point filter). The input signal is generated (resp. read)
+ *  and filtered chunk by chunk. Behind the end of a user signal the input is
+ *  assumed to be zero.
+ *
+ *  \param pWorkspace   Pointer to time response workspace, which has a
+ *                      filter engine or a fixed-point filter.
+ *  \param frame        Buffer which gets the output samples of all channels
+ *                      (may be NULL).
+ *
+ *  \return             Zero on success, else an error number (see errno.h or
+ *                      gsl_errno.h for predefined codes).
+ ******************************************************************************/
+static int timeResponseFrameNext (FLTRESP_TIME_WORKSPACE *pWorkspace,
+                                  double *frame)
+{
+    int err;
+    gsize i, len;
+    int chan = pWorkspace->channels;
+    double *buf = pWorkspace->pSigBuf;
+
+    if (pWorkspace->sigIdx >= pWorkspace->sigLen)           /* chunk empty? */
+    {
+        switch (pWorkspace->sig)
+        {
+            case FLTSIGNAL_HEAVISIDE:
+                for (i = 0; i < pWorkspace->chunk; i++)
+                {
+                    buf[i] = 1.0;
+                } /* for */
+                break;
+
+            case FLTSIGNAL_DIRAC:
+                memset (buf, 0, pWorkspace->chunk * sizeof(double));
+                buf[0] = (pWorkspace->sigLen == 0) ? 1.0 : 0.0; /* 1st chunk? */
+                break;
+
+            case FLTSIGNAL_USER:
+                if (pWorkspace->pSource->channels == chan)  /* all channels? */
+                {
+                    len = filterSignalReadFrames (pWorkspace->pSource, buf,
+                                                  pWorkspace->chunk);
+                } /* if */
+                else
+                {
+                    len = filterSignalRead (pWorkspace->pSource, buf,
+                                            pWorkspace->chunk);
+                } /* else */
+
+                memset (buf + len * chan, 0,              /* end of signal */
+                        (pWorkspace->chunk - len) * chan * sizeof(double));
+                break;
+
+            default:
+                ASSERT (0);
+                return EINVAL;
+        } /* switch */
+
+        if (pWorkspace->pFixed != NULL)
+        {
+            filterFixedProcess (pWorkspace->pFixed, buf, buf, pWorkspace->chunk);
+        } /* if */
+        else
+        {
+            err = filterEngineProcess (pWorkspace->pEngine, buf, buf,
+                                       pWorkspace->chunk);
+            if (err != 0)
+            {
+                return err;
+            } /* if */
+        } /* else */
+
+        pWorkspace->sigIdx = 0;
+        pWorkspace->sigLen = pWorkspace->chunk;
+    } /* if */
+
+    if (frame != NULL)
+    {
+        memcpy (frame, buf + pWorkspace->sigIdx * chan, chan * sizeof(double));
+    } /* if */
+
+    ++pWorkspace->sigIdx;
+    return 0;
+} /* timeResponseFrameNext() */
+
+
+/* FUNCTION *******************************************************************/
+/** Creates an workspace for time response calculation.
+ *
+ *  \param start        Time to start (must be positive).
+ *  \param stop         Time to stop (must be positive).
+ *  \param type         Signal type.
+ *  \param pSource      Pointer to user signal (only used if \p type is
+ *                      FLTSIGNAL_USER).
+ *  \param frames       If TRUE all channels of \p pSource are filtered by a
+ *                      (multichannel) filter engine.
+ *  \param pFilter      Pointer to filter coefficients.
+ *  \param pFixed       Pointer to a fixed-point filter, which is used instead
+ *                      of a filter engine (may be NULL). In that case
+ *                      \p pFilter shall point to its quantized coefficients.
+ *
+ *  \return             Pointer to an workspace for time response calculation
+ *                      or NULL on error.
+ ******************************************************************************/
+static FLTRESP_TIME_WORKSPACE* timeResponseNew (double start, double stop,
+                                                FLTSIGNAL type,
+                                                FLTSIGNAL_SOURCE *pSource,
+                                                BOOL frames,
+                                                const FLTCOEFF* pFilter,
+                                                FLTFIXED *pFixed)
+{
+    FLTRESP_TIME_WORKSPACE *pWorkspace;
+    FLTENGINE_TYPE engine;
+    double xtime, t0;
+    gsize pos, skip;
+
+    if (((type != FLTSIGNAL_USER) &&           /* user signals may be long */
+         (start * pFilter->f0 > FLTRESP_TIME_SAMPLES_LIMIT)) ||
+        ((stop - start) * pFilter->f0 > FLTRESP_TIME_SAMPLES_LIMIT))
+    {
+        DEBUG_LOG ("Too many samples for time response calculation (%G, %G)",
+                   start * pFilter->f0, (stop - start) * pFilter->f0);
+        return NULL;
+    } /* if */
+
+    pWorkspace = g_malloc (sizeof (FLTRESP_TIME_WORKSPACE));
+
+    if (pWorkspace == NULL)
+    {
+        return NULL;
+    } /* if */
+
+    pWorkspace->pInBuf =
+        g_malloc ((1 + pFilter->num.degree) * sizeof(pFilter->num.coeff[0]));
+
+    if (pWorkspace->pInBuf == NULL)
+    {
+        g_free (pWorkspace);
+        return NULL;
+    } /* if */
+
+    pWorkspace->pOutBuf =
+        g_malloc ((1 + pFilter->den.degree) * sizeof(pFilter->den.coeff[0]));
+
+    if (pWorkspace->pOutBuf == NULL)
+    {
+        g_free (pWorkspace->pInBuf);
+        g_free (pWorkspace);
+        return NULL;
+    } /* if */
+
+    pWorkspace->pEngine = NULL;
+    pWorkspace->pFixed = pFixed;
+    pWorkspace->sigLen = pWorkspace->sigIdx = 0;
+    pWorkspace->channels = frames ? pSource->channels : 1;
+
+    if (frames)
+    {
+        engine = FLTENGINE_AUTO;
+    } /* if */
+    else              /* block FFT convolution on long FIR filters, else the
+                       * direct form (unrolled kernels on low degree) */
+    {
+        engine = ((pFilter->den.degree == 0) &&
+                  (pFilter->num.degree + 1 >= filterConvCrossover ()))
+            ? FLTENGINE_FFT : FLTENGINE_DIRECT;
+    } /* else */
+
+    /* On error (e.g. a0 = 0) fall back to the generic loop, but multichannel
+     * time responses need the engine.
+     */
+    if (pFixed != NULL)                    /* simulation of a fixed-point filter */
+    {
+        filterFixedReset (pFixed);
+    } /* if */
+    else if ((filterEngineNew (pFilter, engine, 0, pWorkspace->channels,
+                               &pWorkspace->pEngine) != 0) && frames)
+    {
+        g_free (pWorkspace->pOutBuf);
+        g_free (pWorkspace->pInBuf);
+        g_free (pWorkspace);
+        return NULL;
+    } /* else if */
+
+    pWorkspace->chunk = FLTRESP_SIGNAL_CHUNK;
+
+    if ((type != FLTSIGNAL_USER) && (pWorkspace->pEngine != NULL))
+    {
+        pWorkspace->chunk = GSL_MAX_INT (FLTRESP_TIME_CHUNK,
+                                         pWorkspace->pEngine->block);
+    } /* if */
+
+    if ((type != FLTSIGNAL_USER) && (pFixed != NULL))
+    {
+        pWorkspace->chunk = FLTRESP_TIME_CHUNK;
+    } /* if */
+
+    pWorkspace->pSigBuf = NULL;
+
+    if ((type == FLTSIGNAL_USER) || (pWorkspace->pEngine != NULL) ||
+        (pFixed != NULL))
+    {
+        pWorkspace->pSigBuf = g_malloc (pWorkspace->chunk * pWorkspace->channels
+                                        * sizeof(double));
+
+        if (pWorkspace->pSigBuf == NULL)
+        {
+            if (pWorkspace->pEngine != NULL)
+            {
+                filterEngineFree (pWorkspace->pEngine);
+            } /* if */
+
+            g_free (pWorkspace->pOutBuf);
+            g_free (pWorkspace->pInBuf);
+            g_free (pWorkspace);
+            return NULL;
+        } /* if */
+    } /* if */
+
+    pWorkspace->pLastOut = pWorkspace->pOutBuf;
+    pWorkspace->pCurIn = pWorkspace->pInBuf;
+    pWorkspace->sig = type;                         /* set passed signal type */
+    pWorkspace->pFilter = pFilter;
+    pWorkspace->pSource = pSource;
+
+    memset (pWorkspace->pInBuf, 0,
+            (1 + pFilter->num.degree) * sizeof(pFilter->num.coeff[0]));
+    memset (pWorkspace->pOutBuf, 0,
+            (1 + pFilter->den.degree) * sizeof(pFilter->den.coeff[0]));
+
+    pWorkspace->curTime = 0.0;
+    t0 = 1.0 / pFilter->f0;
+
+    /* Skip the beginning of long user signals, so that the filter settles on
+     * at most FLTRESP_SIGNAL_SETTLE samples before start (starting at rest).
+     */
+    if ((type == FLTSIGNAL_USER) &&
+        (start * pFilter->f0 > FLTRESP_SIGNAL_SETTLE))
+    {
+        pos = filterSignalTell (pSource);
+        skip = (gsize)(start * pFilter->f0) - FLTRESP_SIGNAL_SETTLE;
+        skip = GSL_MIN (skip, pSource->samples - pos);
+
+        if (filterSignalSeek (pSource, pos + skip) == 0)
+        {
+            pWorkspace->curTime = skip * t0;
+        } /* if */
+    } /* if */
+
+    while (pWorkspace->curTime < start)   /* process all samples up to start */
+    {
+        if ((pWorkspace->pEngine != NULL) || (pFixed != NULL))
+        {
+            timeResponseFrameNext (pWorkspace, NULL);
+        } /* if */
+        else
+        {
+            timeResponseProcNext (pWorkspace);
+        } /* else */
+
+        pWorkspace->curTime += t0;
+    } /* while */
+
+
+    xtime = pWorkspace->curTime;         /* hold current time as start value */
+    pWorkspace->samples = 0;
+
+    while (xtime <= stop)           /* count number of samples up to the end */
+    {
+        ++pWorkspace->samples;
+        xtime += t0;
+    } /* while */
+
+    return pWorkspace;
+} /* timeResponseNew() */
+
+
 
 /* EXPORTED FUNCTION DEFINITIONS **********************************************/
 
@@ -282,7 +619,11 @@ static double timeResponseProcNext (FLTRESP_TIME_WORKSPACE *pWorkspace)
  ******************************************************************************/
 double filterResponsePoly (double omega, const MATHPOLY *poly)
 {
-    return gsl_complex_abs (evalPolyZ(omega, poly));
+    double re, im;
+
+    evalPolyZ(omega, poly, &re, &im);
+
+    return hypot (re, im);
 } /* filterResponsePoly() */
 
 
@@ -468,74 +809,104 @@ double filterResponseChar (double f, FLTCOEFF* pFilter)
 FLTRESP_TIME_WORKSPACE* filterResponseTimeNew (double start, double stop,
                                                FLTSIGNAL type, const FLTCOEFF* pFilter)
 {
-    FLTRESP_TIME_WORKSPACE *pWorkspace;
-    double xtime, t0;
-
-    if ((start * pFilter->f0 > FLTRESP_TIME_SAMPLES_LIMIT) ||
-        ((stop - start) * pFilter->f0 > FLTRESP_TIME_SAMPLES_LIMIT))
+    if (type == FLTSIGNAL_USER)         /* use filterResponseTimeNewUser() */
     {
-        DEBUG_LOG ("Too many samples for time response calculation (%G, %G)",
-                   start * pFilter->f0, (stop - start) * pFilter->f0);
         return NULL;
     } /* if */
 
-    pWorkspace = g_malloc (sizeof (FLTRESP_TIME_WORKSPACE));
+    return timeResponseNew (start, stop, type, NULL, FALSE, pFilter, NULL);
+} /* filterResponseTimeNew() */
 
-    if (pWorkspace == NULL)
-    {
-        return NULL;
-    } /* if */
 
-    pWorkspace->pInBuf =
-        g_malloc ((1 + pFilter->num.degree) * sizeof(pFilter->num.coeff[0]));
 
-    if (pWorkspace->pInBuf == NULL)
-    {
-        g_free (pWorkspace);
-        return NULL;
-    } /* if */
-
-    pWorkspace->pOutBuf =
-        g_malloc ((1 + pFilter->den.degree) * sizeof(pFilter->den.coeff[0]));
-
-    if (pWorkspace->pOutBuf == NULL)
+/* FUNCTION *******************************************************************/
+/** This function creates an workspace for the time response of a fixed-point
+ *  filter. The input signal is quantized to the fixed-point format and
+ *  filtered by integer arithmetic (see filterFixedProcess()).
+ *
+ *  \param start        Time to start (must be positive).
+ *  \param stop         Time to stop (must be positive).
+ *  \param type         Signal type.
+ *  \param pFixed       Pointer to fixed-point filter, formerly created by
+ *                      filterFixedNew(). Its state is reset here and it must
+ *                      exist until the workspace is free'd.
+ *
+ *  \return             Pointer to an workspace for time response calculation
+ *                      via function filterResponseTimeNext(), else NULL (see
+ *                      filterResponseTimeNew()).
+ ******************************************************************************/
+FLTRESP_TIME_WORKSPACE* filterResponseTimeNewFixed (double start, double stop,
+                                                    FLTSIGNAL type,
+                                                    FLTFIXED *pFixed)
+{
+    if (type == FLTSIGNAL_USER)
     {
-        g_free (pWorkspace->pInBuf);
-        g_free (pWorkspace);
         return NULL;
     } /* if */
 
-    pWorkspace->pLastOut = pWorkspace->pOutBuf;
-    pWorkspace->pCurIn = pWorkspace->pInBuf;
-    pWorkspace->sig = type;                         /* set passed signal type */
-    pWorkspace->pFilter = pFilter;
+    return timeResponseNew (start, stop, type, NULL, FALSE, &pFixed->coeff,
+                            pFixed);
+} /* filterResponseTimeNewFixed() */
 
-    memset (pWorkspace->pInBuf, 0,
-            (1 + pFilter->num.degree) * sizeof(pFilter->num.coeff[0]));
-    memset (pWorkspace->pOutBuf, 0,
-            (1 + pFilter->den.degree) * sizeof(pFilter->den.coeff[0]));
 
-    pWorkspace->curTime = 0.0;
-    t0 = 1.0 / pFilter->f0;
-
-    while (pWorkspace->curTime < start)   /* process all samples up to start */
-    {
-        timeResponseProcNext (pWorkspace);
-        pWorkspace->curTime += t0;
-    } /* while */
 
+/* FUNCTION *******************************************************************/
+/** This function creates an workspace for time response calculation on a
+ *  user defined input signal (FLTSIGNAL_USER). The signal is streamed from
+ *  its (memory mapped) file in chunks, starting at the current read position
+ *  of \p pSource. The samples up to \p start are processed too, so that the
+ *  filter state is valid at \p start. On long signals the filter settles on
+ *  the last FLTRESP_SIGNAL_SETTLE samples before \p start only, which bounds
+ *  the effort of late start times. FIR filters with more coefficients than
+ *  returned by filterConvCrossover() are processed by block FFT convolution.
+ *
+ *  \param start        Time to start (must be positive).
+ *  \param stop         Time to stop (must be positive).
+ *  \param pSource      Pointer to user signal, formerly opened by
+ *                      filterSignalOpen(). It must remain open until the
+ *                      workspace is free'd.
+ *  \param pFilter      Pointer to filter coefficients.
+ *
+ *  \return             Pointer to an workspace for time response calculation
+ *                      via function filterResponseTimeNext(), else NULL (see
+ *                      filterResponseTimeNew()).
+ ******************************************************************************/
+FLTRESP_TIME_WORKSPACE* filterResponseTimeNewUser (double start, double stop,
+                                                   FLTSIGNAL_SOURCE *pSource,
+                                                   const FLTCOEFF* pFilter)
+{
+    ASSERT (pSource != NULL);
+    return timeResponseNew (start, stop, FLTSIGNAL_USER, pSource, FALSE, pFilter,
+                            NULL);
+} /* filterResponseTimeNewUser() */
 
-    xtime = pWorkspace->curTime;         /* hold current time as start value */
-    pWorkspace->samples = 0;
 
-    while (xtime <= stop)           /* count number of samples up to the end */
-    {
-        ++pWorkspace->samples;
-        xtime += t0;
-    } /* while */
 
-    return pWorkspace;
-} /* filterResponseTimeNew() */
+/* FUNCTION *******************************************************************/
+/** This function creates an workspace for a multichannel time response on a
+ *  user defined input signal (FLTSIGNAL_USER). All \a channels of \p pSource
+ *  are filtered simultaneously by one filter engine (see filterEngineNew()),
+ *  so use filterResponseTimeNextFrame() to get the output frames.
+ *
+ *  \param start        Time to start (must be positive).
+ *  \param stop         Time to stop (must be positive).
+ *  \param pSource      Pointer to user signal, formerly opened by
+ *                      filterSignalOpen(). It must remain open until the
+ *                      workspace is free'd.
+ *  \param pFilter      Pointer to filter coefficients.
+ *
+ *  \return             Pointer to an workspace for time response calculation
+ *                      via function filterResponseTimeNextFrame(), else NULL
+ *                      (see filterResponseTimeNew()).
+ ******************************************************************************/
+FLTRESP_TIME_WORKSPACE* filterResponseTimeNewFrames (double start, double stop,
+                                                     FLTSIGNAL_SOURCE *pSource,
+                                                     const FLTCOEFF* pFilter)
+{
+    ASSERT (pSource != NULL);
+    return timeResponseNew (start, stop, FLTSIGNAL_USER, pSource, TRUE, pFilter,
+                            NULL);
+} /* filterResponseTimeNewFrames() */
 
 
 
@@ -563,6 +934,31 @@ double filterResponseTimeNext (FLTRESP_TIME_WORKSPACE *pWorkspace, double *pTime
 
 
 
+/* FUNCTION *******************************************************************/
+/** Returns the next output frame (all channels) for a multichannel time
+ *  response.
+ *
+ *  \param pWorkspace   Pointer to time response workspace, formerly created
+ *                      by filterResponseTimeNewFrames().
+ *  \param pTime        Pointer to a variable which gets the next time value.
+ *  \param frame        Buffer which gets the output samples of all
+ *                      \a channels.
+ *
+ *  \return             Zero on success, else an error number (see errno.h or
+ *                      gsl_errno.h for predefined codes).
+ ******************************************************************************/
+int filterResponseTimeNextFrame (FLTRESP_TIME_WORKSPACE *pWorkspace,
+                                 double *pTime, double *frame)
+{
+    ASSERT (pWorkspace->pEngine != NULL);
+
+    *pTime = pWorkspace->curTime;       /* give current sample time to caller */
+    pWorkspace->curTime += 1.0 / pWorkspace->pFilter->f0;
+    return timeResponseFrameNext (pWorkspace, frame);
+} /* filterResponseTimeNextFrame() */
+
+
+
 /* FUNCTION *******************************************************************/
 /** Free's a time response workspace.
  *
@@ -572,6 +968,12 @@ double filterResponseTimeNext (FLTRESP_TIME_WORKSPACE *pWorkspace, double *pTime
  ******************************************************************************/
 void filterResponseTimeFree (FLTRESP_TIME_WORKSPACE *pWorkspace)
 {
+    if (pWorkspace->pEngine != NULL)
+    {
+        filterEngineFree (pWorkspace->pEngine);
+    } /* if */
+
+    g_free(pWorkspace->pSigBuf);
     g_free(pWorkspace->pInBuf);
     g_free(pWorkspace->pOutBuf);
     g_free(pWorkspace);
@@ -0,0 +1,597 @@
+/**
+ * \file        filterSignal.c
+ * \brief       User defined (input) signals for time responses.
+ * \copyright   Copyright (C) 2006-2022 Ralf Hoppe <dfcgen@rho62.de>
+ */
+
+
+/* INCLUDE FILES **************************************************************/
+
+#include "filterSignal.h"
+
+#include <errno.h>
+#include <string.h> /* memcmp(), memcpy() */
+
+
+/* GLOBAL CONSTANT DEFINITIONS ************************************************/
+
+
+/* GLOBAL VARIABLE DEFINITIONS ************************************************/
+
+
+/* LOCAL TYPE DECLARATIONS ****************************************************/
+
+
+/* LOCAL CONSTANT DEFINITIONS *************************************************/
+
+#define FLTSIGNAL_WAV_HEADER    12     /**< Size of RIFF header ("RIFF" + size + "WAVE") */
+#define FLTSIGNAL_WAV_CHUNK     8        /**< Size of RIFF chunk header (id + size) */
+#define FLTSIGNAL_WAV_FMT_SIZE  16       /**< Minimum size of WAV "fmt " chunk */
+#define FLTSIGNAL_WAV_PCM       0x0001            /**< WAVE_FORMAT_PCM tag */
+#define FLTSIGNAL_WAV_FLOAT     0x0003     /**< WAVE_FORMAT_IEEE_FLOAT tag */
+#define FLTSIGNAL_WAV_EXTENSIBLE 0xFFFE   /**< WAVE_FORMAT_EXTENSIBLE tag */
+
+
+/* LOCAL VARIABLE DEFINITIONS *************************************************/
+
+
+/* LOCAL MACRO DEFINITIONS ****************************************************/
+
+
+/* MACRO **********************************************************************/
+/** Reads an unsigned 16 bit little endian value from a byte buffer.
+ *
+ *  \param p            Pointer to first byte (guint8).
+ *
+ ******************************************************************************/
+#define FLTSIGNAL_GET16(p)      ((guint16)((p)[0] | ((p)[1] << 8)))
+
+
+/* MACRO **********************************************************************/
+/** Reads an unsigned 32 bit little endian value from a byte buffer.
+ *
+ *  \param p            Pointer to first byte (guint8).
+ *
+ ******************************************************************************/
+#define FLTSIGNAL_GET32(p)                                              \
+    ((guint32)(p)[0] | ((guint32)(p)[1] << 8) |                         \
+     ((guint32)(p)[2] << 16) | ((guint32)(p)[3] << 24))
+
+
+/* LOCAL FUNCTION DECLARATIONS ************************************************/
+
+static int signalErrno (GError *err);
+static int signalParseWav (FLTSIGNAL_SOURCE *pSource, const guint8 *p, gsize len);
+static void signalDecode (const FLTSIGNAL_SOURCE *pSource, const guint8 *p,
+                          int stride, double *buf, gsize size);
+
+
+/* LOCAL FUNCTION DEFINITIONS *************************************************/
+
+
+/* FUNCTION *******************************************************************/
+/** Converts a \e GLib file error into an error number (and free's it).
+ *
+ *  \param err          Pointer to error structure.
+ *
+ *  \return             Error number from errno.h.
+ ******************************************************************************/
+static int signalErrno (GError *err)
+{
+    int result = EIO;
+
+    if (err->domain == G_FILE_ERROR)
+    {
+        switch (err->code)
+        {
+            case G_FILE_ERROR_NOENT:
+                result = ENOENT;
+                break;
+
+            case G_FILE_ERROR_ACCES:
+            case G_FILE_ERROR_PERM:
+                result = EACCES;
+                break;
+
+            case G_FILE_ERROR_NOMEM:
+                result = ENOMEM;
+                break;
+
+            default:
+                break;
+        } /* switch */
+    } /* if */
+
+    DEBUG_LOG ("%s", err->message);
+    g_error_free (err);
+
+    return result;
+} /* signalErrno() */
+
+
+/* FUNCTION *******************************************************************/
+/** Parses the header of a RIFF/WAVE file and sets the sample encoding, the
+ *  number of channels, the sample frequency and the data pointer of a source.
+ *  All chunks but "fmt " and "data" are skipped.
+ *
+ *  \param pSource      Pointer to signal source.
+ *  \param p            Pointer to the memory mapped file contents.
+ *  \param len          Size of file in bytes.
+ *
+ *  \return             Zero on success, else EINVAL (invalid or unsupported
+ *                      WAV format).
+ ******************************************************************************/
+static int signalParseWav (FLTSIGNAL_SOURCE *pSource, const guint8 *p, gsize len)
+{
+    guint32 size;
+    int tag, bits;
+
+    const guint8 *pEnd = p + len;
+    const guint8 *pFmt = NULL;
+
+    if ((len < FLTSIGNAL_WAV_HEADER) ||
+        (memcmp (p, "RIFF", 4) != 0) || (memcmp (p + 8, "WAVE", 4) != 0))
+    {
+        return EINVAL;
+    } /* if */
+
+    p += FLTSIGNAL_WAV_HEADER;
+
+    while (pEnd - p >= FLTSIGNAL_WAV_CHUNK)
+    {
+        size = FLTSIGNAL_GET32 (p + 4);
+
+        if (memcmp (p, "fmt ", 4) == 0)
+        {
+            if ((size < FLTSIGNAL_WAV_FMT_SIZE) ||
+                (size > (guint32)(pEnd - p - FLTSIGNAL_WAV_CHUNK)))
+            {
+                return EINVAL;
+            } /* if */
+
+            pFmt = p + FLTSIGNAL_WAV_CHUNK;
+        } /* if */
+        else if (memcmp (p, "data", 4) == 0)
+        {
+            if (pFmt == NULL)                  /* "fmt " must precede "data" */
+            {
+                return EINVAL;
+            } /* if */
+
+            p += FLTSIGNAL_WAV_CHUNK;
+
+            if (size > (guint32)(pEnd - p))           /* truncated recording? */
+            {
+                size = pEnd - p;
+            } /* if */
+
+            tag = FLTSIGNAL_GET16 (pFmt);
+            pSource->channels = FLTSIGNAL_GET16 (pFmt + 2);
+            pSource->f0 = FLTSIGNAL_GET32 (pFmt + 4);
+            pSource->frame = FLTSIGNAL_GET16 (pFmt + 12);
+            bits = FLTSIGNAL_GET16 (pFmt + 14);
+
+            if ((tag == FLTSIGNAL_WAV_EXTENSIBLE) &&
+                (FLTSIGNAL_GET32 (pFmt - 4) >= FLTSIGNAL_WAV_FMT_SIZE + 10))
+            {                     /* sub-format GUID starts with format tag */
+                tag = FLTSIGNAL_GET16 (pFmt + 24);
+            } /* if */
+
+            switch (tag)
+            {
+                case FLTSIGNAL_WAV_PCM:
+                    switch (bits)
+                    {
+                        case 8:
+                            pSource->enc = FLTSIGNAL_ENC_U8;
+                            break;
+
+                        case 16:
+                            pSource->enc = FLTSIGNAL_ENC_S16LE;
+                            break;
+
+                        case 24:
+                            pSource->enc = FLTSIGNAL_ENC_S24LE;
+                            break;
+
+                        case 32:
+                            pSource->enc = FLTSIGNAL_ENC_S32LE;
+                            break;
+
+                        default:
+                            return EINVAL;
+                    } /* switch */
+                    break;
+
+                case FLTSIGNAL_WAV_FLOAT:
+                    switch (bits)
+                    {
+                        case 32:
+                            pSource->enc = FLTSIGNAL_ENC_F32LE;
+                            break;
+
+                        case 64:
+                            pSource->enc = FLTSIGNAL_ENC_F64LE;
+                            break;
+
+                        default:
+                            return EINVAL;
+                    } /* switch */
+                    break;
+
+                default:
+                    DEBUG_LOG ("Unsupported WAV format tag 0x%04X", tag);
+                    return EINVAL;
+            } /* switch */
+
+            pSource->width = bits / 8;
+
+            if ((pSource->channels <= 0) ||
+                (pSource->frame < pSource->channels * pSource->width))
+            {
+                return EINVAL;
+            } /* if */
+
+            pSource->pData = p;
+            pSource->samples = size / pSource->frame;
+
+            return 0;
+        } /* else if */
+
+        if ((gsize)size + FLTSIGNAL_WAV_CHUNK >= (gsize)(pEnd - p))
+        {
+            break;                             /* end of file (or corrupted) */
+        } /* if */
+
+        p += FLTSIGNAL_WAV_CHUNK + size + (size & 1);  /* chunks are 2-aligned */
+    } /* while */
+
+    return EINVAL;                                     /* no "data" chunk */
+} /* signalParseWav() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Converts samples of a user signal into doubles. PCM samples are normalized
+ *  to the range \f$[-1,1)\f$.
+ *
+ *  \param pSource      Pointer to signal source (for the sample encoding).
+ *  \param p            Pointer to first sample in file.
+ *  \param stride       Distance of two consecutive samples (in bytes).
+ *  \param buf          Buffer which gets the samples.
+ *  \param size         Number of samples to convert.
+ *
+ ******************************************************************************/
+static void signalDecode (const FLTSIGNAL_SOURCE *pSource, const guint8 *p,
+                          int stride, double *buf, gsize size)
+{
+    gsize i;
+
+    union
+    {
+        guint32 u32;
+        guint64 u64;
+        gfloat f32;
+        gdouble f64;
+    } conv;                                   /* type punning (IEEE floats) */
+
+    switch (pSource->enc)                     /* one loop per sample encoding */
+    {
+        case FLTSIGNAL_ENC_U8:
+            for (i = 0; i < size; i++, p += stride)
+            {
+                buf[i] = ((int)*p - 128) / 128.0;
+            } /* for */
+            break;
+
+        case FLTSIGNAL_ENC_S16LE:
+            for (i = 0; i < size; i++, p += stride)
+            {
+                buf[i] = (gint16) FLTSIGNAL_GET16 (p) / 32768.0;
+            } /* for */
+            break;
+
+        case FLTSIGNAL_ENC_S24LE:
+            for (i = 0; i < size; i++, p += stride)
+            {                                       /* sign extend from MSB */
+                buf[i] = (gint32) (((guint32)p[0] << 8) | ((guint32)p[1] << 16) |
+                                   ((guint32)p[2] << 24)) / 2147483648.0;
+            } /* for */
+            break;
+
+        case FLTSIGNAL_ENC_S32LE:
+            for (i = 0; i < size; i++, p += stride)
+            {
+                buf[i] = (gint32) FLTSIGNAL_GET32 (p) / 2147483648.0;
+            } /* for */
+            break;
+
+        case FLTSIGNAL_ENC_F32LE:
+            for (i = 0; i < size; i++, p += stride)
+            {
+                conv.u32 = FLTSIGNAL_GET32 (p);
+                buf[i] = conv.f32;
+            } /* for */
+            break;
+
+        case FLTSIGNAL_ENC_F64LE:
+            for (i = 0; i < size; i++, p += stride)
+            {
+                conv.u64 = FLTSIGNAL_GET32 (p) | ((guint64) FLTSIGNAL_GET32 (p + 4) << 32);
+                buf[i] = conv.f64;
+            } /* for */
+            break;
+
+        case FLTSIGNAL_ENC_F32:
+            for (i = 0; i < size; i++, p += stride)
+            {
+                memcpy (&conv.f32, p, sizeof (conv.f32));    /* maybe unaligned */
+                buf[i] = conv.f32;
+            } /* for */
+            break;
+
+        case FLTSIGNAL_ENC_F64:
+            for (i = 0; i < size; i++, p += stride)
+            {
+                memcpy (&conv.f64, p, sizeof (conv.f64));    /* maybe unaligned */
+                buf[i] = conv.f64;
+            } /* for */
+            break;
+
+        default:
+            ASSERT (0);
+    } /* switch */
+} /* signalDecode() */
+
+
+
+/* EXPORTED FUNCTION DEFINITIONS **********************************************/
+
+
+/* FUNCTION *******************************************************************/
+/** Opens a user signal file by mapping it into memory. A raw file is assumed
+ *  to hold a single channel of floating-point samples. The format of a WAV
+ *  file is taken from its header.
+ *
+ *  \param filename     Filename of signal file (with path).
+ *  \param format       Format of file.
+ *  \param ppSource     Pointer to a buffer which gets the pointer to the new
+ *                      signal source (NULL on error).
+ *
+ *  \return             Zero on success, else an error number from errno.h.
+ ******************************************************************************/
+int filterSignalOpen (const char *filename, FLTSIGNAL_FORMAT format,
+                      FLTSIGNAL_SOURCE **ppSource)
+{
+    gsize len;
+    int err = 0;
+    GError *gerr = NULL;
+    FLTSIGNAL_SOURCE *pSource = g_malloc0 (sizeof (FLTSIGNAL_SOURCE));
+
+    *ppSource = NULL;
+
+    if (pSource == NULL)
+    {
+        return ENOMEM;
+    } /* if */
+
+    pSource->pMap = g_mapped_file_new (filename, FALSE, &gerr);
+
+    if (pSource->pMap == NULL)
+    {
+        g_free (pSource);
+        return signalErrno (gerr);
+    } /* if */
+
+    len = g_mapped_file_get_length (pSource->pMap);
+    pSource->pData = (const guint8 *) g_mapped_file_get_contents (pSource->pMap);
+    pSource->channels = 1;
+
+    switch (format)
+    {
+        case FLTSIGNAL_FORMAT_FLOAT32:
+            pSource->enc = FLTSIGNAL_ENC_F32;
+            pSource->frame = pSource->width = sizeof (gfloat);
+            pSource->samples = len / pSource->frame;
+            break;
+
+        case FLTSIGNAL_FORMAT_FLOAT64:
+            pSource->enc = FLTSIGNAL_ENC_F64;
+            pSource->frame = pSource->width = sizeof (gdouble);
+            pSource->samples = len / pSource->frame;
+            break;
+
+        case FLTSIGNAL_FORMAT_WAV:
+            err = signalParseWav (pSource, pSource->pData, len);
+            break;
+
+        default:
+            ASSERT (0);
+            err = EINVAL;
+    } /* switch */
+
+    if (err != 0)
+    {
+        DEBUG_LOG ("Invalid signal file '%s'", filename);
+        filterSignalClose (pSource);
+        return err;
+    } /* if */
+
+    DEBUG_LOG ("Signal file '%s' mapped (%" G_GSIZE_FORMAT " samples, %d channels)",
+               filename, pSource->samples, pSource->channels);
+
+    *ppSource = pSource;
+    return 0;
+} /* filterSignalOpen() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Sets the current read position of a user signal.
+ *
+ *  \param pSource      Pointer to signal source.
+ *  \param pos          New position (index of sample frame).
+ *
+ *  \return             Zero on success, else ERANGE (position behind end
+ *                      of signal).
+ ******************************************************************************/
+int filterSignalSeek (FLTSIGNAL_SOURCE *pSource, gsize pos)
+{
+    if (pos > pSource->samples)
+    {
+        return ERANGE;
+    } /* if */
+
+    pSource->pos = pos;
+    return 0;
+} /* filterSignalSeek() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Returns the current read position of a user signal.
+ *
+ *  \param pSource      Pointer to signal source.
+ *
+ *  \return             Current position (index of sample frame).
+ ******************************************************************************/
+gsize filterSignalTell (const FLTSIGNAL_SOURCE *pSource)
+{
+    return pSource->pos;
+} /* filterSignalTell() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Sets the number of interleaved channels of a raw signal file (a WAV file
+ *  holds it in its header). The read position is reset to the start.
+ *
+ *  \param pSource      Pointer to signal source.
+ *  \param channels     Number of interleaved channels.
+ *
+ *  \return             Zero on success, else EINVAL (no raw file or invalid
+ *                      number of channels).
+ ******************************************************************************/
+int filterSignalInterleave (FLTSIGNAL_SOURCE *pSource, int channels)
+{
+    gsize len = pSource->samples * pSource->frame;
+
+    if ((channels < 1) ||
+        ((pSource->enc != FLTSIGNAL_ENC_F32) && (pSource->enc != FLTSIGNAL_ENC_F64)))
+    {
+        return EINVAL;
+    } /* if */
+
+    pSource->channels = channels;
+    pSource->channel = 0;
+    pSource->frame = channels * pSource->width;
+    pSource->samples = len / pSource->frame;
+    pSource->pos = 0;
+
+    return 0;
+} /* filterSignalInterleave() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Reads the next chunk of samples (of channel \a channel) from a user signal
+ *  and converts it into doubles. PCM samples are normalized to the range
+ *  \f$[-1,1)\f$.
+ *
+ *  \param pSource      Pointer to signal source.
+ *  \param buf          Buffer which gets the samples.
+ *  \param size         Number of samples to read (size of \p buf).
+ *
+ *  \return             Number of samples read, which is less than \p size
+ *                      at end of signal.
+ ******************************************************************************/
+gsize filterSignalRead (FLTSIGNAL_SOURCE *pSource, double *buf, gsize size)
+{
+    ASSERT ((pSource->channel >= 0) && (pSource->channel < pSource->channels));
+
+    if (size > pSource->samples - pSource->pos)
+    {
+        size = pSource->samples - pSource->pos;
+    } /* if */
+
+    signalDecode (pSource, pSource->pData + pSource->pos * pSource->frame
+                  + pSource->channel * pSource->width,
+                  pSource->frame, buf, size);
+
+    pSource->pos += size;
+    return size;
+} /* filterSignalRead() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Reads the next chunk of sample frames (all channels) from a user signal
+ *  and converts it into doubles. The samples are stored interleaved, means
+ *  channel \e c of frame \e i is found at \p buf[i * \a channels + \e c].
+ *  PCM samples are normalized to the range \f$[-1,1)\f$.
+ *
+ *  \param pSource      Pointer to signal source.
+ *  \param buf          Buffer which gets the samples (\p size times
+ *                      \a channels elements).
+ *  \param size         Number of frames to read.
+ *
+ *  \return             Number of frames read, which is less than \p size
+ *                      at end of signal.
+ ******************************************************************************/
+gsize filterSignalReadFrames (FLTSIGNAL_SOURCE *pSource, double *buf, gsize size)
+{
+    gsize i;
+    const guint8 *p;
+
+    if (size > pSource->samples - pSource->pos)
+    {
+        size = pSource->samples - pSource->pos;
+    } /* if */
+
+    p = pSource->pData + pSource->pos * pSource->frame;
+
+    if (pSource->frame == pSource->channels * pSource->width)   /* no gaps? */
+    {
+        signalDecode (pSource, p, pSource->width, buf,
+                      size * pSource->channels);
+    } /* if */
+    else                                      /* padded frames (WAV file) */
+    {
+        for (i = 0; i < size; i++, p += pSource->frame)
+        {
+            signalDecode (pSource, p, pSource->width,
+                          buf + i * pSource->channels, pSource->channels);
+        } /* for */
+    } /* else */
+
+    pSource->pos += size;
+    return size;
+} /* filterSignalReadFrames() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Closes a user signal (unmaps the file and free's the source).
+ *
+ *  \param pSource      Pointer to signal source, formerly created by
+ *                      filterSignalOpen().
+ *
+ ******************************************************************************/
+void filterSignalClose (FLTSIGNAL_SOURCE *pSource)
+{
+    if (pSource != NULL)
+    {
+        if (pSource->pMap != NULL)
+        {
+            g_mapped_file_unref (pSource->pMap);
+        } /* if */
+
+        g_free (pSource);
+    } /* if */
+} /* filterSignalClose() */
+
+
+
+/******************************************************************************/
+/* END OF FILE                                                                */
+/******************************************************************************/
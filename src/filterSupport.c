@@ -37,6 +37,8 @@
 /* LOCAL FUNCTION DECLARATIONS ************************************************/
 
 static int checkPolyZ(MATHPOLY *poly);
+static int composeFilter (FLTCOEFF *dest, const FLTCOEFF *pFilter1,
+                          const FLTCOEFF *pFilter2, BOOL parallel);
 
 
 /* LOCAL FUNCTION DEFINITIONS *************************************************/
@@ -45,7 +47,9 @@ static int checkPolyZ(MATHPOLY *poly);
 /* FUNCTION *******************************************************************/
 /** Checks a polynomial wrt. size of coefficients. If any coefficient is less
  *  than FILTER_APPROX_ZERO, the it will be set to zero (and on leading
- *  coefficients the degree of polynomial adopted).
+ *  coefficients the degree of polynomial adopted). Zero coefficients inside
+ *  the polynomial are kept (as exact, positive zero), so that the pattern of
+ *  zeros of e.g. half-band filters survives.
  *
  *  \param poly         Pointer to polynomial.
  *
@@ -105,17 +109,18 @@ static int checkPolyZ (MATHPOLY *poly)
     } /* if */
 
 
-    if (degree != poly->degree)           /* realloc memory if degree changed */
+    for (k = 1; k < degree; k++)             /* exact zeros inside polynomial */
     {
-        poly->coeff = realloc(poly->coeff, (1 + degree) * sizeof(poly->coeff[0]));
-        poly->root  = realloc(poly->root, GSL_MAX (1, degree) * sizeof(poly->root[0]));
-        ret = GSL_CONTINUE;
-    } /* if */
+        if (fabs(poly->coeff[k]) < FILTER_APPROX_ZERO)
+        {
+            poly->coeff[k] = 0.0;
+        } /* if */
+    } /* for */
 
-    if ((poly->root == NULL) || (poly->coeff == NULL))
+
+    if (degree != poly->degree)       /* degree changed (memory space kept) */
     {
-        DEBUG_LOG ("Polynomial memory re-allocation has failed");
-        return ENOMEM;
+        ret = GSL_CONTINUE;
     } /* if */
 
     poly->degree = degree;
@@ -124,6 +129,122 @@ static int checkPolyZ (MATHPOLY *poly)
 } /* checkPolyZ() */
 
 
+
+/* FUNCTION *******************************************************************/
+/** Composes two filters (with equal sample frequency) into a new one. This
+ *  function mallocs memory space for the coefficients and roots of the new
+ *  filter. If both filters are cascaded
+    \f[
+    H(z)=H_1(z) H_2(z)=\frac{N_1(z) N_2(z)}{D_1(z) D_2(z)}
+    \f]
+ *  the roots of the new filter are valid, if the roots of both filters are.
+ *  If both filters are connected in parallel
+    \f[
+    H(z)=H_1(z)+H_2(z)=\frac{N_1(z) D_2(z)+N_2(z) D_1(z)}{D_1(z) D_2(z)}
+    \f]
+ *  the numerator roots are unknown (\a factor is set to zero).
+ *
+ *  \param dest         Destination filter (output), use filterFree() to free
+ *                      all the associated memory.
+ *  \param pFilter1     Pointer to first filter.
+ *  \param pFilter2     Pointer to second filter.
+ *  \param parallel     If TRUE the filters are connected in parallel, else
+ *                      they are cascaded.
+ *
+ *  \return             See normFilterCoeffs(). In case of a critical error
+ *                      (FLTERR_CRITICAL) no memory is allocated for \p dest.
+ ******************************************************************************/
+static int composeFilter (FLTCOEFF *dest, const FLTCOEFF *pFilter1,
+                          const FLTCOEFF *pFilter2, BOOL parallel)
+{
+    int err;
+    MATHPOLY tmp;
+
+    if (pFilter1->f0 != pFilter2->f0)
+    {
+        DEBUG_LOG ("Sample frequencies of composed filters differ");
+        return EINVAL;
+    } /* if */
+
+    dest->f0 = pFilter1->f0;
+    dest->factor = 0.0;
+    dest->den.degree = pFilter1->den.degree + pFilter2->den.degree;
+    dest->num.degree = pFilter1->num.degree + pFilter2->num.degree;
+
+    if (parallel)
+    {
+        dest->num.degree = MAX (pFilter1->num.degree + pFilter2->den.degree,
+                                pFilter2->num.degree + pFilter1->den.degree);
+    } /* if */
+
+    err = filterMalloc (dest);
+
+    if (err != 0)
+    {
+        return err;
+    } /* if */
+
+    err = mathPolyMul (&dest->den, &pFilter1->den, &pFilter2->den);
+
+    if ((err == 0) && parallel)                  /* N1(z) D2(z) + N2(z) D1(z) */
+    {
+        tmp.degree = pFilter2->num.degree + pFilter1->den.degree;
+        err = mathPolyMallocCoeffs (&tmp);
+
+        if (err == 0)
+        {
+            err = mathPolyMul (&dest->num, &pFilter1->num, &pFilter2->den);
+
+            if (err == 0)
+            {
+                err = mathPolyMul (&tmp, &pFilter2->num, &pFilter1->den);
+            } /* if */
+
+            if (err == 0)
+            {
+                mathPolyAdd (&dest->num, &tmp, 1.0);
+            } /* if */
+
+            mathPolyFree (&tmp);
+        } /* if */
+    } /* if */
+    else if (err == 0)                                        /* N1(z) N2(z) */
+    {
+        err = mathPolyMul (&dest->num, &pFilter1->num, &pFilter2->num);
+
+        if ((err == 0) && (pFilter1->factor != 0.0) && (pFilter2->factor != 0.0))
+        {                                        /* concatenate (valid) roots */
+            memcpy (dest->num.root, pFilter1->num.root,
+                    pFilter1->num.degree * sizeof(dest->num.root[0]));
+            memcpy (dest->num.root + pFilter1->num.degree, pFilter2->num.root,
+                    pFilter2->num.degree * sizeof(dest->num.root[0]));
+            memcpy (dest->den.root, pFilter1->den.root,
+                    pFilter1->den.degree * sizeof(dest->den.root[0]));
+            memcpy (dest->den.root + pFilter1->den.degree, pFilter2->den.root,
+                    pFilter2->den.degree * sizeof(dest->den.root[0]));
+            dest->factor = pFilter1->factor * pFilter2->factor;
+        } /* if */
+    } /* else if */
+
+    if (err == 0)
+    {
+        err = normFilterCoeffs (dest);
+
+        if (!FLTERR_SUCCESS (err))           /* degree changed (or invalid)? */
+        {
+            dest->factor = 0.0;
+        } /* if */
+    } /* if */
+
+    if (FLTERR_CRITICAL (err))
+    {
+        filterFree (dest);
+    } /* if */
+
+    return err;
+} /* composeFilter() */
+
+
 /* EXPORTED FUNCTION DEFINITIONS **********************************************/
 
 
@@ -178,6 +299,7 @@ int filterDuplicate (FLTCOEFF *dest, FLTCOEFF *src)
     int err;
 
     dest->f0 = src->f0;
+    dest->factor = src->factor;
     dest->num.degree = src->num.degree;
     dest->den.degree = src->den.degree;
 
@@ -307,6 +429,8 @@ int normFilterCoeffs (FLTCOEFF *pFilter)
  *  first modifies the denominator coefficients such that \f$den_0=1\f$ is
  *  ensured. At the second step it re-calculates the numerator coefficients in
  *  a way, that the magnitude response at the reference frequency is unity (1).
+ *  Both steps are pure scalings, so coefficients which are exactly zero stay
+ *  zero.
  *
  *  \param pFilter      Pointer to filter.
  *  \param f            Frequency (normalization point).
@@ -351,7 +475,10 @@ int normFilterMagnitude (FLTCOEFF *pFilter, double f, double refgain)
 
     for (i = 0; i <= pFilter->num.degree; i++)  /* scale all numerator coeffs */
     {
-        pFilter->num.coeff[i] *= magnitude;
+        if (pFilter->num.coeff[i] != 0.0)          /* no negative zero (-0.0) */
+        {
+            pFilter->num.coeff[i] *= magnitude;
+        } /* if */
     } /* for */
 
     return filterCheck(pFilter);
@@ -359,6 +486,60 @@ int normFilterMagnitude (FLTCOEFF *pFilter, double f, double refgain)
 
 
 
+/* FUNCTION *******************************************************************/
+/** Cascades two filters (series connection) into a new filter. This function
+ *  mallocs memory space for filter coefficients and roots of the new filter.
+ *  If the roots of both filters are valid, then the roots of the new filter
+ *  are valid too.
+ *
+ *  \param dest         Destination filter (output), use filterFree() to free
+ *                      all the associated memory.
+ *  \param pFilter1     Pointer to first filter.
+ *  \param pFilter2     Pointer to second filter (same sample frequency).
+ *
+ *  \return             - 0 (or GSL_SUCCESS) if okay.
+ *                      - a negative number (typically GSL_CONTINUE) if a
+ *                        coefficient or the degree has changed, but the filter
+ *                        is valid (FLTERR_WARNING).
+ *                      - a positive error number (typically from errno.h or
+ *                        gsl_errno.h) that something is wrong and no
+ *                        filter was created (FLTERR_CRITICAL).
+ ******************************************************************************/
+int filterCascade (FLTCOEFF *dest, const FLTCOEFF *pFilter1,
+                   const FLTCOEFF *pFilter2)
+{
+    return composeFilter (dest, pFilter1, pFilter2, FALSE);
+} /* filterCascade() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Connects two filters in parallel (sums up the outputs) into a new filter.
+ *  This function mallocs memory space for filter coefficients and roots of
+ *  the new filter. The roots of the new filter are invalid (\a factor is
+ *  zero).
+ *
+ *  \param dest         Destination filter (output), use filterFree() to free
+ *                      all the associated memory.
+ *  \param pFilter1     Pointer to first filter.
+ *  \param pFilter2     Pointer to second filter (same sample frequency).
+ *
+ *  \return             - 0 (or GSL_SUCCESS) if okay.
+ *                      - a negative number (typically GSL_CONTINUE) if a
+ *                        coefficient or the degree has changed, but the filter
+ *                        is valid (FLTERR_WARNING).
+ *                      - a positive error number (typically from errno.h or
+ *                        gsl_errno.h) that something is wrong and no
+ *                        filter was created (FLTERR_CRITICAL).
+ ******************************************************************************/
+int filterParallel (FLTCOEFF *dest, const FLTCOEFF *pFilter1,
+                    const FLTCOEFF *pFilter2)
+{
+    return composeFilter (dest, pFilter1, pFilter2, TRUE);
+} /* filterParallel() */
+
+
+
 
 /******************************************************************************/
 /* END OF FILE                                                                */
@@ -0,0 +1,890 @@
+/**
+ * \file        filterSweep.c
+ * \brief       Design-space sweep: generation and evaluation of a grid of
+ *              filter designs on a thread pool.
+ * \copyright   Copyright (C) 2006-2022 Ralf Hoppe <dfcgen@rho62.de>
+ */
+
+
+/* INCLUDE FILES **************************************************************/
+
+#include "mathMisc.h"       /* includes config.h (include before GNU headers) */
+#include "mathFuncs.h"      /* HYPOT() */
+#include "filterSweep.h"
+#include "filterSupport.h"
+#include "filterResponse.h"
+
+#include <errno.h>
+#include <string.h> /* memcpy() */
+#include <gsl/gsl_complex_math.h>
+
+
+
+/* GLOBAL CONSTANT DEFINITIONS ************************************************/
+
+
+/* GLOBAL VARIABLE DEFINITIONS ************************************************/
+
+
+/* LOCAL TYPE DECLARATIONS ****************************************************/
+
+
+/** Passband or stopband of a sweep metric (frequencies in Hz).
+ */
+typedef struct
+{
+    double lower;                                        /**< Lower band edge */
+    double upper;                                        /**< Upper band edge */
+    BOOL pass;                       /**< TRUE on passband, FALSE on stopband */
+} FLTSWEEP_BAND;
+
+
+/** Sort key of filterSweepSort().
+ */
+typedef struct
+{
+    FLTSWEEP_METRIC metric;                                       /**< Metric */
+    BOOL descending;                           /**< TRUE for descending order */
+} FLTSWEEP_SORTKEY;
+
+
+
+/* LOCAL CONSTANT DEFINITIONS *************************************************/
+
+#define FLTSWEEP_POINTS         256 /**< Evaluation points per band (metrics) */
+#define FLTSWEEP_THREADS_MAX    64        /**< Max. threads of the sweep pool */
+#define FLTSWEEP_ITEMS_MAX      (1 << 20)   /**< Max. number of swept designs */
+
+
+/* LOCAL VARIABLE DEFINITIONS *************************************************/
+
+
+/** Names of miscellaneous filter types (indexed by MISCFLT).
+ */
+static const char *sweepMiscNames[MISCFLT_SIZE] =
+{
+    "hilbert", "integrator", "differentiator", "comb", "avgfir", "avgiir",
+    "avgexp"
+};
+
+
+/** Names of linear FIR filter types (indexed by LINFIR_TYPE).
+ */
+static const char *sweepLinFirNames[LINFIR_TYPE_SIZE] =
+{
+    "rect", "cos", "cos2", "gauss", "sqr", "remez", "lsq", "halfband",
+    "nyquist"
+};
+
+
+/** Names of standard IIR filter types (indexed by STDIIR_TYPE).
+ */
+static const char *sweepStdIirNames[STDIIR_TYPE_SIZE] =
+{
+    "butterworth", "chebyshev", "chebyinv", "cauer1", "cauer2", "bessel"
+};
+
+
+/** Names of DSP windows (indexed by LINFIR_DSPWIN).
+ */
+static const char *sweepWindowNames[LINFIR_DSPWIN_SIZE] =
+{
+    "rect", "hamming", "vanhann", "blackman", "kaiser"
+};
+
+
+/** Names of metrics (indexed by FLTSWEEP_METRIC).
+ */
+static const char *sweepMetricNames[FLTSWEEP_METRIC_SIZE] =
+{
+    "ripple", "stopatt", "delay", "macs", "radius"
+};
+
+
+/* LOCAL MACRO DEFINITIONS ****************************************************/
+
+
+/* LOCAL FUNCTION DECLARATIONS ************************************************/
+
+static int sweepTypes (FLTCLASS fltcls);
+static int sweepBands (const DESIGNDLG_COMMON *pDesign, double f0,
+                       double width, FLTSWEEP_BAND band[]);
+static double sweepPoleRadius (const FLTCOEFF *pFilter);
+static void sweepMetrics (const FLTSWEEP *pSweep, FLTSWEEP_ITEM *pItem,
+                          FLTCOEFF *pFilter);
+static void sweepItemGen (gpointer data, gpointer user_data);
+static gint sweepCompare (gconstpointer p1, gconstpointer p2,
+                          gpointer user_data);
+
+
+/* LOCAL FUNCTION DEFINITIONS *************************************************/
+
+
+/* FUNCTION *******************************************************************/
+/** Returns the number of filter types of a filter class.
+ *
+ *  \param fltcls       Filter class.
+ *
+ *  \return             Size of the type enum of \p fltcls (zero if unknown).
+ ******************************************************************************/
+static int sweepTypes (FLTCLASS fltcls)
+{
+    switch (fltcls)
+    {
+        case FLTCLASS_MISC:
+            return MISCFLT_SIZE;
+
+        case FLTCLASS_LINFIR:
+            return LINFIR_TYPE_SIZE;
+
+        case FLTCLASS_STDIIR:
+            return STDIIR_TYPE_SIZE;
+
+        default:
+            return 0;
+    } /* switch */
+} /* sweepTypes() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Builds the passbands and stopbands of a design, which are used for the
+ *  metrics. The transition band of width \p width is centered at the cutoff
+ *  frequency (resp. the band edges), same as in the tolerance scheme of the
+ *  minimum order designs.
+ *
+ *  \param pDesign      Pointer to (common) design data.
+ *  \param f0           Sample frequency.
+ *  \param width        Transition bandwidth.
+ *  \param band         Array of (at least) three elements, which gets the
+ *                      bands.
+ *
+ *  \return             Number of bands (2 or 3), zero if the bands are
+ *                      invalid (e.g. overlapping).
+ ******************************************************************************/
+static int sweepBands (const DESIGNDLG_COMMON *pDesign, double f0,
+                       double width, FLTSWEEP_BAND band[])
+{
+    double f1, f2;
+    int i;
+
+    int bands = 2;
+    double half = 0.5 * width;
+    BOOL pass = TRUE;                                  /* type of lowest band */
+
+    if (width <= 0.0)
+    {
+        return 0;
+    } /* if */
+
+    switch (pDesign->ftr.type)
+    {
+        case FTR_HIGHPASS:
+            pass = FALSE;
+            f1 = pDesign->ftr.fc;
+            break; /* FTR_HIGHPASS */
+
+        case FTR_BANDPASS:
+            pass = FALSE;                                     /* fall through */
+
+        case FTR_BANDSTOP:
+            f1 = pDesign->ftr.fc - 0.5 * pDesign->ftr.bw;
+
+            if (pDesign->ftr.flags & FTRDESIGN_FLAG_CENTER_GEOMETRIC)
+            {
+                f1 = HYPOT (pDesign->ftr.fc, 0.5 * pDesign->ftr.bw) -
+                    0.5 * pDesign->ftr.bw;
+            } /* if */
+
+            f2 = f1 + pDesign->ftr.bw;
+            band[1].upper = f2 - half;
+            band[2].lower = f2 + half;
+            bands = 3;
+            break; /* FTR_BANDPASS, FTR_BANDSTOP */
+
+        case FTR_NON:                                              /* lowpass */
+        default:
+            f1 = pDesign->cutoff;
+            break; /* FTR_NON */
+    } /* switch */
+
+    band[0].lower = 0.0;
+    band[0].upper = f1 - half;
+    band[1].lower = f1 + half;
+    band[bands - 1].upper = 0.5 * f0;
+
+    for (i = 0; i < bands; i++)              /* alternating passband/stopband */
+    {
+        if ((band[i].lower < 0.0) || (band[i].upper <= band[i].lower))
+        {
+            return 0;
+        } /* if */
+
+        band[i].pass = pass;
+        pass = !pass;
+    } /* for */
+
+    return bands;
+} /* sweepBands() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Computes the maximum radius of all poles of a filter in \e Z domain.
+ *
+ *  \param pFilter      Pointer to filter.
+ *
+ *  \return             Maximum pole radius (zero for FIR filters), NaN if
+ *                      the roots of the denominator cannot be found.
+ ******************************************************************************/
+static double sweepPoleRadius (const FLTCOEFF *pFilter)
+{
+    int i, err;
+    MATHPOLY tmp;
+
+    double radius = 0.0;
+
+    if (pFilter->factor != 0.0)                            /* roots are valid */
+    {
+        for (i = 0; i < pFilter->den.degree; i++)
+        {
+            radius = fmax (radius, gsl_complex_abs (pFilter->den.root[i]));
+        } /* for */
+
+        return radius;
+    } /* if */
+
+    for (i = 1; i <= pFilter->den.degree; i++)       /* FIR filter (or z^-n)? */
+    {
+        if (pFilter->den.coeff[i] != 0.0)
+        {
+            break;
+        } /* if */
+    } /* for */
+
+    if (i > pFilter->den.degree)
+    {
+        return 0.0;
+    } /* if */
+
+    tmp.degree = pFilter->den.degree;
+    err = mathPolyMalloc (&tmp);
+
+    if (err == 0)
+    {
+        memcpy (tmp.coeff, pFilter->den.coeff,
+                (1 + tmp.degree) * sizeof(tmp.coeff[0]));
+        err = mathPolyCoeffs2Roots (&tmp);
+
+        for (i = 0; (err == 0) && (i < tmp.degree); i++)
+        {                              /* roots of 1/z polynomial -> Z domain */
+            radius = fmax (radius, 1.0 / gsl_complex_abs (tmp.root[i]));
+        } /* for */
+
+        mathPolyFree (&tmp);
+    } /* if */
+
+    return (err == 0) ? radius : GSL_NAN;
+} /* sweepPoleRadius() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Computes the metrics of a swept design.
+ *
+ *  \param pSweep       Pointer to sweep.
+ *  \param pItem        Pointer to design, which gets the metrics.
+ *  \param pFilter      Pointer to generated filter of \p pItem.
+ *
+ ******************************************************************************/
+static void sweepMetrics (const FLTSWEEP *pSweep, FLTSWEEP_ITEM *pItem,
+                          FLTCOEFF *pFilter)
+{
+    FLTSWEEP_BAND band[3];
+    double f, value;
+    int i, j, bands;
+
+    double passMin = GSL_POSINF, passMax = 0.0, stopMax = 0.0;
+    double delayMin = GSL_POSINF, delayMax = GSL_NEGINF;
+    int macs = 0;
+
+    bands = 0;
+
+    if (pSweep->fltcls != FLTCLASS_MISC)                /* no cutoff for misc */
+    {
+        bands = sweepBands (&pItem->design.all, pSweep->f0, pSweep->width,
+                            band);
+    } /* if */
+
+    for (i = 0; i < bands; i++)
+    {
+        for (j = 0; j < FLTSWEEP_POINTS; j++)
+        {
+            f = band[i].lower +
+                j * (band[i].upper - band[i].lower) / (FLTSWEEP_POINTS - 1);
+            value = filterResponseMagnitude (f, pFilter);
+
+            if (band[i].pass)
+            {
+                passMin = fmin (passMin, value);
+                passMax = fmax (passMax, value);
+                value = filterResponseGroupDelay (f, pFilter);
+                delayMin = fmin (delayMin, value);
+                delayMax = fmax (delayMax, value);
+            } /* if */
+            else
+            {
+                stopMax = fmax (stopMax, value);
+            } /* else */
+        } /* for */
+    } /* for */
+
+    if (bands > 0)
+    {
+        pItem->metric[FLTSWEEP_METRIC_RIPPLE] =
+            20.0 * log10 (passMax / passMin);
+        pItem->metric[FLTSWEEP_METRIC_STOPATT] =
+            20.0 * log10 (passMax / stopMax);
+        pItem->metric[FLTSWEEP_METRIC_DELAY] =                  /* in samples */
+            (delayMax - delayMin) * pSweep->f0;
+    } /* if */
+
+    for (i = 0; i <= pFilter->num.degree; i++)
+    {
+        if (pFilter->num.coeff[i] != 0.0)
+        {
+            ++macs;
+        } /* if */
+    } /* for */
+
+    for (i = 1; i <= pFilter->den.degree; i++)     /* den.coeff[0] normalized */
+    {
+        if (pFilter->den.coeff[i] != 0.0)
+        {
+            ++macs;
+        } /* if */
+    } /* for */
+
+    pItem->metric[FLTSWEEP_METRIC_MACS] = macs;
+    pItem->metric[FLTSWEEP_METRIC_RADIUS] = sweepPoleRadius (pFilter);
+} /* sweepMetrics() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Generates the filter of a swept design and computes its metrics. Used as
+ *  function of a GThreadPool, so it may be called from any thread.
+ *
+ *  \param data         Pointer to design (FLTSWEEP_ITEM).
+ *  \param user_data    Pointer to sweep (FLTSWEEP).
+ *
+ ******************************************************************************/
+static void sweepItemGen (gpointer data, gpointer user_data)
+{
+    FLTCOEFF filter;
+    int i;
+
+    FLTSWEEP_ITEM *pItem = data;
+    const FLTSWEEP *pSweep = user_data;
+
+    for (i = 0; i < FLTSWEEP_METRIC_SIZE; i++)
+    {
+        pItem->metric[i] = GSL_NAN;
+    } /* for */
+
+    filter.f0 = pSweep->f0;
+    pItem->err = GSL_EDOM;
+
+    switch (pSweep->fltcls)
+    {
+        case FLTCLASS_MISC:
+            pItem->err = miscFilterGen (&pItem->design.miscFlt, &filter);
+            break; /* FLTCLASS_MISC */
+
+        case FLTCLASS_LINFIR:           /* even degree on frequency transform */
+            if ((pItem->design.linFir.ftr.type == FTR_NON) ||
+                (pItem->design.linFir.order % 2 == 0))
+            {
+                pItem->err = linFirFilterGenWorker (&pItem->design.linFir,
+                                                    &filter);
+            } /* if */
+
+            break; /* FLTCLASS_LINFIR */
+
+        case FLTCLASS_STDIIR:             /* even degree on bandpass/bandstop */
+            if (((pItem->design.stdIir.ftr.type != FTR_BANDPASS) &&
+                 (pItem->design.stdIir.ftr.type != FTR_BANDSTOP)) ||
+                (pItem->design.stdIir.order % 2 == 0))
+            {
+                pItem->err = stdIirFilterGenWorker (&pItem->design.stdIir,
+                                                    &filter);
+            } /* if */
+
+            break; /* FLTCLASS_STDIIR */
+
+        default:
+            ASSERT (0);
+    } /* switch */
+
+    if (!FLTERR_CRITICAL (pItem->err))
+    {
+        sweepMetrics (pSweep, pItem, &filter);
+        filterFree (&filter);
+    } /* if */
+} /* sweepItemGen() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Compares two swept designs by a metric (for g_qsort_with_data). NaN
+ *  metrics compare greater than all other values, independent of the sort
+ *  direction.
+ *
+ *  \param p1           Pointer to first FLTSWEEP_ITEM.
+ *  \param p2           Pointer to second FLTSWEEP_ITEM.
+ *  \param user_data    Pointer to sort key (FLTSWEEP_SORTKEY).
+ *
+ *  \return             Negative, zero or positive if first design shall be
+ *                      placed before, equal or behind the second.
+ ******************************************************************************/
+static gint sweepCompare (gconstpointer p1, gconstpointer p2,
+                          gpointer user_data)
+{
+    const FLTSWEEP_SORTKEY *pKey = user_data;
+    double v1 = ((const FLTSWEEP_ITEM *)p1)->metric[pKey->metric];
+    double v2 = ((const FLTSWEEP_ITEM *)p2)->metric[pKey->metric];
+
+    if (gsl_isnan (v1) || gsl_isnan (v2))
+    {
+        return gsl_isnan (v1) - gsl_isnan (v2);
+    } /* if */
+
+    if (pKey->descending)
+    {
+        return (v1 < v2) - (v1 > v2);
+    } /* if */
+
+    return (v1 > v2) - (v1 < v2);
+} /* sweepCompare() */
+
+
+
+/* EXPORTED FUNCTION DEFINITIONS **********************************************/
+
+
+/* FUNCTION *******************************************************************/
+/** Creates a sweep over a parameter grid.
+ *
+ *  \param fltcls       Filter class (FLTCLASS_MISC, FLTCLASS_LINFIR or
+ *                      FLTCLASS_STDIIR).
+ *  \param pBase        Pointer to base design, which defines all parameters
+ *                      not in the grid.
+ *  \param pGrid        Pointer to parameter grid.
+ *  \param f0           Sample frequency.
+ *  \param width        Transition bandwidth around cutoff frequency (resp.
+ *                      band edges), which is excluded from the passband and
+ *                      stopband metrics.
+ *  \param ppSweep      Pointer to a buffer which gets the pointer to the new
+ *                      sweep (NULL on error).
+ *
+ *  \return             Zero on success, else an error number (see errno.h or
+ *                      gsl_errno.h for predefined codes).
+ ******************************************************************************/
+int filterSweepNew (FLTCLASS fltcls, const DESIGNDLG *pBase,
+                    const FLTSWEEP_GRID *pGrid, double f0, double width,
+                    FLTSWEEP **ppSweep)
+{
+    FLTSWEEP *pSweep;
+    FLTSWEEP_ITEM *pItem;
+    int i, n, types, windows, orders, cutoffs;
+
+    *ppSweep = NULL;
+
+    if ((sweepTypes (fltcls) == 0) || (f0 < FLT_SAMPLE_MIN) ||
+        (f0 > FLT_SAMPLE_MAX) || (pGrid->types < 0) || (pGrid->orders < 0) ||
+        (pGrid->cutoffs < 0) || (pGrid->windows < 0) ||
+        ((pGrid->windows > 0) && (fltcls != FLTCLASS_LINFIR)) ||
+        ((pGrid->cutoffs > 0) && (fltcls == FLTCLASS_MISC)))
+    {
+        return EINVAL;
+    } /* if */
+
+    if ((pGrid->types == 0) &&                 /* e.g. raw filter (no design) */
+        ((pBase->all.type < 0) || (pBase->all.type >= sweepTypes (fltcls))))
+    {
+        return EINVAL;
+    } /* if */
+
+    for (i = 0; i < pGrid->types; i++)
+    {
+        if ((pGrid->pType[i] < 0) || (pGrid->pType[i] >= sweepTypes (fltcls)))
+        {
+            return EINVAL;
+        } /* if */
+    } /* for */
+
+    for (i = 0; i < pGrid->windows; i++)
+    {
+        if ((pGrid->pWindow[i] < 0) ||
+            (pGrid->pWindow[i] >= LINFIR_DSPWIN_SIZE))
+        {
+            return EINVAL;
+        } /* if */
+    } /* for */
+
+    for (i = 0; i < pGrid->orders; i++)
+    {
+        if ((pGrid->pOrder[i] < 1) || (pGrid->pOrder[i] > FLT_DEGREE_MAX))
+        {
+            return EINVAL;
+        } /* if */
+    } /* for */
+
+    for (i = 0; i < pGrid->cutoffs; i++)
+    {
+        if ((pGrid->pCutoff[i] <= 0.0) || (pGrid->pCutoff[i] >= 0.5 * f0))
+        {
+            return EINVAL;
+        } /* if */
+    } /* for */
+
+    types = MAX (pGrid->types, 1);       /* zero elements keep the base value */
+    windows = MAX (pGrid->windows, 1);
+    orders = MAX (pGrid->orders, 1);
+    cutoffs = MAX (pGrid->cutoffs, 1);
+
+    if ((double) types * windows * orders * cutoffs > FLTSWEEP_ITEMS_MAX)
+    {
+        return EINVAL;
+    } /* if */
+
+    pSweep = g_malloc (sizeof(FLTSWEEP));
+
+    if (pSweep == NULL)
+    {
+        return ENOMEM;
+    } /* if */
+
+    pSweep->fltcls = fltcls;
+    pSweep->f0 = f0;
+    pSweep->width = width;
+    pSweep->items = types * windows * orders * cutoffs;
+    pSweep->pItem = g_malloc (pSweep->items * sizeof(FLTSWEEP_ITEM));
+
+    if (pSweep->pItem == NULL)
+    {
+        g_free (pSweep);
+        return ENOMEM;
+    } /* if */
+
+    for (i = 0; i < pSweep->items; i++)          /* cartesian product of grid */
+    {
+        pItem = &pSweep->pItem[i];
+        pItem->design = *pBase;
+        pItem->err = 0;
+        n = i;
+
+        if (pGrid->cutoffs > 0)
+        {
+            if (pItem->design.all.ftr.type == FTR_NON)
+            {
+                pItem->design.all.cutoff = pGrid->pCutoff[n % cutoffs];
+            } /* if */
+            else
+            {
+                pItem->design.all.ftr.fc = pGrid->pCutoff[n % cutoffs];
+            } /* else */
+        } /* if */
+
+        n /= cutoffs;
+
+        if (pGrid->orders > 0)
+        {
+            pItem->design.all.order = pGrid->pOrder[n % orders];
+        } /* if */
+
+        n /= orders;
+
+        if (pGrid->windows > 0)
+        {
+            pItem->design.linFir.dspwin = pGrid->pWindow[n % windows];
+        } /* if */
+
+        n /= windows;
+
+        if (pGrid->types > 0)
+        {
+            pItem->design.all.type = pGrid->pType[n];
+        } /* if */
+
+        for (n = 0; n < FLTSWEEP_METRIC_SIZE; n++)
+        {
+            pItem->metric[n] = GSL_NAN;
+        } /* for */
+    } /* for */
+
+    *ppSweep = pSweep;
+
+    return 0;
+} /* filterSweepNew() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Generates all designs of a sweep and evaluates their metrics. The designs
+ *  are distributed over a GThreadPool (one thread per processor).
+ *
+ *  \param pSweep       Pointer to sweep.
+ *
+ *  \return             Number of designs which could not be generated
+ *                      (see member \a err of FLTSWEEP_ITEM).
+ ******************************************************************************/
+int filterSweepRun (FLTSWEEP *pSweep)
+{
+    GThreadPool *pool;
+    gsl_error_handler_t *oldHandler;
+    int i, procs;
+
+    int failed = 0;
+
+    procs = CLAMP (g_get_num_processors (), 1, FLTSWEEP_THREADS_MAX);
+    procs = MIN (procs, MAX (pSweep->items, 1));
+
+    /* The GSL error handler is a global, so switch it off once for all
+     * threads (the workers use generators which keep it untouched).
+     */
+    oldHandler = gsl_set_error_handler_off ();
+    pool = g_thread_pool_new (sweepItemGen, pSweep, procs, FALSE, NULL);
+
+    for (i = 0; i < pSweep->items; i++)
+    {
+        if ((pool == NULL) ||
+            !g_thread_pool_push (pool, &pSweep->pItem[i], NULL))
+        {
+            sweepItemGen (&pSweep->pItem[i], pSweep);           /* sequential */
+        } /* if */
+    } /* for */
+
+    if (pool != NULL)
+    {
+        g_thread_pool_free (pool, FALSE, TRUE);         /* wait for all tasks */
+    } /* if */
+
+    gsl_set_error_handler (oldHandler);
+
+    for (i = 0; i < pSweep->items; i++)
+    {
+        if (FLTERR_CRITICAL (pSweep->pItem[i].err))
+        {
+            ++failed;
+        } /* if */
+    } /* for */
+
+    return failed;
+} /* filterSweepRun() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Sorts the designs of a sweep by a metric. Designs with unavailable metric
+ *  (NaN) are sorted to the end.
+ *
+ *  \param pSweep       Pointer to sweep.
+ *  \param metric       Sort key.
+ *  \param descending   If TRUE the designs are sorted in descending order,
+ *                      else in ascending order.
+ *
+ ******************************************************************************/
+void filterSweepSort (FLTSWEEP *pSweep, FLTSWEEP_METRIC metric,
+                      BOOL descending)
+{
+    FLTSWEEP_SORTKEY key;
+
+    ASSERT ((metric >= 0) && (metric < FLTSWEEP_METRIC_SIZE));
+
+    key.metric = metric;
+    key.descending = descending;
+    g_qsort_with_data (pSweep->pItem, pSweep->items, sizeof(FLTSWEEP_ITEM),
+                       sweepCompare, &key);            /* stable (merge sort) */
+} /* filterSweepSort() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Writes the designs of a sweep as a table (one row per design) to a stream.
+ *  Unavailable values are written as \c - in plain text and as empty fields
+ *  in CSV format.
+ *
+ *  \param pSweep       Pointer to sweep.
+ *  \param stream       Output stream.
+ *  \param csv          If TRUE comma separated values are written, else an
+ *                      aligned plain text table.
+ *
+ *  \return             Zero on success, else an error number from errno.h.
+ ******************************************************************************/
+int filterSweepWrite (const FLTSWEEP *pSweep, FILE *stream, BOOL csv)
+{
+    const FLTSWEEP_ITEM *pItem;
+    const char *name;
+    double value;
+    int i, m;
+
+    const char *sep = csv ? "," : " ";
+    const char *none = csv ? "" : "-";
+
+    if (csv)
+    {
+        fprintf (stream, "type,order,cutoff,window,error");
+    } /* if */
+    else
+    {
+        fprintf (stream, "%-14s %5s %12s %-8s %5s", "type", "order", "cutoff",
+                 "window", "error");
+    } /* else */
+
+    for (m = 0; m < FLTSWEEP_METRIC_SIZE; m++)
+    {
+        fprintf (stream, csv ? "%s%s" : "%s%12s", sep, sweepMetricNames[m]);
+    } /* for */
+
+    fputc ('\n', stream);
+
+    for (i = 0; i < pSweep->items; i++)
+    {
+        pItem = &pSweep->pItem[i];
+        name = filterSweepTypeName (pSweep->fltcls, pItem->design.all.type);
+        fprintf (stream, csv ? "%s%s%d" : "%-14s%s%5d", name ? name : none,
+                 sep, pItem->design.all.order);
+
+        if (pSweep->fltcls == FLTCLASS_MISC)
+        {
+            fprintf (stream, csv ? "%s%s" : "%s%12s", sep, none);
+        } /* if */
+        else
+        {
+            value = (pItem->design.all.ftr.type == FTR_NON) ?
+                pItem->design.all.cutoff : pItem->design.all.ftr.fc;
+            fprintf (stream, csv ? "%s%.10G" : "%s%12.6G", sep, value);
+        } /* else */
+
+        name = NULL;
+
+        if (pSweep->fltcls == FLTCLASS_LINFIR)
+        {
+            name = filterSweepWindowName (pItem->design.linFir.dspwin);
+        } /* if */
+
+        fprintf (stream, csv ? "%s%s%s%d" : "%s%-8s%s%5d", sep,
+                 name ? name : none, sep, pItem->err);
+
+        for (m = 0; m < FLTSWEEP_METRIC_SIZE; m++)
+        {
+            value = pItem->metric[m];
+
+            if (gsl_isnan (value))
+            {
+                fprintf (stream, csv ? "%s%s" : "%s%12s", sep, none);
+            } /* if */
+            else
+            {
+                fprintf (stream, csv ? "%s%.10G" : "%s%12.6G", sep, value);
+            } /* else */
+        } /* for */
+
+        fputc ('\n', stream);
+    } /* for */
+
+    return ferror (stream) ? EIO : 0;
+} /* filterSweepWrite() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Returns the (command line) name of a filter type.
+ *
+ *  \param fltcls       Filter class.
+ *  \param type         Filter type (type enum of the filter class).
+ *
+ *  \return             Name of filter type, NULL if unknown.
+ ******************************************************************************/
+const char *filterSweepTypeName (FLTCLASS fltcls, int type)
+{
+    if ((type < 0) || (type >= sweepTypes (fltcls)))
+    {
+        return NULL;
+    } /* if */
+
+    switch (fltcls)
+    {
+        case FLTCLASS_MISC:
+            return sweepMiscNames[type];
+
+        case FLTCLASS_LINFIR:
+            return sweepLinFirNames[type];
+
+        default:
+            return sweepStdIirNames[type];
+    } /* switch */
+} /* filterSweepTypeName() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Returns the (command line) name of a DSP window of linear FIR filters.
+ *
+ *  \param dspwin       DSP window.
+ *
+ *  \return             Name of window, NULL if unknown.
+ ******************************************************************************/
+const char *filterSweepWindowName (LINFIR_DSPWIN dspwin)
+{
+    if ((dspwin < 0) || (dspwin >= LINFIR_DSPWIN_SIZE))
+    {
+        return NULL;
+    } /* if */
+
+    return sweepWindowNames[dspwin];
+} /* filterSweepWindowName() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Returns the (command line) name of a metric.
+ *
+ *  \param metric       Metric.
+ *
+ *  \return             Name of metric, NULL if unknown.
+ ******************************************************************************/
+const char *filterSweepMetricName (FLTSWEEP_METRIC metric)
+{
+    if ((metric < 0) || (metric >= FLTSWEEP_METRIC_SIZE))
+    {
+        return NULL;
+    } /* if */
+
+    return sweepMetricNames[metric];
+} /* filterSweepMetricName() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Free's a sweep.
+ *
+ *  \param pSweep       Pointer to sweep, formerly created by
+ *                      filterSweepNew().
+ *
+ ******************************************************************************/
+void filterSweepFree (FLTSWEEP *pSweep)
+{
+    if (pSweep != NULL)
+    {
+        g_free (pSweep->pItem);
+        g_free (pSweep);
+    } /* if */
+} /* filterSweepFree() */
+
+
+
+/******************************************************************************/
+/* END OF FILE                                                                */
+/******************************************************************************/
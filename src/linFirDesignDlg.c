@@ -16,6 +16,8 @@
 #include "dialogSupport.h"
 #include "linFirDesignDlg.h"
 
+#include <gsl/gsl_errno.h> /* GSL_ETOL */
+
 
 /* GLOBAL CONSTANT DEFINITIONS ************************************************/
 
@@ -65,12 +67,19 @@ typedef struct
 #define LINFIRDLG_ENTRY_CUTOFF  "entryCutF"
 #define LINFIRDLG_ENTRY_SAMPLE  "entrySampleF"
 #define LINFIRDLG_SPIN_DEGREE   "spinDegree"
+#define LINFIRDLG_CHKBTN_MINORDER "checkMinOrder"
 #define LINFIRDLG_ENTRY_KAISER  "entryKaiser"
+#define LINFIRDLG_FRAME_DSPWIN  "frameDspWin"
+#define LINFIRDLG_FRAME_SCHEME  "frameTolerance"
+#define LINFIRDLG_ENTRY_WIDTH   "entryTransWidth"
+#define LINFIRDLG_ENTRY_RIPPLE  "entryRipple"
+#define LINFIRDLG_ENTRY_MINATT  "entryMinAtt"
 
 #define LINFIRDLG_UNIT_CUTOFF   "unitCutF"
 #define LINFIRDLG_UNIT_SAMPLE   "unitSampleF"
 #define LINFIRDLG_UNIT_CENTER   "unitCenterF"
 #define LINFIRDLG_UNIT_BANDW    "unitBandwidth"
+#define LINFIRDLG_UNIT_WIDTH    "unitTransWidth"
 
 
 /* LOCAL VARIABLE DEFINITIONS *************************************************/
@@ -84,7 +93,11 @@ static LINFIRDLG_CHAR linFirDlgChar[LINFIR_TYPE_SIZE] =
     [LINFIR_TYPE_COS] = {LINFIR_TYPE_COS,   NULL, N_("Cosine")},
     [LINFIR_TYPE_COS2] = {LINFIR_TYPE_COS2,  NULL, N_("Squared cosine")},
     [LINFIR_TYPE_GAUSS] = {LINFIR_TYPE_GAUSS, NULL, N_("Gaussian")},
-    [LINFIR_TYPE_SQR] = {LINFIR_TYPE_SQR,   NULL, N_("Squared 1st order")}
+    [LINFIR_TYPE_SQR] = {LINFIR_TYPE_SQR,   NULL, N_("Squared 1st order")},
+    [LINFIR_TYPE_REMEZ] = {LINFIR_TYPE_REMEZ, NULL, N_("Equiripple (Parks-McClellan)")},
+    [LINFIR_TYPE_LSQ] = {LINFIR_TYPE_LSQ,   NULL, N_("Least-squares")},
+    [LINFIR_TYPE_HALFBAND] = {LINFIR_TYPE_HALFBAND, NULL, N_("Half-band")},
+    [LINFIR_TYPE_NYQUIST] = {LINFIR_TYPE_NYQUIST, NULL, N_("Nyquist(M), M by cutoff")}
 }; /* linFirDlgChar[] */
 
 
@@ -115,13 +128,46 @@ static const gboolean ftrEntry[FTR_SIZE][5] =
 
 /* LOCAL FUNCTION DECLARATIONS ************************************************/
 
+static void toleranceSchemeChanged (GtkToggleButton *button, gpointer user_data);
 static void filterWindowChanged (GtkRadioButton* radiobutton, gpointer user_data);
 static void transformTypeChanged (GtkComboBox *combobox, gpointer user_data);
+static int linFirDlgFilterGen (DESIGNDLG *pDesign, FLTCOEFF *pFilter);
+static int linFirDlgMinOrderGen (DESIGNDLG *pDesign, FLTCOEFF *pFilter);
 
 
 /* LOCAL FUNCTION DEFINITIONS *************************************************/
 
 
+/* FUNCTION *******************************************************************/
+/** This function is called if the equiripple or least-squares characteristic
+ *  or the minimum order check button changes (\e toggle event). All need the
+ *  tolerance scheme, and optimal designs use it instead of a DSP window.
+ *
+ *  \param button       Toggle button which changes the state.
+ *  \param user_data    User data set when the signal handler was connected
+ *                      (unused).
+ *
+ ******************************************************************************/
+static void toleranceSchemeChanged (GtkToggleButton *button, gpointer user_data)
+{
+    GtkWidget *widget = GTK_WIDGET (button);
+    gboolean optimal = gtk_toggle_button_get_active (
+        GTK_TOGGLE_BUTTON (linFirDlgChar[LINFIR_TYPE_REMEZ].btn)) ||
+        gtk_toggle_button_get_active (
+            GTK_TOGGLE_BUTTON (linFirDlgChar[LINFIR_TYPE_LSQ].btn));
+    gboolean minOrder = gtk_toggle_button_get_active (
+        GTK_TOGGLE_BUTTON (lookup_widget (widget, LINFIRDLG_CHKBTN_MINORDER)));
+
+    gtk_widget_set_sensitive (lookup_widget (widget, LINFIRDLG_FRAME_SCHEME),
+                              optimal || minOrder);
+    gtk_widget_set_sensitive (lookup_widget (widget, LINFIRDLG_FRAME_DSPWIN),
+                              !optimal);
+    gtk_widget_set_sensitive (lookup_widget (widget, LINFIRDLG_SPIN_DEGREE),
+                              !minOrder);
+} /* toleranceSchemeChanged() */
+
+
+
 /* FUNCTION *******************************************************************/
 /** This function is called if the DSP window type changes (\e toggle event
  *  from radio button).
@@ -201,6 +247,38 @@ static void transformTypeChanged (GtkComboBox *combobox, gpointer user_data)
 
 
 
+/* FUNCTION *******************************************************************/
+/** Filter generator of the dialog for dfcPrjFilterGen(), which calls
+ *  linFirFilterGen().
+ *
+ *  \param pDesign      Pointer to design data (member \a linFir is used).
+ *  \param pFilter      Pointer to buffer which gets the generated filter.
+ *
+ *  \return             Return code of linFirFilterGen().
+ ******************************************************************************/
+static int linFirDlgFilterGen (DESIGNDLG *pDesign, FLTCOEFF *pFilter)
+{
+    return linFirFilterGen (&pDesign->linFir, pFilter);
+} /* linFirDlgFilterGen() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Filter generator of the dialog for dfcPrjFilterGen(), which calls
+ *  linFirFilterMinOrderGen().
+ *
+ *  \param pDesign      Pointer to design data (member \a linFir is used).
+ *  \param pFilter      Pointer to buffer which gets the generated filter.
+ *
+ *  \return             Return code of linFirFilterMinOrderGen().
+ ******************************************************************************/
+static int linFirDlgMinOrderGen (DESIGNDLG *pDesign, FLTCOEFF *pFilter)
+{
+    return linFirFilterMinOrderGen (&pDesign->linFir, pFilter);
+} /* linFirDlgMinOrderGen() */
+
+
+
 /* EXPORTED FUNCTION DEFINITIONS **********************************************/
 
 
@@ -413,12 +491,18 @@ void linFirDesignDlgCreate (GtkWidget *topWidget, GtkWidget *boxDesignDlg,
     gtk_widget_set_halign (label, GTK_ALIGN_END);
     gtk_label_set_mnemonic_widget (GTK_LABEL (label), widget);
 
+    widget = gtk_check_button_new_with_mnemonic (_("_Min."));
+    gtk_grid_attach (GTK_GRID (table), widget, 2, 0, 1, 1);
+    gtk_widget_set_tooltip_text (widget, _("Minimum degree which meets the tolerance scheme"));
+    GLADE_HOOKUP_OBJECT (topWidget, widget, LINFIRDLG_CHKBTN_MINORDER);
+
 
     /* DSP window
      */
     frame = gtk_frame_new (NULL);
     gtk_grid_attach (GTK_GRID (linFirDesignDlgMain), frame, 1, 1, 1, 1);
     gtk_container_set_border_width (GTK_CONTAINER (frame), 6);
+    GLADE_HOOKUP_OBJECT (topWidget, frame, LINFIRDLG_FRAME_DSPWIN);
 
     label = gtk_label_new (_("<b>Window</b>"));
     gtk_frame_set_label_widget (GTK_FRAME (frame), label);
@@ -459,8 +543,89 @@ void linFirDesignDlgCreate (GtkWidget *topWidget, GtkWidget *boxDesignDlg,
     gtk_widget_set_halign (label, GTK_ALIGN_END);
     gtk_label_set_mnemonic_widget (GTK_LABEL (label), widget);
 
+
+    /* Tolerance scheme (equiripple design, minimum order)
+     */
+    frame = gtk_frame_new (NULL);
+    gtk_grid_attach (GTK_GRID (linFirDesignDlgMain), frame, 1, 2, 1, 1);
+    gtk_container_set_border_width (GTK_CONTAINER (frame), 6);
+    gtk_widget_set_sensitive (frame, FALSE);
+    GLADE_HOOKUP_OBJECT (topWidget, frame, LINFIRDLG_FRAME_SCHEME);
+
+    label = gtk_label_new (_("<b>Tolerance</b>"));
+    gtk_frame_set_label_widget (GTK_FRAME (frame), label);
+    gtk_label_set_use_markup (GTK_LABEL (label), TRUE);
+
+    table = gtk_grid_new ();                /* gtk_table_new (3, 3, FALSE); */
+    gtk_container_add (GTK_CONTAINER (frame), table);
+    gtk_container_set_border_width (GTK_CONTAINER (table), 6);
+    gtk_widget_set_margin_start (table, GUI_INDENT_CHILD_PIXEL);
+    gtk_grid_set_row_spacing (GTK_GRID (table), 6);
+    gtk_grid_set_column_spacing (GTK_GRID (table), 6);
+
+    widget = gtk_entry_new ();                        /* transition bandwidth */
+    gtk_entry_set_activates_default (GTK_ENTRY (widget), TRUE);
+    gtk_grid_attach (GTK_GRID (table), widget, 1, 0, 1, 1);
+    gtk_widget_set_tooltip_text (widget, _("Width of transition band(s)"));
+    gtk_entry_set_width_chars (GTK_ENTRY (widget), GUI_ENTRY_WIDTH_CHARS);
+    GLADE_HOOKUP_OBJECT (topWidget, widget, LINFIRDLG_ENTRY_WIDTH);
+
+    label = gtk_label_new_with_mnemonic (_("_Transition"));
+    gtk_grid_attach (GTK_GRID (table), label, 0, 0, 1, 1);
+    gtk_widget_set_halign (label, GTK_ALIGN_END);
+    gtk_label_set_mnemonic_widget (GTK_LABEL (label), widget);
+
+    label = gtk_label_new (NULL);
+    gtk_grid_attach (GTK_GRID (table), label, 2, 0, 1, 1);
+    gtk_widget_set_halign (label, GTK_ALIGN_START);
+    GLADE_HOOKUP_OBJECT (topWidget, label, LINFIRDLG_UNIT_WIDTH);
+
+    widget = gtk_entry_new ();                 /* passband ripple attenuation */
+    gtk_entry_set_activates_default (GTK_ENTRY (widget), TRUE);
+    gtk_grid_attach (GTK_GRID (table), widget, 1, 1, 1, 1);
+    gtk_widget_set_tooltip_text (widget, _("Passband ripple in dB"));
+    gtk_entry_set_width_chars (GTK_ENTRY (widget), GUI_ENTRY_WIDTH_CHARS);
+    GLADE_HOOKUP_OBJECT (topWidget, widget, LINFIRDLG_ENTRY_RIPPLE);
+
+    label = gtk_label_new_with_mnemonic (_("Ripple"));
+    gtk_grid_attach (GTK_GRID (table), label, 0, 1, 1, 1);
+    gtk_widget_set_halign (label, GTK_ALIGN_END);
+    gtk_label_set_mnemonic_widget (GTK_LABEL (label), widget);
+
+    label = gtk_label_new ("dB");
+    gtk_grid_attach (GTK_GRID (table), label, 2, 1, 1, 1);
+    gtk_widget_set_halign (label, GTK_ALIGN_START);
+
+    widget = gtk_entry_new ();                /* minimum stopband attenuation */
+    gtk_entry_set_activates_default (GTK_ENTRY (widget), TRUE);
+    gtk_grid_attach (GTK_GRID (table), widget, 1, 2, 1, 1);
+    gtk_widget_set_tooltip_text (widget, _("Stopband attenuation in dB"));
+    gtk_entry_set_width_chars (GTK_ENTRY (widget), GUI_ENTRY_WIDTH_CHARS);
+    GLADE_HOOKUP_OBJECT (topWidget, widget, LINFIRDLG_ENTRY_MINATT);
+
+    label = gtk_label_new_with_mnemonic (_("Stop"));
+    gtk_grid_attach (GTK_GRID (table), label, 0, 2, 1, 1);
+    gtk_widget_set_halign (label, GTK_ALIGN_END);
+    gtk_label_set_mnemonic_widget (GTK_LABEL (label), widget);
+
+    label = gtk_label_new ("dB");
+    gtk_grid_attach (GTK_GRID (table), label, 2, 2, 1, 1);
+    gtk_widget_set_halign (label, GTK_ALIGN_START);
+
     /* Final
      */
+    g_signal_connect ((gpointer) linFirDlgChar[LINFIR_TYPE_REMEZ].btn, "toggled",
+                      G_CALLBACK (toleranceSchemeChanged),
+                      NULL);
+
+    g_signal_connect ((gpointer) linFirDlgChar[LINFIR_TYPE_LSQ].btn, "toggled",
+                      G_CALLBACK (toleranceSchemeChanged),
+                      NULL);
+
+    g_signal_connect ((gpointer) lookup_widget (topWidget, LINFIRDLG_CHKBTN_MINORDER),
+                      "toggled", G_CALLBACK (toleranceSchemeChanged),
+                      NULL);
+
     g_signal_connect ((gpointer) comboFtr, "changed",
                       G_CALLBACK (transformTypeChanged),
                       NULL);
@@ -498,6 +663,8 @@ void linFirDesignDlgPreset (GtkWidget *topWidget, const LINFIR_DESIGN *pDesign,
                         pPrefs->frequUnit.name);
     gtk_label_set_text (GTK_LABEL (lookup_widget (topWidget, LINFIRDLG_UNIT_BANDW)),
                         pPrefs->frequUnit.name);
+    gtk_label_set_text (GTK_LABEL (lookup_widget (topWidget, LINFIRDLG_UNIT_WIDTH)),
+                        pPrefs->frequUnit.name);
 
     gtk_toggle_button_set_active (GTK_TOGGLE_BUTTON (
                                       linFirDlgChar[pDesign->type].btn), TRUE);
@@ -510,6 +677,14 @@ void linFirDesignDlgPreset (GtkWidget *topWidget, const LINFIR_DESIGN *pDesign,
         dlgSetDouble (topWidget, LINFIRDLG_ENTRY_KAISER, 1.0, pDesign->winparm);
     } /* if */
 
+    if (LINFIR_TYPE_IS_OPTIMAL (pDesign->type))           /* tolerance scheme */
+    {
+        dlgSetDouble (topWidget, LINFIRDLG_ENTRY_WIDTH,
+                      pPrefs->frequUnit.multiplier, pDesign->width);
+        dlgSetDouble (topWidget, LINFIRDLG_ENTRY_RIPPLE, 1.0, pDesign->ripple);
+        dlgSetDouble (topWidget, LINFIRDLG_ENTRY_MINATT, 1.0, pDesign->minatt);
+    } /* if */
+
     gtk_spin_button_set_value (GTK_SPIN_BUTTON (lookup_widget (topWidget, LINFIRDLG_SPIN_DEGREE)),
                                pDesign->order);                     /* degree */
 
@@ -572,6 +747,13 @@ void linFirDesignDlgDestroy (GtkWidget *topWidget)
         GLADE_HOOKUP_OBJECT_NO_REF (topWidget, NULL, LINFIRDLG_ENTRY_SAMPLE);
         GLADE_HOOKUP_OBJECT_NO_REF (topWidget, NULL, LINFIRDLG_SPIN_DEGREE);
         GLADE_HOOKUP_OBJECT_NO_REF (topWidget, NULL, LINFIRDLG_ENTRY_KAISER);
+        GLADE_HOOKUP_OBJECT_NO_REF (topWidget, NULL, LINFIRDLG_FRAME_DSPWIN);
+        GLADE_HOOKUP_OBJECT_NO_REF (topWidget, NULL, LINFIRDLG_FRAME_SCHEME);
+        GLADE_HOOKUP_OBJECT_NO_REF (topWidget, NULL, LINFIRDLG_CHKBTN_MINORDER);
+        GLADE_HOOKUP_OBJECT_NO_REF (topWidget, NULL, LINFIRDLG_ENTRY_WIDTH);
+        GLADE_HOOKUP_OBJECT_NO_REF (topWidget, NULL, LINFIRDLG_ENTRY_RIPPLE);
+        GLADE_HOOKUP_OBJECT_NO_REF (topWidget, NULL, LINFIRDLG_ENTRY_MINATT);
+        GLADE_HOOKUP_OBJECT_NO_REF (topWidget, NULL, LINFIRDLG_UNIT_WIDTH);
 
         GLADE_HOOKUP_OBJECT_NO_REF(topWidget, NULL, LINFIRDLG_WIDGET_MAIN);
 
@@ -623,6 +805,8 @@ int linFirDesignDlgApply (GtkWidget *topWidget, const CFG_DESKTOP* pPrefs)
 
     int err = INT_MAX;
     LINFIR_DESIGN design = {LINFIR_TYPE_SIZE - 1, 0};        /* preset design */
+    gboolean minOrder = gtk_toggle_button_get_active (
+        GTK_TOGGLE_BUTTON (lookup_widget (topWidget, LINFIRDLG_CHKBTN_MINORDER)));
 
     while ((design.type > 0) &&  /* search active characteristic radio button */
            !gtk_toggle_button_get_active (
@@ -659,7 +843,7 @@ int linFirDesignDlgApply (GtkWidget *topWidget, const CFG_DESKTOP* pPrefs)
             design.ftr.type = idx;
         } /* else */
 
-        if (ftrEntry[design.ftr.type][4] && GSL_IS_ODD(design.order))
+        if (ftrEntry[design.ftr.type][4] && GSL_IS_ODD(design.order) && !minOrder)
         {
             dlgError(topWidget, _("Degree must be even for frequency transformation."));
             return INT_MAX;
@@ -705,7 +889,24 @@ int linFirDesignDlgApply (GtkWidget *topWidget, const CFG_DESKTOP* pPrefs)
             } /* if */
         } /* if */
 
-        if (design.dspwin == LINFIR_DSPWIN_KAISER)
+        if (LINFIR_TYPE_IS_OPTIMAL (design.type) || minOrder)   /* tolerances */
+        {
+            if (!dlgGetDouble (topWidget, LINFIRDLG_ENTRY_WIDTH,
+                               FLT_SAMPLE_MIN / 2, FLT_SAMPLE_MAX / 2,
+                               pPrefs->frequUnit.multiplier, &design.width) ||
+                !dlgGetDouble (topWidget, LINFIRDLG_ENTRY_RIPPLE,
+                               LINFIR_RIPPLE_MIN, LINFIR_RIPPLE_MAX, 1.0,
+                               &design.ripple) ||
+                !dlgGetDouble (topWidget, LINFIRDLG_ENTRY_MINATT,
+                               LINFIR_STOPATT_MIN, LINFIR_STOPATT_MAX, 1.0,
+                               &design.minatt))
+            {
+                return INT_MAX;
+            } /* if */
+        } /* if */
+
+        if (!LINFIR_TYPE_IS_OPTIMAL (design.type) &&
+            (design.dspwin == LINFIR_DSPWIN_KAISER))
         {
             if (!dlgGetDouble (topWidget, LINFIRDLG_ENTRY_KAISER,
                                2.0, 10.0, 1.0, &design.winparm))
@@ -714,7 +915,31 @@ int linFirDesignDlgApply (GtkWidget *topWidget, const CFG_DESKTOP* pPrefs)
             } /* if */
         } /* if */
 
-        err = linFirFilterGen (&design, &filter);  /* generate the FIR filter */
+        if (minOrder)            /* search minimum order for tolerance scheme */
+        {
+            err = dfcPrjFilterGen (FLTCLASS_LINFIR, linFirDlgMinOrderGen,
+                                   (DESIGNDLG *)&design, &filter);
+
+            if (err == GSL_ETOL)
+            {
+                dlgError (topWidget, _("No degree up to %d meets the tolerance"
+                                       " scheme."), FLT_DEGREE_MAX);
+                return INT_MAX;
+            } /* if */
+
+            if (!FLTERR_CRITICAL (err))
+            {
+                gtk_spin_button_set_value (
+                    GTK_SPIN_BUTTON (lookup_widget (topWidget, LINFIRDLG_SPIN_DEGREE)),
+                    design.order);
+            } /* if */
+        } /* if */
+        else
+        {
+            err = dfcPrjFilterGen (FLTCLASS_LINFIR,    /* generate FIR filter */
+                                   linFirDlgFilterGen,
+                                   (DESIGNDLG *)&design, &filter);
+        } /* else */
 
         if (!FLTERR_CRITICAL (err))
         {
@@ -12,6 +12,10 @@
 #include "linFirFilter.h"
 #include "filterSupport.h"
 #include "filterResponse.h"
+#include "filterRemez.h"
+
+#include <string.h> /* memcpy() */
+#include <gsl/gsl_fft_halfcomplex.h>
 
 
 
@@ -62,9 +66,24 @@ typedef double (*LINFIR_FCORR_FUNC)(double x);
 typedef double (*LINFIR_WINDOW_FUNC)(int step, int degree, double param);
 
 
+/** Candidate of the minimum order search (see linFirFilterMinOrderGen()).
+ */
+typedef struct
+{
+    LINFIR_DESIGN design;        /**< Design data (with order of candidate) */
+    FLTCOEFF filter;      /**< Generated filter (valid if \a passed is TRUE) */
+    int err;                           /**< Return code of linFirFilterGen() */
+    BOOL passed;       /**< TRUE if the filter meets the tolerance scheme */
+} LINFIR_CANDIDATE;
+
+
 
 /* LOCAL CONSTANT DEFINITIONS *************************************************/
 
+#define LINFIR_SCHEME_DENSITY   32  /**< Check points per coefficient and f0 */
+#define LINFIR_CANDIDATES_MAX   16 /**< Max. candidates evaluated in parallel */
+#define LINFIR_LSQ_TRANSWEIGHT  1E-3 /**< Relative weight of transition bands */
+
 
 /* LOCAL VARIABLE DEFINITIONS *************************************************/
 
@@ -83,16 +102,21 @@ typedef double (*LINFIR_WINDOW_FUNC)(int step, int degree, double param);
  *
  ******************************************************************************/
 #define LINFIR_ERROR_RET(pFilter, cond, string) \
-    ERROR_RET_IF(cond, string, filterFree (pFilter); gsl_set_error_handler (oldHandler))
+    ERROR_RET_IF(cond, string, filterFree (pFilter))
 
 
 /* LOCAL FUNCTION DECLARATIONS ************************************************/
 
+static void linFirMirror (MATHPOLY *poly);
+static void linFirWindow (MATHPOLY *poly, int last, LINFIR_DSPWIN dspwin,
+                          double winparm);
 static int genRectangularSystem (double x, MATHPOLY *poly);
 static int genGaussianSystem (double x, MATHPOLY *poly);
 static int genCosineSystem (double x, MATHPOLY *poly);
 static int genCosine2System (double x, MATHPOLY *poly);
 static int genSquaredSystem (double x, MATHPOLY *poly);
+static int genNyquistSystem (double x, MATHPOLY *poly);
+static void linFirNyquistCutoff (LINFIR_DESIGN *pDesign, double f0);
 static double corrRectangularCutoff (double fc);
 static double corrGaussianCutoff (double fc);
 static double corrCosineCutoff (double fc);
@@ -105,6 +129,18 @@ static double firWinVanHann (int step, int degree, double param);
 static double firWinBlackman (int step, int degree, double param);
 static double ftrHighpass (FLTCOEFF *pFilter);
 static double ftrBandpass (FLTCOEFF *pFilter, double fc, double bw, BOOL geometric);
+static int linFirBands (const LINFIR_DESIGN *pDesign, double f0,
+                        FLTREMEZ_BAND band[]);
+static int genEquirippleSystem (LINFIR_DESIGN *pDesign, FLTCOEFF *pFilter);
+static int linFirLevinson (int size, const double r[], const double b[],
+                           double x[], double work[]);
+static double linFirCosIntegral (double omega, double f1, double f2,
+                                 double d1, double d2);
+static int genLeastSquaresSystem (LINFIR_DESIGN *pDesign, FLTCOEFF *pFilter);
+static BOOL linFirCheckScheme (const LINFIR_DESIGN *pDesign,
+                               const FLTCOEFF *pFilter);
+static int linFirEstimateOrder (const LINFIR_DESIGN *pDesign, double f0);
+static void linFirCandidateGen (gpointer data, gpointer user_data);
 
 
 
@@ -112,6 +148,71 @@ static double ftrBandpass (FLTCOEFF *pFilter, double fc, double bw, BOOL geometr
 
 
 
+/* FUNCTION *******************************************************************/
+/** Mirrors the coefficients of a symmetric (linear phase) FIR system about
+ *  \f$n/2\f$, means sets \f$c_{n-i}=c_i\f$ for \f$i<n/2\f$. All system
+ *  generators and window functions are symmetric, so they evaluate the first
+ *  half (including the center) only.
+ *
+ *  \param poly         The numerator polynomial of the linear FIR system (in
+ *                      \e Z domain), with coefficients \f$c_0\ldots c_{n/2}\f$
+ *                      set.
+ *
+ ******************************************************************************/
+static void linFirMirror (MATHPOLY *poly)
+{
+    int i;
+
+    for (i = 0; i < (poly->degree + 1) / 2; i++)
+    {
+        poly->coeff[poly->degree - i] = poly->coeff[i];
+    } /* for */
+} /* linFirMirror() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Applies a smoothing window to the coefficients of a linear FIR system.
+ *
+ *  \param poly         The numerator polynomial of the linear FIR system (in
+ *                      \e Z domain).
+ *  \param last         Index of last coefficient to be windowed. Pass
+ *                      \f$n/2\f$ for symmetric systems (see linFirMirror()),
+ *                      else the degree \f$n\f$.
+ *  \param dspwin       Type of smoothing window.
+ *  \param winparm      Parameter of window, e.g. Kaiser alpha.
+ *
+ ******************************************************************************/
+static void linFirWindow (MATHPOLY *poly, int last, LINFIR_DSPWIN dspwin,
+                          double winparm)
+{
+    static const LINFIR_WINDOW_FUNC winFuncs[LINFIR_DSPWIN_SIZE] =
+    {
+        [LINFIR_DSPWIN_RECT] = firWinRectangle,
+        [LINFIR_DSPWIN_HAMMING] = firWinHamming,
+        [LINFIR_DSPWIN_VANHANN] = firWinVanHann,
+        [LINFIR_DSPWIN_BLACKMAN] = firWinBlackman,
+        [LINFIR_DSPWIN_KAISER] = firWinKaiser
+    };
+
+    int i;
+    double fnorm;
+
+    ASSERT (dspwin < LINFIR_DSPWIN_SIZE);
+
+    for (i = 0; i <= last; i++)
+    {
+        fnorm = winFuncs[dspwin] (i, poly->degree, winparm);
+
+        if (gsl_finite (fnorm))
+        {
+            poly->coeff[i] *= fnorm;
+        } /* if */
+    } /* for */
+} /* linFirWindow() */
+
+
+
 /* FUNCTION *******************************************************************/
 /** Rectangular magnitude response system generator. Calculation of coefficient
  *  \f$c_i\f$ is based on the argument \f$x\f$ and polynomial degree \f$n\f$
@@ -135,7 +236,7 @@ static int genRectangularSystem (double x, MATHPOLY *poly)
 
     double deg2 = poly->degree / 2.0;
 
-    for (i = 0; i <= poly->degree; i++)
+    for (i = 0; i <= poly->degree / 2; i++)                /* first half only */
     {
         err = gsl_sf_sinc_e (2.0 * x * (i - deg2), &result);
 
@@ -147,6 +248,8 @@ static int genRectangularSystem (double x, MATHPOLY *poly)
         poly->coeff[i] = result.val;
     } /* for */
 
+    linFirMirror (poly);
+
     return GSL_SUCCESS;
 } /* genRectangularSystem() */
 
@@ -174,7 +277,7 @@ static int genCosineSystem (double x, MATHPOLY *poly)
 
     double deg2 = poly->degree / 2.0;
 
-    for (i = 0; i <= poly->degree; i++)
+    for (i = 0; i <= poly->degree / 2; i++)                /* first half only */
     {
         tmp = x * (i - deg2);
         poly->coeff[i] = mathTryDiv (cos (4.0 * M_PI * tmp),
@@ -185,6 +288,8 @@ static int genCosineSystem (double x, MATHPOLY *poly)
         } /* if */
     } /* for */
 
+    linFirMirror (poly);
+
     return GSL_SUCCESS;
 } /* genCosineSystem() */
 
@@ -216,7 +321,7 @@ static int genCosine2System (double x, MATHPOLY *poly)
     double deg2 = poly->degree / 2.0;
     double constant = M_PI / acos (1.0 / sqrt (M_SQRT2));
 
-    for (i = 0; i <= poly->degree; i++)
+    for (i = 0; i <= poly->degree / 2; i++)                /* first half only */
     {
         tmp = constant * x * (i - deg2);
         err = gsl_sf_sinc_e (tmp, &result);
@@ -235,6 +340,8 @@ static int genCosine2System (double x, MATHPOLY *poly)
         } /* if */
     } /* for */
 
+    linFirMirror (poly);
+
     return GSL_SUCCESS;
 } /* genCosine2System() */
 
@@ -263,7 +370,7 @@ static int genSquaredSystem (double x, MATHPOLY *poly)
     double deg2 = poly->degree / 2.0;
     double constant = -2.0 * M_PI / sqrt (M_SQRT2 - 1.0);
 
-    for (i = 0; i <= poly->degree; i++)
+    for (i = 0; i <= poly->degree / 2; i++)                /* first half only */
     {
         err = gsl_sf_exp_e (constant * x * fabs (deg2 - i), &result);
 
@@ -275,6 +382,8 @@ static int genSquaredSystem (double x, MATHPOLY *poly)
         poly->coeff[i] = result.val;
     } /* for */
 
+    linFirMirror (poly);
+
     return GSL_SUCCESS;
 } /* genSquaredSystem() */
 
@@ -303,7 +412,7 @@ static int genGaussianSystem (double x, MATHPOLY *poly)
 
     double deg2 = poly->degree / 2.0;
 
-    for (i = 0; i <= poly->degree; i++)               /* set all coefficients */
+    for (i = 0; i <= poly->degree / 2; i++)                /* first half only */
     {
         tmp = x * (i - deg2) * M_PI;
         err = gsl_sf_exp_e (-2.0 * tmp * tmp / M_LN2, &result);
@@ -316,10 +425,101 @@ static int genGaussianSystem (double x, MATHPOLY *poly)
         poly->coeff[i] = result.val;
     } /* for */
 
+    linFirMirror (poly);
+
     return GSL_SUCCESS;
 } /* genGaussianSystem() */
 
 
+
+/* FUNCTION *******************************************************************/
+/** \e Nyquist(M) system generator. The coefficients are those of the
+ *  rectangular system with \f$x=1/(2M)\f$, but every \f$M\f$-th coefficient
+ *  besides the center one is set to exactly zero (instead of a rounding
+ *  residual of \f$\sin(k\pi)\f$):
+    \f[
+        c_i=\left\{\begin{array}{ll}
+        0 & (i-n/2)\bmod M=0,\quad i\neq n/2 \\
+        \si\left[\pi\,(i-n/2)/M\right] & \mbox{else}
+        \end{array}\right.
+    \f]
+ *  The zero pattern survives windowing and all frequency transformations,
+ *  which multiply the coefficients or modify the center one only.
+ *
+ *  \param x            Argument \f$x=1/(2M)\f$.
+ *  \param poly         The numerator polynomial of the linear FIR system (in
+ *                      \e Z domain), where the coefficients shall be set.
+ *
+ *  \return             Zero on success, else an error code (from errno.h or
+ *                      gsl_errno.h). GSL_EDOM is returned for odd degrees.
+ ******************************************************************************/
+static int genNyquistSystem (double x, MATHPOLY *poly)
+{
+    int i, k, err;
+    gsl_sf_result result;
+
+    int bands = (int) floor (0.5 / x + 0.5);                             /* M */
+
+    if (GSL_IS_ODD (poly->degree) || (bands < 2))
+    {
+        return GSL_EDOM;
+    } /* if */
+
+    for (i = 0; i <= poly->degree / 2; i++)                /* first half only */
+    {
+        k = poly->degree / 2 - i;
+
+        if ((k != 0) && (k % bands == 0))
+        {
+            poly->coeff[i] = 0.0;                               /* exact zero */
+        } /* if */
+        else
+        {
+            err = gsl_sf_sinc_e ((double) k / bands, &result);
+
+            if (err != GSL_SUCCESS)
+            {
+                return err;
+            } /* if */
+
+            poly->coeff[i] = result.val;
+        } /* else */
+    } /* for */
+
+    linFirMirror (poly);
+
+    return GSL_SUCCESS;
+} /* genNyquistSystem() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Rounds the cutoff frequency of \e Nyquist(M) designs to \f$f_0/(2M)\f$,
+ *  with \f$M=2\f$ for half-band designs and the nearest \f$M\geq 2\f$ else.
+ *  Other designs are not changed.
+ *
+ *  \param pDesign      Pointer to linear FIR filter design data.
+ *  \param f0           Sample frequency.
+ *
+ ******************************************************************************/
+static void linFirNyquistCutoff (LINFIR_DESIGN *pDesign, double f0)
+{
+    int bands = 2;                                               /* half-band */
+
+    if (pDesign->type == LINFIR_TYPE_NYQUIST)
+    {
+        bands = (int) GSL_MIN (floor (0.5 * f0 / pDesign->cutoff + 0.5),
+                               FLT_DEGREE_MAX);
+        bands = GSL_MAX_INT (bands, 2);
+    } /* if */
+
+    if (LINFIR_TYPE_IS_NYQUIST (pDesign->type))
+    {
+        pDesign->cutoff = 0.5 * f0 / bands;
+    } /* if */
+} /* linFirNyquistCutoff() */
+
+
 /**
  *  \brief      Cutoff frequency correction for LP/HP transformation of a
  *              rectangular system.
@@ -606,6 +806,451 @@ static double ftrBandstop (FLTCOEFF *pFilter, double fc, double bw, BOOL geometr
 
 
 
+/* FUNCTION *******************************************************************/
+/** Builds the pass- and stopbands of the tolerance scheme from cutoff (or
+ *  center frequency and bandwidth) and transition bandwidth. The ratio of
+ *  passband and stopband weight is chosen so that the deviations
+    \f{eqnarray*}
+        \delta_p &=& \frac{10^{A_p/20}-1}{10^{A_p/20}+1} \\
+        \delta_s &=& 10^{-A_s/20}
+    \f}
+ *  are reached at the same time.
+ *
+ *  \param pDesign      Pointer to linear FIR filter design data.
+ *  \param f0           Sample frequency.
+ *  \param band         Array of (at least) three elements, which gets the
+ *                      bands (frequencies normalized to \p f0).
+ *
+ *  \return             Number of bands (2 or 3).
+ ******************************************************************************/
+static int linFirBands (const LINFIR_DESIGN *pDesign, double f0,
+                        FLTREMEZ_BAND band[])
+{
+    double f1, f2, ripple, weight;
+    int i;
+
+    int bands = 2;
+    double half = 0.5 * pDesign->width / f0;
+    double pass = 1.0;                         /* desired gain of lowest band */
+
+    ripple = pow (10.0, pDesign->ripple / 20.0);
+    weight = (ripple - 1.0) / (ripple + 1.0) * pow (10.0, pDesign->minatt / 20.0);
+
+    switch (pDesign->ftr.type)
+    {
+        case FTR_HIGHPASS:
+            pass = 0.0;
+            f1 = pDesign->ftr.fc / f0;
+            break; /* FTR_HIGHPASS */
+
+        case FTR_BANDPASS:
+            pass = 0.0;                                       /* fall through */
+
+        case FTR_BANDSTOP:
+            f1 = pDesign->ftr.fc - 0.5 * pDesign->ftr.bw;
+
+            if (pDesign->ftr.flags & FTRDESIGN_FLAG_CENTER_GEOMETRIC)
+            {
+                f1 = HYPOT (pDesign->ftr.fc, 0.5 * pDesign->ftr.bw) -
+                    0.5 * pDesign->ftr.bw;
+            } /* if */
+
+            f2 = (f1 + pDesign->ftr.bw) / f0;
+            f1 /= f0;
+            band[1].upper = f2 - half;
+            band[2].lower = f2 + half;
+            bands = 3;
+            break; /* FTR_BANDPASS, FTR_BANDSTOP */
+
+        case FTR_NON:                                              /* lowpass */
+        default:
+            f1 = pDesign->cutoff / f0;
+            break; /* FTR_NON */
+    } /* switch */
+
+    band[0].lower = 0.0;
+    band[0].upper = f1 - half;
+    band[1].lower = f1 + half;
+    band[bands - 1].upper = 0.5;
+
+    for (i = 0; i < bands; i++)              /* alternating passband/stopband */
+    {
+        band[i].gain = pass;
+        band[i].weight = (pass > 0.0) ? 1.0 : weight;
+        pass = 1.0 - pass;
+    } /* for */
+
+    return bands;
+} /* linFirBands() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Equiripple system generator. Builds the bands of the tolerance scheme by
+ *  linFirBands(), then calls the \e Parks-McClellan algorithm.
+ *
+ *  \param pDesign      Pointer to linear FIR filter design data.
+ *  \param pFilter      Pointer to filter, which has memory space allocated
+ *                      for the numerator coefficients.
+ *
+ *  \return             Zero on success, else an error code (from errno.h or
+ *                      gsl_errno.h).
+ ******************************************************************************/
+static int genEquirippleSystem (LINFIR_DESIGN *pDesign, FLTCOEFF *pFilter)
+{
+    FLTREMEZ_BAND band[3];
+    int bands = linFirBands (pDesign, pFilter->f0, band);
+
+    return filterRemez (pFilter->num.degree, bands, band, pFilter->num.coeff, NULL);
+} /* genEquirippleSystem() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Solves a symmetric positive definite Toeplitz system \f$T x=b\f$ with
+ *  \f$T_{ij}=r_{|i-j|}\f$ and unit diagonal (\f$r_0=1\f$) by the \e Levinson
+ *  algorithm in \f$O(\mathrm{size}^2)\f$ operations. The \e Durbin recursion
+ *  for the Yule-Walker vector \f$y\f$ runs in parallel with the update of
+ *  \f$x\f$.
+ *
+ *  \param size         Size of system (at least 1).
+ *  \param r            First row (column) of \f$T\f$, array of \p size
+ *                      elements.
+ *  \param b            Right hand side, array of \p size elements.
+ *  \param x            Array of \p size elements, which gets the solution.
+ *  \param work         Work space of \p size elements.
+ *
+ *  \return             Zero on success, else GSL_ESING if \f$T\f$ is not
+ *                      (numerically) positive definite.
+ ******************************************************************************/
+static int linFirLevinson (int size, const double r[], const double b[],
+                           double x[], double work[])
+{
+    int i, k;
+    double mu, tmp;
+
+    double *y = work;
+    double alpha = 0.0;
+    double beta = 1.0;
+
+    x[0] = b[0];
+
+    if (size > 1)
+    {
+        y[0] = alpha = -r[1];
+    } /* if */
+
+    for (k = 1; k < size; k++)
+    {
+        beta *= 1.0 - alpha * alpha;
+
+        if (!(beta > 0.0))
+        {
+            return GSL_ESING;
+        } /* if */
+
+        mu = b[k];
+
+        for (i = 0; i < k; i++)
+        {
+            mu -= r[i + 1] * x[k - 1 - i];
+        } /* for */
+
+        mu /= beta;
+
+        for (i = 0; i < k; i++)                             /* x := x + mu*Jy */
+        {
+            x[i] += mu * y[k - 1 - i];
+        } /* for */
+
+        x[k] = mu;
+
+        if (k < size - 1)                                      /* Durbin step */
+        {
+            alpha = -r[k + 1];
+
+            for (i = 0; i < k; i++)
+            {
+                alpha -= r[i + 1] * y[k - 1 - i];
+            } /* for */
+
+            alpha /= beta;
+
+            for (i = 0; i < k / 2; i++)       /* y := y + alpha*Jy (in place) */
+            {
+                tmp = y[i];
+                y[i] += alpha * y[k - 1 - i];
+                y[k - 1 - i] += alpha * tmp;
+            } /* for */
+
+            if (GSL_IS_ODD (k))
+            {
+                y[k / 2] *= 1.0 + alpha;
+            } /* if */
+
+            y[k] = alpha;
+        } /* if */
+    } /* for */
+
+    return GSL_SUCCESS;
+} /* linFirLevinson() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Integrates a cosine weighted by a linear function, means returns
+    \f[
+        \int_{f_1}^{f_2} D(f)\cos(\omega f)\,df,\quad
+        D(f)=d_1+\frac{d_2-d_1}{f_2-f_1}(f-f_1)
+    \f]
+ *
+ *  \param omega        Angular factor \f$\omega\f$.
+ *  \param f1           Lower limit.
+ *  \param f2           Upper limit.
+ *  \param d1           Weight at \p f1.
+ *  \param d2           Weight at \p f2.
+ *
+ *  \return             Value of the integral.
+ ******************************************************************************/
+static double linFirCosIntegral (double omega, double f1, double f2,
+                                 double d1, double d2)
+{
+    double slope;
+
+    if (!(f2 > f1))
+    {
+        return 0.0;
+    } /* if */
+
+    if (omega == 0.0)
+    {
+        return 0.5 * (d1 + d2) * (f2 - f1);
+    } /* if */
+
+    slope = (d2 - d1) / (f2 - f1);
+
+    return (d2 * sin (omega * f2) - d1 * sin (omega * f1)) / omega +
+        slope * (cos (omega * f2) - cos (omega * f1)) / (omega * omega);
+} /* linFirCosIntegral() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Weighted least-squares system generator. Builds the bands of the tolerance
+ *  scheme by linFirBands(), then minimizes the integral squared error
+    \f[
+        \sum_k w_k^2\int_{B_k}\left|H(f)\,e^{j\pi nf/f_0}-D_k(f)\right|^2 df
+    \f]
+ *  over all coefficients \f$c_0\ldots c_n\f$. The normal equations have the
+ *  symmetric positive definite Toeplitz matrix
+    \f[
+        r_m = \sum_k w_k^2\int_{B_k}\cos(2\pi mf)\,df
+    \f]
+ *  and the right hand side \f$b_i=\sum_k w_k^2\int_{B_k}D_k(f)
+ *  \cos[2\pi(i-n/2)f]\,df\f$ (frequencies normalized to \f$f_0\f$), where
+ *  both integrals are known in closed form. Since \f$b\f$ is symmetric about
+ *  \f$n/2\f$ the solution is, too, so it is the least-squares linear phase
+ *  system. Solving the full Toeplitz system by linFirLevinson() is
+ *  equivalent to solving the folded \e Toeplitz-plus-Hankel system of the
+ *  linear phase formulation, but needs no special algorithm.
+ *
+ *  Without any weight in the transition bands the matrix gets extremely
+ *  ill-conditioned at high degrees. Therefore the transition bands are part
+ *  of the approximation, with a linear desired response between the adjacent
+ *  bands and a small weight (LINFIR_LSQ_TRANSWEIGHT).
+ *
+ *  \param pDesign      Pointer to linear FIR filter design data.
+ *  \param pFilter      Pointer to filter, which has memory space allocated
+ *                      for the numerator coefficients.
+ *
+ *  \return             Zero on success, else an error code (from errno.h or
+ *                      gsl_errno.h).
+ ******************************************************************************/
+static int genLeastSquaresSystem (LINFIR_DESIGN *pDesign, FLTCOEFF *pFilter)
+{
+    FLTREMEZ_BAND band[5];
+    int i, k, bands, err;
+    double *r, *b, w2, omega;
+
+    int size = pFilter->num.degree + 1;
+    double deg2 = pFilter->num.degree / 2.0;
+
+    bands = linFirBands (pDesign, pFilter->f0, band);
+
+    for (k = bands - 1; k > 0; k--)            /* insert the transition bands */
+    {
+        band[2 * k] = band[k];
+        band[2 * k - 1].lower = band[k - 1].upper;
+        band[2 * k - 1].upper = band[2 * k].lower;
+        band[2 * k - 1].weight = LINFIR_LSQ_TRANSWEIGHT *
+            MIN (band[k - 1].weight, band[2 * k].weight);
+    } /* for */
+
+    bands = 2 * bands - 1;
+    r = g_malloc (3 * size * sizeof(r[0]));
+    b = r + size;
+
+    for (i = 0; i < size; i++)               /* integrate the cosine per band */
+    {
+        r[i] = b[i] = 0.0;
+        omega = 2.0 * M_PI * (i - deg2);
+
+        for (k = 0; k < bands; k++)
+        {
+            w2 = band[k].weight * band[k].weight;
+            r[i] += w2 * linFirCosIntegral (2.0 * M_PI * i, band[k].lower,
+                                            band[k].upper, 1.0, 1.0);
+
+            if (GSL_IS_ODD (k))                    /* transition: linear ramp */
+            {
+                b[i] += w2 * linFirCosIntegral (omega, band[k].lower,
+                                                band[k].upper,
+                                                band[k - 1].gain,
+                                                band[k + 1].gain);
+            } /* if */
+            else if (band[k].gain != 0.0)
+            {
+                b[i] += w2 * band[k].gain *
+                    linFirCosIntegral (omega, band[k].lower, band[k].upper,
+                                       1.0, 1.0);
+            } /* else if */
+        } /* for */
+    } /* for */
+
+    for (i = size - 1; i >= 0; i--)                     /* unit diagonal of T */
+    {
+        b[i] /= r[0];
+        r[i] /= r[0];
+    } /* for */
+
+    err = linFirLevinson (size, r, b, pFilter->num.coeff, r + 2 * size);
+    g_free (r);
+
+    if (err == GSL_SUCCESS)
+    {
+        linFirMirror (&pFilter->num);             /* exactly symmetric system */
+    } /* if */
+
+    return err;
+} /* genLeastSquaresSystem() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Checks whether the magnitude response of a linear FIR filter meets the
+ *  tolerance scheme (passband ripple, stopband attenuation and transition
+ *  bandwidth) of the design. The stopband attenuation is related to the mean
+ *  passband gain.
+ *
+ *  \param pDesign      Pointer to linear FIR filter design data.
+ *  \param pFilter      Pointer to filter.
+ *
+ *  \return             TRUE if the filter meets the tolerance scheme, else
+ *                      FALSE.
+ ******************************************************************************/
+static BOOL linFirCheckScheme (const LINFIR_DESIGN *pDesign,
+                               const FLTCOEFF *pFilter)
+{
+    FLTREMEZ_BAND band[3];
+    int i, k, points;
+    double mag;
+
+    double passMin = GSL_POSINF, passMax = 0.0, stopMax = 0.0;
+    int bands = linFirBands (pDesign, pFilter->f0, band);
+
+    for (i = 0; i < bands; i++)
+    {
+        points = 1 + ceil (LINFIR_SCHEME_DENSITY * (pFilter->num.degree + 1) *
+                           (band[i].upper - band[i].lower));
+
+        for (k = 0; k <= points; k++)
+        {
+            mag = filterResponsePoly (
+                2.0 * M_PI * (band[i].lower +
+                              k * (band[i].upper - band[i].lower) / points),
+                &pFilter->num);
+
+            if (band[i].gain > 0.0)                               /* passband */
+            {
+                passMin = fmin (passMin, mag);
+                passMax = fmax (passMax, mag);
+            } /* if */
+            else
+            {
+                stopMax = fmax (stopMax, mag);
+            } /* else */
+        } /* for */
+    } /* for */
+
+    return (passMax <= passMin * pow (10.0, pDesign->ripple / 20.0)) &&
+        (stopMax <= 0.5 * (passMin + passMax) * pow (10.0, -pDesign->minatt / 20.0));
+} /* linFirCheckScheme() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Estimates the order of a linear FIR filter, which is needed to meet the
+ *  tolerance scheme. For equiripple designs the \e Kaiser formula
+    \f[
+        n \approx \frac{-20\lg\sqrt{\delta_p\delta_s}-13}{14.6\,\Delta f/f_0}
+    \f]
+ *  is used, else the rule of thumb \f$n\approx A_s f_0/(22\,\Delta f)\f$ from
+ *  \e Harris (which is somewhat optimistic for non-\e Kaiser windows).
+ *
+ *  \param pDesign      Pointer to linear FIR filter design data.
+ *  \param f0           Sample frequency.
+ *
+ *  \return             Estimated order.
+ ******************************************************************************/
+static int linFirEstimateOrder (const LINFIR_DESIGN *pDesign, double f0)
+{
+    double ripple = pow (10.0, pDesign->ripple / 20.0);
+    double deltaP = (ripple - 1.0) / (ripple + 1.0);
+    double deltaS = pow (10.0, -pDesign->minatt / 20.0);
+    double df = pDesign->width / f0;
+
+    if (pDesign->type == LINFIR_TYPE_REMEZ)
+    {
+        return ceil ((-10.0 * log10 (deltaP * deltaS) - 13.0) / (14.6 * df));
+    } /* if */
+
+    return ceil (pDesign->minatt / (22.0 * df));
+} /* linFirEstimateOrder() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Generates the filter of a minimum order candidate and checks it against
+ *  the tolerance scheme. Used as function of a GThreadPool, so it may be
+ *  called from any thread.
+ *
+ *  \param data         Pointer to candidate (LINFIR_CANDIDATE). If the filter
+ *                      does not meet the tolerance scheme, it is free'd here.
+ *  \param user_data    User data of thread pool (unused).
+ *
+ ******************************************************************************/
+static void linFirCandidateGen (gpointer data, gpointer user_data)
+{
+    LINFIR_CANDIDATE *pCand = data;
+
+    (void) user_data;
+
+    pCand->err = linFirFilterGenWorker (&pCand->design, &pCand->filter);
+    pCand->passed = FALSE;
+
+    if (!FLTERR_CRITICAL (pCand->err))
+    {
+        pCand->passed = linFirCheckScheme (&pCand->design, &pCand->filter);
+
+        if (!pCand->passed)
+        {
+            filterFree (&pCand->filter);
+        } /* if */
+    } /* if */
+} /* linFirCandidateGen() */
+
+
+
 /* EXPORTED FUNCTION DEFINITIONS **********************************************/
 
 
@@ -613,10 +1258,13 @@ static double ftrBandstop (FLTCOEFF *pFilter, double fc, double bw, BOOL geometr
 /**
  *  \brief Generates a linear FIR filter.
  *
- *  \attention          For frequency transformations (HP/BP/BS) the system
- *                      order (degree) must be even.
+ *  \attention          For frequency transformations (HP/BP/BS) and
+ *                      Nyquist(M) designs the system order (degree) must be
+ *                      even.
  *  \note               The cutoff frequency is assumed to be the 3dB point
- *                      of magnitude response.
+ *                      of magnitude response (center of transition band for
+ *                      equiripple designs). On Nyquist(M) designs it is
+ *                      rounded to \f$f_0/(2M)\f$.
  *
  *  \param pDesign      Pointer to linear FIR filter design data.
  *  \param pFilter      Pointer to buffer which gets the generated filter.
@@ -627,6 +1275,36 @@ static double ftrBandstop (FLTCOEFF *pFilter, double fc, double bw, BOOL geometr
  *                      gsl_errno.h for predefined codes).
  ******************************************************************************/
 int linFirFilterGen (LINFIR_DESIGN *pDesign, FLTCOEFF *pFilter)
+{
+    int err;
+
+    /* All GSL errors are handled by the caller, therefore disable the abort
+     * behavior of the GSL library.
+     */
+    gsl_error_handler_t *oldHandler = gsl_set_error_handler_off ();
+
+    err = linFirFilterGenWorker (pDesign, pFilter);
+    gsl_set_error_handler (oldHandler);
+
+    return err;
+} /* linFirFilterGen() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Generates a linear FIR filter like linFirFilterGen(), but leaves the
+ *  (process global) GSL error handler untouched. The caller must have
+ *  switched it off before, see gsl_set_error_handler_off(). Worker threads
+ *  use this function, because saving and restoring the handler per call
+ *  would race.
+ *
+ *  \param pDesign      Pointer to linear FIR filter design data.
+ *  \param pFilter      Pointer to buffer which gets the generated filter.
+ *
+ *  \return             Zero on success, else an error number (see errno.h or
+ *                      gsl_errno.h for predefined codes).
+ ******************************************************************************/
+int linFirFilterGenWorker (LINFIR_DESIGN *pDesign, FLTCOEFF *pFilter)
 {
     static const LINFIR_SYSGEN_FUNC genFuncs[LINFIR_TYPE_SIZE] =
     {
@@ -634,7 +1312,9 @@ int linFirFilterGen (LINFIR_DESIGN *pDesign, FLTCOEFF *pFilter)
         [LINFIR_TYPE_COS] = genCosineSystem,
         [LINFIR_TYPE_COS2] = genCosine2System,
         [LINFIR_TYPE_GAUSS] = genGaussianSystem,
-        [LINFIR_TYPE_SQR] = genSquaredSystem
+        [LINFIR_TYPE_SQR] = genSquaredSystem,
+        [LINFIR_TYPE_HALFBAND] = genNyquistSystem,
+        [LINFIR_TYPE_NYQUIST] = genNyquistSystem
     };
 
     static const LINFIR_FCORR_FUNC corrFuncs[LINFIR_TYPE_SIZE] =
@@ -643,21 +1323,15 @@ int linFirFilterGen (LINFIR_DESIGN *pDesign, FLTCOEFF *pFilter)
         [LINFIR_TYPE_COS] = corrCosineCutoff,
         [LINFIR_TYPE_COS2] = corrCosine2Cutoff,
         [LINFIR_TYPE_GAUSS] = corrGaussianCutoff,
-        [LINFIR_TYPE_SQR] = corrSquaredCutoff
-    };
-
-    static const LINFIR_WINDOW_FUNC winFuncs[LINFIR_DSPWIN_SIZE] =
-    {
-        [LINFIR_DSPWIN_RECT] = firWinRectangle,
-        [LINFIR_DSPWIN_HAMMING] = firWinHamming,
-        [LINFIR_DSPWIN_VANHANN] = firWinVanHann,
-        [LINFIR_DSPWIN_BLACKMAN] = firWinBlackman,
-        [LINFIR_DSPWIN_KAISER] = firWinKaiser
+        [LINFIR_TYPE_SQR] = corrSquaredCutoff,
+        [LINFIR_TYPE_REMEZ] = corrRectangularCutoff,
+        [LINFIR_TYPE_LSQ] = corrRectangularCutoff,
+        [LINFIR_TYPE_HALFBAND] = corrRectangularCutoff,
+        [LINFIR_TYPE_NYQUIST] = corrRectangularCutoff
     };
 
 
     int i, err;
-    gsl_error_handler_t *oldHandler;
     double fnorm;                                   /* unity norm frequency */
 
     ASSERT(GSL_IS_EVEN(pDesign->order) ||
@@ -673,12 +1347,6 @@ int linFirFilterGen (LINFIR_DESIGN *pDesign, FLTCOEFF *pFilter)
     ERROR_RET_IF (filterMalloc(pFilter),
                   "Linear FIR filter memory allocation");
     pFilter->den.coeff[0] = 1.0;
-
-    /* All GSL errors are handled by the caller (starting from here), therefore
-     * disable the abort behavior of the GSL library.
-     */
-    oldHandler = gsl_set_error_handler_off ();
-
     pFilter->factor = 0.0;            /* no valid roots representation so far */
     ASSERT (pDesign->type < LINFIR_TYPE_SIZE);
 
@@ -703,59 +1371,340 @@ int linFirFilterGen (LINFIR_DESIGN *pDesign, FLTCOEFF *pFilter)
             ASSERT(0);
     } /* switch */
 
-    err = genFuncs[pDesign->type] (pDesign->cutoff / pFilter->f0, &pFilter->num);
-    LINFIR_ERROR_RET (pFilter, err, "Linear FIR filter generation has failed");
+    linFirNyquistCutoff (pDesign, pFilter->f0);
 
-    for (i = 0; i <= pFilter->num.degree; i++)     /* apply window function */
+    if (pDesign->type == LINFIR_TYPE_REMEZ)   /* no window, no transformation */
     {
-        fnorm = winFuncs[pDesign->dspwin] (i, pFilter->num.degree, pDesign->winparm);
+        err = genEquirippleSystem (pDesign, pFilter);
+        LINFIR_ERROR_RET (pFilter, err, "Equiripple FIR filter design has failed");
+        i = normFilterCoeffs (pFilter);
+    } /* if */
+    else if (pDesign->type == LINFIR_TYPE_LSQ)
+    {
+        err = genLeastSquaresSystem (pDesign, pFilter);
+        LINFIR_ERROR_RET (pFilter, err, "Least-squares FIR filter design has failed");
+        i = normFilterCoeffs (pFilter);
+    } /* else if */
+    else
+    {
+        err = genFuncs[pDesign->type] (pDesign->cutoff / pFilter->f0, &pFilter->num);
+        LINFIR_ERROR_RET (pFilter, err, "Linear FIR filter generation has failed");
 
-        if (gsl_finite (fnorm))
+        linFirWindow (&pFilter->num, pFilter->num.degree / 2,
+                      pDesign->dspwin, pDesign->winparm);     /* apply window */
+        linFirMirror (&pFilter->num);                /* symmetric window, too */
+
+        /* Frequency transformation
+         */
+        switch (pDesign->ftr.type)
         {
-            pFilter->num.coeff[i] *= fnorm;
+            case FTR_BANDSTOP:            /* lowpass->bandstop transformation */
+                fnorm = ftrBandstop (pFilter, pDesign->ftr.fc, pDesign->ftr.bw,
+                                     pDesign->ftr.flags & FTRDESIGN_FLAG_CENTER_GEOMETRIC);
+                break;
+
+            case FTR_BANDPASS:
+                fnorm = ftrBandpass (pFilter, pDesign->ftr.fc, pDesign->ftr.bw,
+                                     pDesign->ftr.flags & FTRDESIGN_FLAG_CENTER_GEOMETRIC);
+                break;
+
+            case FTR_HIGHPASS:            /* lowpass->highpass transformation */
+                fnorm = ftrHighpass (pFilter);
+                break;
+
+            case FTR_NON:                                          /* lowpass */
+                fnorm = 0.0;
+                break;
+
+            default:
+                ASSERT(0);
+                break;
+        } /* switch */
+
+        i = normFilterMagnitude (pFilter, fnorm, 1.0);
+    } /* else */
+
+    if (FLTERR_CRITICAL (i))
+    {
+        filterFree (pFilter);
+    } /* if */
+
+    return i;
+} /* linFirFilterGenWorker() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Generates a linear FIR filter of minimum order, which meets the tolerance
+ *  scheme given by \a ripple, \a minatt and \a width of the design. The order
+ *  is estimated first, then the smallest order meeting the scheme is searched
+ *  for. In each step of this search a set of orders (one per processor) is
+ *  generated and checked in parallel on a GThreadPool, which narrows the
+ *  interval by the number of candidates plus one.
+ *
+ *  \note               The search presumes that the scheme is met by all
+ *                      orders above the minimum. For frequency
+ *                      transformations and Nyquist(M) designs only even
+ *                      orders are tried.
+ *
+ *  \param pDesign      Pointer to linear FIR filter design data. The
+ *                      element \a order gets the minimum order found.
+ *  \param pFilter      Pointer to buffer which gets the generated filter
+ *                      (\a f0 must be set).
+ *
+ *  \return             Zero on success, else an error number (see errno.h or
+ *                      gsl_errno.h for predefined codes). GSL_ETOL is
+ *                      returned if no order up to FLT_DEGREE_MAX meets the
+ *                      tolerance scheme.
+ ******************************************************************************/
+int linFirFilterMinOrderGen (LINFIR_DESIGN *pDesign, FLTCOEFF *pFilter)
+{
+    LINFIR_CANDIDATE cand[LINFIR_CANDIDATES_MAX];
+    LINFIR_CANDIDATE best;
+    FLTREMEZ_BAND band[3];
+    GThreadPool *pool;
+    gsl_error_handler_t *oldHandler;
+    int i, n, order, bands, procs, estimate;
+
+    int step = ((pDesign->ftr.type == FTR_NON) &&        /* even on transform */
+                !LINFIR_TYPE_IS_NYQUIST (pDesign->type)) ? 1 : 2;
+    int lo = 0;                       /* greatest order (in steps) which fails */
+    int hi = FLT_DEGREE_MAX / step + 1; /* least order (in steps) which meets */
+
+    if ((pDesign->width <= 0.0) || (pDesign->ripple <= 0.0) ||
+        (pDesign->minatt <= 0.0))
+    {
+        return GSL_EDOM;
+    } /* if */
+
+    linFirNyquistCutoff (pDesign, pFilter->f0);
+    bands = linFirBands (pDesign, pFilter->f0, band);
+
+    for (i = 0; i < bands; i++)
+    {
+        if ((band[i].lower < 0.0) || (band[i].upper <= band[i].lower))
+        {
+            return GSL_EDOM;
         } /* if */
     } /* for */
 
+    procs = CLAMP (g_get_num_processors (), 1, LINFIR_CANDIDATES_MAX);
+    estimate = linFirEstimateOrder (pDesign, pFilter->f0) / step;
+    estimate = CLAMP (estimate, 1, hi - 1);
+    best.passed = FALSE;
 
-    /* Frequency transformation
+    /* The GSL error handler is a global, so switch it off once for all
+     * threads (the candidates use linFirFilterGenWorker(), which keeps it).
      */
-    switch (pDesign->ftr.type)
+    oldHandler = gsl_set_error_handler_off ();
+
+    while (hi - lo > 1)
     {
-        case FTR_BANDSTOP:                /* lowpass->bandstop transformation */
-            fnorm = ftrBandstop (pFilter, pDesign->ftr.fc, pDesign->ftr.bw,
-                                 pDesign->ftr.flags & FTRDESIGN_FLAG_CENTER_GEOMETRIC);
-            break;
+        for (i = n = 0; i < procs; i++)                /* set up candidates */
+        {
+            if (lo == 0 && !best.passed)             /* around the estimate */
+            {
+                order = estimate + ((2 * i - procs + 1) * estimate) / (8 * procs);
+            } /* if */
+            else if (!best.passed)            /* expand (up to twice lo) */
+            {
+                order = lo + ((i + 1) * MAX (lo, procs)) / procs;
+            } /* else if */
+            else                                   /* split (lo, hi) evenly */
+            {
+                order = lo + ((i + 1) * (hi - lo)) / (procs + 1);
+            } /* else */
+
+            order = MIN (order, hi - 1);
+
+            if ((order > lo) && ((n == 0) || (order > cand[n - 1].design.order)))
+            {
+                cand[n].design = *pDesign;
+                cand[n].design.order = order;      /* in steps (until run) */
+                ++n;
+            } /* if */
+        } /* for */
+
+        pool = g_thread_pool_new (linFirCandidateGen, NULL, procs, FALSE, NULL);
+
+        for (i = 0; i < n; i++)                           /* run candidates */
+        {
+            cand[i].design.order *= step;
+            cand[i].filter.f0 = pFilter->f0;
 
-        case FTR_BANDPASS:
-            fnorm = ftrBandpass (pFilter, pDesign->ftr.fc, pDesign->ftr.bw,
-                                 pDesign->ftr.flags & FTRDESIGN_FLAG_CENTER_GEOMETRIC);
-            break;
+            if ((pool == NULL) ||
+                !g_thread_pool_push (pool, &cand[i], NULL))
+            {
+                linFirCandidateGen (&cand[i], NULL);         /* sequential */
+            } /* if */
+        } /* for */
 
-        case FTR_HIGHPASS:                /* lowpass->highpass transformation */
-            fnorm = ftrHighpass (pFilter);
-            break;
+        if (pool != NULL)
+        {
+            g_thread_pool_free (pool, FALSE, TRUE);   /* wait for all tasks */
+        } /* if */
 
-        case FTR_NON:                                              /* lowpass */
-            fnorm = 0.0;
-            break;
+        for (i = 0; i < n; i++)                /* narrow interval (lo, hi) */
+        {
+            order = cand[i].design.order / step;
+
+            if (!cand[i].passed)
+            {
+                if (order < hi)
+                {
+                    lo = MAX (lo, order);
+                } /* if */
+            } /* if */
+            else if (order < hi)                          /* new minimum */
+            {
+                if (best.passed)
+                {
+                    filterFree (&best.filter);
+                } /* if */
+
+                best = cand[i];
+                hi = order;
+            } /* else if */
+            else
+            {
+                filterFree (&cand[i].filter);
+            } /* else */
+        } /* for */
+    } /* while */
 
-        default:
-            ASSERT(0);
-            break;
-    } /* switch */
+    gsl_set_error_handler (oldHandler);
 
+    if (!best.passed)
+    {
+        return GSL_ETOL;
+    } /* if */
 
-    i = normFilterMagnitude (pFilter, fnorm, 1.0);
+    *pDesign = best.design;
+    *pFilter = best.filter;
 
-    if (FLTERR_CRITICAL (i))
+    return best.err;
+} /* linFirFilterMinOrderGen() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Generates a linear FIR filter by frequency sampling. The desired frequency
+ *  response is given on a uniform grid from \f$0\f$ to \f$f_0/2\f$. It is
+ *  interpolated (linearly) onto the \f$N/2+1\f$ bins of a real FFT of size
+ *  \f$N\f$, where \f$N\f$ is the smallest power of two with \f$N>n\f$ and
+ *  \f$N/2\f$ not less than the number of grid intervals. All bins get the
+ *  phase \f$-\pi k n/N\f$ of a delay by \f$n/2\f$ samples (plus the excess
+ *  phase, if any). One inverse FFT then yields the periodic impulse response,
+ *  which is truncated to the coefficients \f$c_0\ldots c_n\f$ and smoothed
+ *  by the window.
+ *
+ *  \note               For odd degrees \f$n\f$ and linear phase (\p phase is
+ *                      NULL) the response at \f$f_0/2\f$ always is zero.
+ *
+ *  \param degree       Degree \f$n\f$ of filter (number of coefficients minus
+ *                      one).
+ *  \param points       Number of grid points (at least 2).
+ *  \param mag          Array of \p points magnitudes at the frequencies
+ *                      \f$f_0 k/(2(points-1))\f$.
+ *  \param phase        Array of \p points excess phases (in radians) at the
+ *                      same frequencies, or NULL for a linear phase filter.
+ *  \param dspwin       Type of smoothing window.
+ *  \param winparm      Parameter of window, e.g. Kaiser alpha.
+ *  \param pFilter      Pointer to buffer which gets the generated filter.
+ *                      Notice, that memory space for polynomials is allocated
+ *                      in the function linFirFilterSampledGen().
+ *
+ *  \return             Zero on success, else an error number (see errno.h or
+ *                      gsl_errno.h for predefined codes).
+ ******************************************************************************/
+int linFirFilterSampledGen (int degree, int points, const double mag[],
+                            const double phase[], LINFIR_DSPWIN dspwin,
+                            double winparm, FLTCOEFF *pFilter)
+{
+    int i, k, err, size, half;
+    double x, gain, arg;
+    double *pResp;
+    gsl_error_handler_t *oldHandler;
+
+    if ((degree < 1) || (degree > FLT_DEGREE_MAX) || (points < 2) ||
+        (dspwin >= LINFIR_DSPWIN_SIZE))
     {
-        filterFree (pFilter);
+        return GSL_EDOM;
     } /* if */
 
+    for (size = 2; (size <= degree) || (size / 2 < points - 1); size *= 2)
+    {
+        ;
+    } /* for */
+
+    half = size / 2;
+    pResp = g_malloc (size * sizeof(pResp[0]));
+
+    for (i = 0; i <= half; i++)      /* sample response in halfcomplex format */
+    {
+        x = (double) i * (points - 1) / half;             /* position in grid */
+        k = MIN ((int) x, points - 2);
+        x -= k;
+        gain = mag[k] + x * (mag[k + 1] - mag[k]);
+        arg = -M_PI * i * degree / size;                      /* delay by n/2 */
+
+        if (phase != NULL)
+        {
+            arg += phase[k] + x * (phase[k + 1] - phase[k]);
+        } /* if */
+
+        pResp[i] = gain * cos (arg);
+
+        if ((i > 0) && (i < half))
+        {
+            pResp[size - i] = gain * sin (arg);
+        } /* if */
+    } /* for */
+
+    oldHandler = gsl_set_error_handler_off ();
+    err = gsl_fft_halfcomplex_radix2_inverse (pResp, 1, size);
     gsl_set_error_handler (oldHandler);
 
-    return i;
-} /* linFirFilterGen() */
+    if (err != GSL_SUCCESS)
+    {
+        g_free (pResp);
+        return err;
+    } /* if */
+
+    pFilter->factor = 0.0;                 /* roots are invalid (unused here) */
+    pFilter->den.degree = 0;                          /* this is a FIR filter */
+    pFilter->num.degree = degree;
+    err = filterMalloc (pFilter);
+
+    if (err != 0)
+    {
+        g_free (pResp);
+        return err;
+    } /* if */
+
+    pFilter->den.coeff[0] = 1.0;
+    memcpy (pFilter->num.coeff, pResp, (degree + 1) * sizeof(pResp[0]));
+    g_free (pResp);
+
+    if (phase == NULL)
+    {
+        linFirWindow (&pFilter->num, degree / 2, dspwin, winparm);
+        linFirMirror (&pFilter->num);             /* exactly symmetric system */
+    } /* if */
+    else
+    {
+        linFirWindow (&pFilter->num, degree, dspwin, winparm);
+    } /* else */
+
+    err = normFilterCoeffs (pFilter);
+
+    if (FLTERR_CRITICAL (err))
+    {
+        filterFree (pFilter);
+    } /* if */
+
+    return err;
+} /* linFirFilterSampledGen() */
 
 
 
@@ -9,6 +9,7 @@
 #include "cfgSettings.h"
 #include "dfcProject.h"
 #include "mainDlg.h"
+#include "designDlg.h"
 
 #include <gtk/gtk.h>
 
@@ -90,6 +90,7 @@ static void coeffCellDataFunc (GtkTreeViewColumn *column, GtkCellRenderer *rende
 static void coeffFillListTreeView (GtkTreeView *tree,  GtkListStore *store,
                                    MATHPOLY *poly);
 static MATHPOLY *getSelectedPoly (FLTCOEFF* pFilter, int *pIndex);
+static BOOL updateFilter (int err, BOOL track);
 
 
 
@@ -407,8 +408,13 @@ static void mainDlgCoeffAction (GtkWidget *widget, gpointer user_data)
                 } /* if */
                 else                 /* seems okay (do not free any memory) */
                 {
+                    if (!FLTERR_SUCCESS (result))  /* degree may have changed */
+                    {
+                        tmp.factor = 0.0;    /* old roots are no approximation */
+                    } /* if */
+
                     dfcPrjSetFilter (FLTCLASS_NOTDEF, &tmp, NULL);
-                    mainDlgUpdateFilter (result);
+                    updateFilter (result, TRUE);
                 } /* else */
             } /* if */
         } /* if */
@@ -660,6 +666,68 @@ static void coeffRedrawListTreeViews ()
 
 
 
+/* FUNCTION *******************************************************************/
+/** Updates the main filter dialog from current project (if there is no error
+ *  passed in via \p err). If there is an critical error (coded as from function
+ *  filterCheck(), then it displays an error box. If \c FLTERR_WARNING(err)
+ *  indicates loss of coefficients then a warning will be shown.
+ *
+ *  \param err      Error indicator with coding as from filterCheck().
+ *  \param track    If TRUE the roots are tracked from the roots of the
+ *                  filter before change (see rootsPlotTrack()), else they are
+ *                  computed from scratch.
+ *
+ *  \return         Returns TRUE if the error is not FLTERR_CRITICAL(err),
+ *                  else FALSE.
+ ******************************************************************************/
+static BOOL updateFilter (int err, BOOL track)
+{
+    FLTCOEFF* pFilter = dfcPrjGetFilter ();
+    BOOL valid = pFilter != NULL;
+
+    if (!FLTERR_CRITICAL (err))
+    {
+        if (FLTERR_WARNING (err))
+        {
+            GtkWidget *dialog =
+                gtk_message_dialog_new (GTK_WINDOW (topWidget),
+                                        GTK_DIALOG_DESTROY_WITH_PARENT,
+                                        GTK_MESSAGE_WARNING,
+                                        GTK_BUTTONS_CLOSE,
+                                        _("Filter generation has dropped some"
+                                          " (near zero) coefficients, but the"
+                                          " filter is still valid."));
+            gtk_dialog_run (GTK_DIALOG (dialog));
+            gtk_widget_destroy (dialog);
+        } /* if */
+
+
+        gtk_widget_set_sensitive (lookup_widget (topWidget, "toolBtnSave"), valid);
+        gtk_widget_set_sensitive (lookup_widget (topWidget, "menuItemFileSave"), valid);
+        gtk_widget_set_sensitive (lookup_widget (topWidget, "menuItemFileSaveAs"), valid);
+        gtk_widget_set_sensitive (lookup_widget (topWidget, "menuItemFileExport"), valid);
+        gtk_widget_set_sensitive (lookup_widget (topWidget, "menuItemFilePrint"), valid);
+
+        coeffRedrawListTreeViews ();
+        responseWinRedraw (RESPONSE_TYPE_SIZE);
+
+        if (track)
+        {
+            rootsPlotTrack (pFilter);
+        } /* if */
+        else
+        {
+            rootsPlotUpdate (pFilter);
+        } /* else */
+
+        return TRUE;
+    } /* if */
+
+    return FALSE;
+} /* updateFilter() */
+
+
+
 /* EXPORTED FUNCTION DEFINITIONS **********************************************/
 
 
@@ -872,6 +940,71 @@ GtkWidget* mainDlgCreate (void)
                       G_CALLBACK (responseWinMenuActivate),
                       GINT_TO_POINTER (RESPONSE_TYPE_STEP));
 
+    menuItem = gtk_check_menu_item_new_with_mnemonic (_("_User Signal Response"));
+    gtk_container_add (GTK_CONTAINER (menuContainer), menuItem);
+    g_signal_connect ((gpointer) menuItem, "activate",
+                      G_CALLBACK (responseWinMenuActivate),
+                      GINT_TO_POINTER (RESPONSE_TYPE_SIGNAL));
+
+    menuItem = gtk_menu_item_new_with_mnemonic (_("_Load User Signal..."));
+    gtk_container_add (GTK_CONTAINER (menuContainer), menuItem);
+    g_signal_connect ((gpointer) menuItem, "activate",
+                      G_CALLBACK (responseWinSignalActivate), NULL);
+
+    widget = gtk_separator_menu_item_new ();
+    gtk_container_add (GTK_CONTAINER (menuContainer), widget);
+    gtk_widget_set_sensitive (widget, FALSE);
+
+    widget = gtk_menu_item_new_with_mnemonic (_("_Fixed-Point Simulation"));
+    gtk_container_add (GTK_CONTAINER (menuContainer), widget);
+    submenuContainer = gtk_menu_new ();
+    gtk_menu_item_set_submenu (GTK_MENU_ITEM (widget), submenuContainer);
+
+    menuItem = gtk_radio_menu_item_new_with_mnemonic (NULL, _("_Off"));
+    gtk_container_add (GTK_CONTAINER (submenuContainer), menuItem);
+    g_signal_connect ((gpointer) menuItem, "activate",
+                      G_CALLBACK (responseWinFixedActivate),
+                      GINT_TO_POINTER (FLTFIXED_SIZE));
+
+    menuItem = gtk_radio_menu_item_new_with_mnemonic_from_widget (
+        GTK_RADIO_MENU_ITEM (menuItem), _("Q_15 (16 bit)"));
+    gtk_container_add (GTK_CONTAINER (submenuContainer), menuItem);
+    g_signal_connect ((gpointer) menuItem, "activate",
+                      G_CALLBACK (responseWinFixedActivate),
+                      GINT_TO_POINTER (FLTFIXED_Q15));
+
+    menuItem = gtk_radio_menu_item_new_with_mnemonic_from_widget (
+        GTK_RADIO_MENU_ITEM (menuItem), _("Q_31 (32 bit)"));
+    gtk_container_add (GTK_CONTAINER (submenuContainer), menuItem);
+    g_signal_connect ((gpointer) menuItem, "activate",
+                      G_CALLBACK (responseWinFixedActivate),
+                      GINT_TO_POINTER (FLTFIXED_Q31));
+
+    widget = gtk_separator_menu_item_new ();
+    gtk_container_add (GTK_CONTAINER (submenuContainer), widget);
+    gtk_widget_set_sensitive (widget, FALSE);
+
+    menuItem = gtk_radio_menu_item_new_with_mnemonic (NULL, _("_Truncation"));
+    gtk_container_add (GTK_CONTAINER (submenuContainer), menuItem);
+    g_signal_connect ((gpointer) menuItem, "activate",
+                      G_CALLBACK (responseWinRoundActivate),
+                      GINT_TO_POINTER (FLTFIXED_ROUND_TRUNC));
+
+    menuItem = gtk_radio_menu_item_new_with_mnemonic_from_widget (
+        GTK_RADIO_MENU_ITEM (menuItem), _("Round to _Nearest"));
+    gtk_check_menu_item_set_active (GTK_CHECK_MENU_ITEM (menuItem), TRUE);
+    gtk_container_add (GTK_CONTAINER (submenuContainer), menuItem);
+    g_signal_connect ((gpointer) menuItem, "activate",
+                      G_CALLBACK (responseWinRoundActivate),
+                      GINT_TO_POINTER (FLTFIXED_ROUND_NEAREST));
+
+    menuItem = gtk_radio_menu_item_new_with_mnemonic_from_widget (
+        GTK_RADIO_MENU_ITEM (menuItem), _("_Convergent Rounding"));
+    gtk_container_add (GTK_CONTAINER (submenuContainer), menuItem);
+    g_signal_connect ((gpointer) menuItem, "activate",
+                      G_CALLBACK (responseWinRoundActivate),
+                      GINT_TO_POINTER (FLTFIXED_ROUND_CONVERGENT));
+
     menuMainItem = gtk_menu_item_new_with_mnemonic (GUI_MENU_LABEL_HELP);
     gtk_container_add (GTK_CONTAINER (menuMain), menuMainItem);
 
@@ -1179,40 +1312,7 @@ void mainDlgUpdatePrjInfo ()
  ******************************************************************************/
 BOOL mainDlgUpdateFilter (int err)
 {
-    FLTCOEFF* pFilter = dfcPrjGetFilter ();
-    BOOL valid = pFilter != NULL;
-
-    if (!FLTERR_CRITICAL (err))
-    {
-        if (FLTERR_WARNING (err))
-        {
-            GtkWidget *dialog =
-                gtk_message_dialog_new (GTK_WINDOW (topWidget),
-                                        GTK_DIALOG_DESTROY_WITH_PARENT,
-                                        GTK_MESSAGE_WARNING,
-                                        GTK_BUTTONS_CLOSE,
-                                        _("Filter generation has dropped some"
-                                          " (near zero) coefficients, but the"
-                                          " filter is still valid."));
-            gtk_dialog_run (GTK_DIALOG (dialog));
-            gtk_widget_destroy (dialog);
-        } /* if */
-
-
-        gtk_widget_set_sensitive (lookup_widget (topWidget, "toolBtnSave"), valid);
-        gtk_widget_set_sensitive (lookup_widget (topWidget, "menuItemFileSave"), valid);
-        gtk_widget_set_sensitive (lookup_widget (topWidget, "menuItemFileSaveAs"), valid);
-        gtk_widget_set_sensitive (lookup_widget (topWidget, "menuItemFileExport"), valid);
-        gtk_widget_set_sensitive (lookup_widget (topWidget, "menuItemFilePrint"), valid);
-
-        coeffRedrawListTreeViews ();
-        responseWinRedraw (RESPONSE_TYPE_SIZE);
-        rootsPlotUpdate (pFilter);
-
-        return TRUE;
-    } /* if */
-
-    return FALSE;
+    return updateFilter (err, FALSE);
 } /* mainDlgUpdateFilter() */
 
 
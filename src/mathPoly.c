@@ -10,7 +10,9 @@
 #include "mathPoly.h"
 #include "mathMisc.h"
 
-#include <string.h> /* memcpy() */
+#include <string.h> /* memcpy(), memset() */
+#include <gsl/gsl_fft_real.h>
+#include <gsl/gsl_fft_halfcomplex.h>
 
 
 /* GLOBAL CONSTANT DEFINITIONS ************************************************/
@@ -22,18 +24,80 @@
 /* LOCAL TYPE DECLARATIONS ****************************************************/
 
 
+/** Memory chunk of a scratch arena. The (aligned) allocations follow the
+ *  header.
+ */
+typedef struct _MATHPOLY_CHUNK
+{
+    struct _MATHPOLY_CHUNK *pNext;            /**< Next (older) chunk or NULL */
+    gsize size;                     /**< Size of chunk (without header) */
+    gsize used;                                 /**< Number of bytes in use */
+} MATHPOLY_CHUNK;
+
+
+/** Scratch arena (one per thread).
+ */
+typedef struct
+{
+    int depth;               /**< Nesting depth of mathPolyArenaBegin() calls */
+    gsize hint;       /**< Bytes used by the last design (size of next chunk) */
+    MATHPOLY_CHUNK *pChunk;            /**< Current (newest) chunk or NULL */
+} MATHPOLY_ARENA;
+
+
 /* LOCAL CONSTANT DEFINITIONS *************************************************/
 
+#define MATHPOLY_ABERTH_DEGREE  16 /**< Minimum degree for Aberth iteration */
+#define MATHPOLY_ABERTH_ITERMAX 100 /**< Maximum number of Aberth iterations */
+#define MATHPOLY_ABERTH_ANGLE   0.7 /**< Angle offset of Aberth start values */
+#define MATHPOLY_MUL_FFT_DEGREE 128  /**< Minimum degree for FFT multiplication */
+#define MATHPOLY_REAL_EPSILON   (16 * DBL_EPSILON) /**< Real root tolerance */
+#define MATHPOLY_ARENA_CHUNK    65536     /**< Minimum size of arena chunks */
+#define MATHPOLY_ARENA_MARK     0xFF   /**< Marks blocks owned by an arena */
+
 
 /* LOCAL VARIABLE DEFINITIONS *************************************************/
 
+static void polyArenaDestroy (gpointer pArena);
+
+/** Scratch arena of the calling thread (see mathPolyArenaBegin()).
+ */
+static GPrivate polyArenaKey = G_PRIVATE_INIT (polyArenaDestroy);
+
 
 /* LOCAL MACRO DEFINITIONS ****************************************************/
 
 
+/* MACRO **********************************************************************/
+/** Rounds a memory size up to a multiple of MATHPOLY_ALIGN.
+ *
+ *  \param size         Size in bytes.
+ *
+ *  \return             Aligned size in bytes.
+ ******************************************************************************/
+#define MATHPOLY_ALIGN_SIZE(size) \
+    (((size) + MATHPOLY_ALIGN - 1) & ~((gsize) MATHPOLY_ALIGN - 1))
+
+
 /* LOCAL FUNCTION DECLARATIONS ************************************************/
 
 static double chebyT(double degree, double x);
+static BOOL polyLogDerivative (const double coeff[], int degree,
+                               gsl_complex z, gsl_complex *pResult);
+static int polyAberthStart (const double coeff[], int degree,
+                            gsl_complex root[]);
+static int polyAberth (MATHPOLY *poly, int maxiter);
+static int polyMulReal (const double a[], int dega,
+                        const double b[], int degb,
+                        double result[], double work[]);
+static int polyFactors (const double re[], const double im[], int n,
+                        double factor[], int degree[], char used[]);
+static void polyLeja (double factor[], int degree[], int count, double work[]);
+static void *polyAlignedAlloc (gsize size);
+static void polyAlignedFree (void *ptr);
+static void *polyScratchAlloc (gsize size);
+static void polyArenaRelease (MATHPOLY_ARENA *pArena, BOOL keep);
+static int polyMallocBlock (MATHPOLY *poly, BOOL scratch);
 
 
 /* LOCAL FUNCTION DEFINITIONS *************************************************/
@@ -72,77 +136,831 @@ static double chebyT(double degree, double x)
 } /* chebyT() */
 
 
+/* FUNCTION *******************************************************************/
+/** Evaluates the logarithmic derivative \f$p'(z)/p(z)\f$ of a polynomial by
+ *  \e Horner's scheme. If \f$|z|>1\f$ the reversed polynomial
+ *  \f$q(w)=w^n p(1/w)\f$ is evaluated at \f$w=1/z\f$ (to avoid overflow),
+ *  using \f$p'(z)/p(z)=w\,(n-w\,q'(w)/q(w))\f$.
+ *
+ *  \param coeff        Coefficients of polynomial \f$p\f$.
+ *  \param degree       Degree \f$n\f$ of polynomial.
+ *  \param z            Argument.
+ *  \param pResult      Pointer to buffer which gets the logarithmic
+ *                      derivative (unchanged if \p z is a root).
+ *
+ *  \return             TRUE if \p z is a root of \f$p\f$ (the value of
+ *                      \f$p(z)\f$ is in the range of rounding errors), else
+ *                      FALSE.
+ ******************************************************************************/
+static BOOL polyLogDerivative (const double coeff[], int degree,
+                               gsl_complex z, gsl_complex *pResult)
+{
+    int i, j, step;
+    double tmp, abs2, bound;
+    double x = GSL_REAL (z), y = GSL_IMAG (z);
+    double absx = hypot (x, y);
+    double re, im = 0.0, dre = 0.0, dim = 0.0;          /* p(x) and p'(x) */
+    BOOL reverse = absx > 1.0;
+
+    if (reverse)                                /* evaluate q(w) at w = 1/z */
+    {
+        abs2 = x * x + y * y;
+        x /= abs2;
+        y /= -abs2;
+        absx = 1.0 / absx;
+        j = 0;
+        step = 1;
+    } /* if */
+    else
+    {
+        j = degree;
+        step = -1;
+    } /* else */
 
-/* EXPORTED FUNCTION DEFINITIONS **********************************************/
+    re = coeff[j];
+    bound = fabs (re);               /* bound of rounding errors (by Horner) */
+
+    for (i = 0; i < degree; i++)
+    {
+        j += step;
+
+        tmp = dre * x - dim * y + re;                  /* p'(x) = p'(x) x + p */
+        dim = dre * y + dim * x + im;
+        dre = tmp;
+
+        tmp = re * x - im * y + coeff[j];             /* p(x) = p(x) x + c[j] */
+        im = re * y + im * x;
+        re = tmp;
+
+        bound = bound * absx + fabs (coeff[j]);
+    } /* for */
+
+    if (hypot (re, im) <= degree * DBL_EPSILON * bound)
+    {
+        return TRUE;                               /* root (numerical zero) */
+    } /* if */
+
+    abs2 = GSL_MAX_DBL (fabs (re), fabs (im));    /* scale (avoid underflow) */
+    re /= abs2;
+    im /= abs2;
+    dre /= abs2;
+    dim /= abs2;
+    abs2 = re * re + im * im;                              /* p'(x) / p(x) */
+    tmp = (dre * re + dim * im) / abs2;
+    dim = (dim * re - dre * im) / abs2;
+    dre = tmp;
+
+    if (reverse)                                     /* w * (n - w q'/q) */
+    {
+        tmp = degree - (x * dre - y * dim);
+        dim = -(x * dim + y * dre);
+        dre = tmp;
+
+        tmp = x * dre - y * dim;
+        dim = x * dim + y * dre;
+        dre = tmp;
+    } /* if */
+
+    GSL_SET_COMPLEX (pResult, dre, dim);
+
+    return FALSE;
+} /* polyLogDerivative() */
 
 
 /* FUNCTION *******************************************************************/
-/** Allocates memory space for the coefficients of a polynomial.
+/** Computes the start values of the \e Aberth iteration. The roots are placed
+ *  on circles with radii computed from the upper convex hull of the points
+ *  \f$(i,\log|c_i|)\f$ (\e Newton polygon), which approximates the moduli of
+ *  the roots much better than a single circle.
  *
- *  \param poly         Pointer to polynomial.
+ *  \param coeff        Coefficients of polynomial (\f$c_0\f$ and \f$c_n\f$
+ *                      must not be zero).
+ *  \param degree       Degree \f$n\f$ of polynomial.
+ *  \param root         Array which gets the \f$n\f$ start values.
  *
  *  \return             Zero on success, else an error number.
  ******************************************************************************/
-int mathPolyMallocCoeffs (MATHPOLY *poly)
+static int polyAberthStart (const double coeff[], int degree,
+                            gsl_complex root[])
 {
-    poly->coeff = g_malloc ((1 + poly->degree) * sizeof(poly->coeff[0]));
+    int i, j, k, m, hull = 0;
+    double radius, angle;
+    int *vertex = g_malloc ((degree + 1) * sizeof(vertex[0]));
 
-    if (poly->coeff == NULL)
+    if (vertex == NULL)
     {
-        return ENOMEM;
+        return GSL_ENOMEM;
     } /* if */
 
+    for (i = 0; i <= degree; i++)                        /* monotone chain */
+    {
+        if (coeff[i] != 0.0)
+        {
+            while ((hull >= 2) &&
+                   ((log (fabs (coeff[vertex[hull - 1]] / coeff[vertex[hull - 2]]))
+                     * (i - vertex[hull - 2])) <=
+                    (log (fabs (coeff[i] / coeff[vertex[hull - 2]]))
+                     * (vertex[hull - 1] - vertex[hull - 2]))))
+            {
+                --hull;                  /* vertex is below (or on) the hull */
+            } /* while */
+
+            vertex[hull++] = i;
+        } /* if */
+    } /* for */
+
+    for (k = 1; k < hull; k++)          /* m roots with the same modulus */
+    {
+        i = vertex[k - 1];
+        m = vertex[k] - i;
+        radius = pow (fabs (coeff[i] / coeff[vertex[k]]), 1.0 / m);
+
+        for (j = 0; j < m; j++)
+        {
+            angle = 2.0 * M_PI * ((double)j / m + (double)i / degree)
+                + MATHPOLY_ABERTH_ANGLE;
+            root[i + j] = gsl_complex_polar (radius, angle);
+        } /* for */
+    } /* for */
+
+    g_free (vertex);
+
     return 0;
-} /* mathPolyMallocCoeffs() */
+} /* polyAberthStart() */
+
+
+/* FUNCTION *******************************************************************/
+/** Computes the roots of a polynomial by \e Aberth-Ehrlich iteration
+    \f[
+    z_k \leftarrow z_k - \frac{1}{\frac{p'(z_k)}{p(z_k)}-
+                                   \sum_{j\neq k}\frac{1}{z_k-z_j}}
+    \f]
+ *  which converges cubically (for simple roots) and costs \f$O(n^2)\f$ per
+ *  iteration. All corrections of one iteration are computed from the roots
+ *  of the previous iteration (total-step), so the loop over the roots has no
+ *  dependencies and can run in parallel. Roots are frozen when \f$p(z_k)\f$
+ *  drops into the range of rounding errors or the correction gets
+ *  negligible.
+ *
+ *  \param poly         Pointer to polynomial, which holds the start values
+ *                      in \p poly->root (\f$c_0\f$ and \f$c_n\f$ must not be
+ *                      zero).
+ *  \param maxiter      Maximum number of iterations.
+ *
+ *  \return             Zero on success, else an error number (see gsl_errno.h
+ *                      for predefined codes).
+ ******************************************************************************/
+static int polyAberth (MATHPOLY *poly, int maxiter)
+{
+    int i, k, iter;
+    double re, im, dre, dim, abs2;
+
+    int n = poly->degree, pending = poly->degree;
+    gsl_complex *z = poly->root;
+    gsl_complex *corr = g_malloc (n * sizeof(corr[0]));
+    BOOL *done = g_malloc0 (n * sizeof(done[0]));
+
+    if ((corr == NULL) || (done == NULL))
+    {
+        g_free (corr);
+        g_free (done);
+        return GSL_ENOMEM;
+    } /* if */
+
+    for (iter = 0; (iter < maxiter) && (pending > 0); iter++)
+    {
+        for (k = 0; k < n; k++)                     /* independent on k */
+        {
+            if (!done[k])
+            {
+                done[k] = polyLogDerivative (poly->coeff, n, z[k], &corr[k]);
+
+                if (!done[k])
+                {
+                    re = GSL_REAL (corr[k]);
+                    im = GSL_IMAG (corr[k]);
+
+                    for (i = 0; i < n; i++)     /* subtract sum 1/(z_k - z_i) */
+                    {
+                        if (i != k)
+                        {
+                            dre = GSL_REAL (z[k]) - GSL_REAL (z[i]);
+                            dim = GSL_IMAG (z[k]) - GSL_IMAG (z[i]);
+                            abs2 = dre * dre + dim * dim;
+                            re -= dre / abs2;
+                            im += dim / abs2;
+                        } /* if */
+                    } /* for */
+
+                    corr[k] = gsl_complex_inverse (gsl_complex_rect (re, im));
+                } /* if */
+            } /* if */
+        } /* for */
+
+        pending = 0;
+
+        for (k = 0; k < n; k++)
+        {
+            if (!done[k])
+            {
+                z[k] = gsl_complex_sub (z[k], corr[k]);
+
+                if (!gsl_finite (GSL_REAL (z[k])) ||
+                    !gsl_finite (GSL_IMAG (z[k])))
+                {
+                    g_free (corr);
+                    g_free (done);
+                    return GSL_EFAILED;        /* coincident approximations */
+                } /* if */
+
+                if (gsl_complex_abs (corr[k]) <=
+                    DBL_EPSILON * gsl_complex_abs (z[k]))
+                {
+                    done[k] = TRUE;
+                } /* if */
+                else
+                {
+                    ++pending;
+                } /* else */
+            } /* if */
+        } /* for */
+    } /* for */
+
+    g_free (corr);
+    g_free (done);
+
+    DEBUG_LOG ("Aberth iteration of degree %d: %d iterations", n, iter);
+
+    return (pending > 0) ? GSL_EMAXITER : 0;
+} /* polyAberth() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Multiplies two real polynomials. If both polynomials have a degree of
+ *  MATHPOLY_MUL_FFT_DEGREE at least, the product is computed by real radix-2
+ *  FFT's (\f$O(n\log n)\f$), else by the schoolbook method (\f$O(n^2)\f$).
+ *  Notice that the rounding errors of the FFT method are related to the
+ *  greatest coefficient (not to each coefficient), which is the same order
+ *  of magnitude as the errors of evaluating the polynomial on the unit
+ *  circle.
+ *
+ *  \param a            Coefficients of first polynomial.
+ *  \param dega         Degree of first polynomial.
+ *  \param b            Coefficients of second polynomial.
+ *  \param degb         Degree of second polynomial.
+ *  \param result       Array which gets the \f$\deg a+\deg b+1\f$
+ *                      coefficients of the product (must not overlap \p a
+ *                      or \p b).
+ *  \param work         Workspace of \f$2^{k+1}\f$ elements, with \f$2^k\f$
+ *                      the smallest power of two greater than
+ *                      \f$\deg a+\deg b\f$ (only used in case of FFT).
+ *
+ *  \return             Zero on success, else an error number (see gsl_errno.h
+ *                      for predefined codes).
+ ******************************************************************************/
+static int polyMulReal (const double a[], int dega,
+                        const double b[], int degb,
+                        double result[], double work[])
+{
+    int i, k, half, size;
+    double re, im;
+    double *fa, *fb;
+
+    int err = 0;
+
+    if (MIN (dega, degb) < MATHPOLY_MUL_FFT_DEGREE)          /* schoolbook */
+    {
+        memset (result, 0, (dega + degb + 1) * sizeof(result[0]));
+
+        for (i = 0; i <= dega; i++)
+        {
+            for (k = 0; k <= degb; k++)
+            {
+                result[i + k] += a[i] * b[k];
+            } /* for */
+        } /* for */
+
+        return 0;
+    } /* if */
+
+    for (size = 1; size <= dega + degb; size *= 2)
+    {
+        ;
+    } /* for */
+
+    half = size / 2;
+    fa = work;
+    fb = work + size;
+    memcpy (fa, a, (dega + 1) * sizeof(fa[0]));
+    memset (fa + dega + 1, 0, (size - dega - 1) * sizeof(fa[0]));
+    memcpy (fb, b, (degb + 1) * sizeof(fb[0]));
+    memset (fb + degb + 1, 0, (size - degb - 1) * sizeof(fb[0]));
+
+    err = gsl_fft_real_radix2_transform (fa, 1, size);
+
+    if (err == GSL_SUCCESS)
+    {
+        err = gsl_fft_real_radix2_transform (fb, 1, size);
+    } /* if */
+
+    if (err != GSL_SUCCESS)
+    {
+        return err;
+    } /* if */
+
+    fa[0] *= fb[0];                          /* multiply in halfcomplex format */
+    fa[half] *= fb[half];
+
+    for (k = 1; k < half; k++)
+    {
+        re = fa[k] * fb[k] - fa[size - k] * fb[size - k];
+        im = fa[k] * fb[size - k] + fa[size - k] * fb[k];
+        fa[k] = re;
+        fa[size - k] = im;
+    } /* for */
+
+    err = gsl_fft_halfcomplex_radix2_inverse (fa, 1, size);
+
+    if (err == GSL_SUCCESS)
+    {
+        memcpy (result, fa, (dega + degb + 1) * sizeof(result[0]));
+    } /* if */
+
+    return err;
+} /* polyMulReal() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Combines the roots of a real polynomial into real factors. Each pair of
+ *  conjugate complex roots \f$z_i,z_i^*\f$ results in a quadratic factor
+    \f[
+    (z-z_i)(z-z_i^*)=z^2-2\Re(z_i)z+|z_i|^2
+    \f]
+ *  and each real root in a linear factor. Roots with an imaginary part which
+ *  is negligible (related to the modulus) are treated as real. The partner of
+ *  a complex root is the nearest conjugate of all remaining roots.
+ *
+ *  The roots are passed as separate arrays of real and imaginary parts
+ *  (instead of gsl_complex), so that the search for the conjugate runs over
+ *  contiguous memory and can be vectorized by the compiler.
+ *
+ *  \param re           Real parts of the roots.
+ *  \param im           Imaginary parts of the roots.
+ *  \param n            Number of roots (degree of polynomial).
+ *  \param factor       Array which gets the coefficients \f$c_0,c_1,c_2\f$ of
+ *                      the factors (three elements per factor, \f$c_2=0\f$
+ *                      for linear factors).
+ *  \param degree       Array which gets the degree of the factors.
+ *  \param used         Workspace of \p n elements.
+ *
+ *  \return             Number of factors, or a negative number if there is a
+ *                      complex root without conjugate partner.
+ ******************************************************************************/
+static int polyFactors (const double re[], const double im[], int n,
+                        double factor[], int degree[], char used[])
+{
+    int i, k, best;
+    double xre, xim, dist, mindist;
+
+    int count = 0;
+
+    memset (used, 0, n * sizeof(used[0]));
+
+    for (i = 0; i < n; i++)
+    {
+        if (!used[i])
+        {
+            used[i] = TRUE;
+            xre = re[i];
+            xim = fabs (im[i]);
+            best = -1;
+
+            if (xim > MATHPOLY_REAL_EPSILON * fabs (xre))
+            {
+                mindist = GSL_POSINF;
+
+                for (k = i + 1; k < n; k++)            /* search conjugate */
+                {
+                    dist = (re[k] - xre) * (re[k] - xre)
+                         + (im[k] + im[i]) * (im[k] + im[i]);
+
+                    if (!used[k] && (dist < mindist))
+                    {
+                        mindist = dist;
+                        best = k;
+                    } /* if */
+                } /* for */
+            } /* if */
+
+            if (best < 0)                                   /* linear factor */
+            {
+                if (xim > MATHPOLY_REAL_EPSILON * fabs (xre))
+                {
+                    return -1;                      /* unpaired complex root */
+                } /* if */
+
+                factor[3 * count] = -xre;
+                factor[3 * count + 1] = 1.0;
+                factor[3 * count + 2] = 0.0;
+                degree[count] = 1;
+            } /* if */
+            else                                         /* quadratic factor */
+            {
+                used[best] = TRUE;
+                xre = 0.5 * (xre + re[best]);
+                xim = 0.5 * (xim + fabs (im[best]));
+                factor[3 * count] = xre * xre + xim * xim;
+                factor[3 * count + 1] = -2.0 * xre;
+                factor[3 * count + 2] = 1.0;
+                degree[count] = 2;
+            } /* else */
+
+            ++count;
+        } /* if */
+    } /* for */
+
+    return count;
+} /* polyFactors() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Sorts real factors (linear or quadratic) into \e Leja order. The first
+ *  factor is that with the root of greatest modulus, then each next one
+ *  maximizes the product of distances from its root(s) to the roots of all
+ *  factors before. Multiplying in this order keeps intermediate coefficients
+ *  (and therefore the growth of rounding errors) small.
+ *
+ *  \param factor       Array with the coefficients of factors (three elements
+ *                      per factor, see polyFactors()).
+ *  \param degree       Array with the degree of each factor.
+ *  \param count        Number of factors.
+ *  \param work         Workspace of \p count elements.
+ *
+ ******************************************************************************/
+static void polyLeja (double factor[], int degree[], int count, double work[])
+{
+    int i, k, best, tmp;
+    double re, im, xre, xim, swap[3];
+
+    for (i = 0; i < count; i++)      /* start with modulus (as logarithm) */
+    {
+        work[i] = (degree[i] == 1) ? log (fabs (factor[3 * i]))
+                                   : 0.5 * log (factor[3 * i]);
+    } /* for */
+
+    for (k = 0; k < count; k++)
+    {
+        best = k;
+
+        for (i = k + 1; i < count; i++)
+        {
+            if (work[i] > work[best])
+            {
+                best = i;
+            } /* if */
+        } /* for */
+
+        memcpy (swap, &factor[3 * k], sizeof(swap));     /* exchange k, best */
+        memcpy (&factor[3 * k], &factor[3 * best], sizeof(swap));
+        memcpy (&factor[3 * best], swap, sizeof(swap));
+        tmp = degree[k];
+        degree[k] = degree[best];
+        degree[best] = tmp;
+        work[best] = work[k];
+
+        xre = -0.5 * factor[3 * k + 1];          /* (upper) root of factor k */
+        xim = 0.0;
+
+        if (degree[k] == 1)
+        {
+            xre = -factor[3 * k];
+        } /* if */
+        else
+        {
+            xim = sqrt (fabs (factor[3 * k] - xre * xre));
+        } /* else */
+
+        for (i = k + 1; i < count; i++)   /* add log distances to new roots */
+        {
+            if (k == 0)
+            {
+                work[i] = 0.0;
+            } /* if */
+
+            re = -0.5 * factor[3 * i + 1];
+            im = 0.0;
+
+            if (degree[i] == 1)
+            {
+                re = -factor[3 * i];
+            } /* if */
+            else
+            {
+                im = sqrt (fabs (factor[3 * i] - re * re));
+            } /* else */
+
+            work[i] += log (hypot (re - xre, im - xim));
+
+            if (degree[k] == 2)
+            {
+                work[i] += log (hypot (re - xre, im + xim));
+            } /* if */
+        } /* for */
+    } /* for */
+
+} /* polyLeja() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Allocates a memory block which is aligned to MATHPOLY_ALIGN bytes. The
+ *  offset to the (unaligned) block from g_malloc() is stored in the byte
+ *  just before the aligned block.
+ *
+ *  \param size         Size of memory block (in bytes).
+ *
+ *  \return             Pointer to aligned memory block, NULL on error. Use
+ *                      polyAlignedFree() to free it.
+ ******************************************************************************/
+static void *polyAlignedAlloc (gsize size)
+{
+    int offset;
+    guint8 *pMem = g_malloc (size + MATHPOLY_ALIGN);
+
+    if (pMem == NULL)
+    {
+        DEBUG_LOG ("Polynomial memory allocation");
+        return NULL;
+    } /* if */
+
+    offset = MATHPOLY_ALIGN - (int) ((guintptr) pMem % MATHPOLY_ALIGN);
+    pMem += offset;                                          /* 1...ALIGN */
+    pMem[-1] = (guint8) (offset - 1);
+
+    return pMem;
+} /* polyAlignedAlloc() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Frees a memory block allocated by polyAlignedAlloc() or polyScratchAlloc().
+ *  Blocks owned by a scratch arena are not touched (they are released by
+ *  mathPolyArenaEnd()).
+ *
+ *  \param ptr          Pointer to aligned memory block.
+ *
+ ******************************************************************************/
+static void polyAlignedFree (void *ptr)
+{
+    guint8 *pMem = ptr;
+
+    if (pMem[-1] != MATHPOLY_ARENA_MARK)
+    {
+        g_free (pMem - pMem[-1] - 1);
+    } /* if */
+} /* polyAlignedFree() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Allocates a scratch memory block which is aligned to MATHPOLY_ALIGN bytes.
+ *  If the calling thread has opened a scratch arena (see mathPolyArenaBegin())
+ *  the block is taken from it, else from the heap (see polyAlignedAlloc()).
+ *  Free it by polyAlignedFree() in any case.
+ *
+ *  \param size         Size of memory block (in bytes).
+ *
+ *  \return             Pointer to aligned memory block, NULL on error.
+ ******************************************************************************/
+static void *polyScratchAlloc (gsize size)
+{
+    guint8 *pMem;
+    gsize start = 0, chunk;
+    MATHPOLY_CHUNK *pChunk;
+
+    MATHPOLY_ARENA *pArena = g_private_get (&polyArenaKey);
+
+    if ((pArena == NULL) || (pArena->depth == 0))
+    {
+        return polyAlignedAlloc (size);
+    } /* if */
+
+    pChunk = pArena->pChunk;
+
+    if (pChunk != NULL)      /* aligned start (one byte for the mark before) */
+    {
+        start = MATHPOLY_ALIGN_SIZE ((guintptr) (pChunk + 1) + pChunk->used + 1)
+            - (guintptr) (pChunk + 1);
+    } /* if */
+
+    if ((pChunk == NULL) || (start + size > pChunk->size))   /* new chunk */
+    {
+        chunk = MAX (MAX (MATHPOLY_ARENA_CHUNK, pArena->hint),
+                     size + MATHPOLY_ALIGN);
+        pChunk = g_malloc (sizeof(MATHPOLY_CHUNK) + chunk);
+
+        if (pChunk == NULL)
+        {
+            DEBUG_LOG ("Scratch arena allocation");
+            return NULL;
+        } /* if */
+
+        pChunk->pNext = pArena->pChunk;
+        pChunk->size = chunk;
+        pChunk->used = 0;
+        pArena->pChunk = pChunk;
+        start = MATHPOLY_ALIGN_SIZE ((guintptr) (pChunk + 1) + 1)
+            - (guintptr) (pChunk + 1);
+    } /* if */
+
+    pMem = (guint8 *) (pChunk + 1) + start;
+    pMem[-1] = MATHPOLY_ARENA_MARK;
+    pChunk->used = start + size;
+
+    return pMem;
+} /* polyScratchAlloc() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Releases all memory of a scratch arena.
+ *
+ *  \param pArena       Pointer to arena.
+ *  \param keep         If TRUE and the arena consists of one chunk only, then
+ *                      this chunk is kept (for the next design), else the
+ *                      next chunk is sized to the memory used so far.
+ *
+ ******************************************************************************/
+static void polyArenaRelease (MATHPOLY_ARENA *pArena, BOOL keep)
+{
+    MATHPOLY_CHUNK *pChunk;
+
+    if (keep && (pArena->pChunk != NULL) && (pArena->pChunk->pNext == NULL))
+    {
+        pArena->pChunk->used = 0;
+        return;
+    } /* if */
+
+    pArena->hint = 0;
+
+    while (pArena->pChunk != NULL)
+    {
+        pChunk = pArena->pChunk;
+        pArena->pChunk = pChunk->pNext;
+        pArena->hint += pChunk->used + MATHPOLY_ALIGN;
+        g_free (pChunk);
+    } /* while */
+
+} /* polyArenaRelease() */
+
 
 
 /* FUNCTION *******************************************************************/
-/** Allocates memory space for the roots of a polynomial.
+/** Destroys the scratch arena of a thread (called on thread exit).
+ *
+ *  \param pArena       Pointer to arena (MATHPOLY_ARENA).
+ *
+ ******************************************************************************/
+static void polyArenaDestroy (gpointer pArena)
+{
+    if (pArena != NULL)
+    {
+        polyArenaRelease (pArena, FALSE);
+        g_free (pArena);
+    } /* if */
+} /* polyArenaDestroy() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Allocates the memory block of a polynomial (see mathPolyMalloc()).
  *
  *  \param poly         Pointer to polynomial.
+ *  \param scratch      If TRUE the block is taken from the scratch arena (if
+ *                      any), else from the heap.
  *
- *  \return             Zero on success, else an error number.
+ *  \return             0 on success, else an error number.
  ******************************************************************************/
-int mathPolyMallocRoots (MATHPOLY *poly)
+static int polyMallocBlock (MATHPOLY *poly, BOOL scratch)
 {
-    poly->root = g_malloc (GSL_MAX_INT (1, poly->degree) * sizeof(poly->root[0]));
+    char *pMem;
+    gsize size = MATHPOLY_ALIGN_SIZE ((1 + poly->degree) * sizeof(poly->coeff[0]));
+    gsize total = size + GSL_MAX_INT (1, poly->degree) * sizeof(poly->root[0]);
+
+    pMem = scratch ? polyScratchAlloc (total) : polyAlignedAlloc (total);
 
-    if (poly->root == NULL)
+    if (pMem == NULL)
     {
+        poly->coeff = NULL;
+        poly->root = NULL;
+        poly->capacity = 0;
         return ENOMEM;
     } /* if */
 
+    poly->coeff = (double *) pMem;
+    poly->root = (gsl_complex *) (pMem + size);
+    poly->capacity = poly->degree;
+
     return 0;
-} /* mathPolyMallocRoots() */
+} /* polyMallocBlock() */
+
+
+
+/* EXPORTED FUNCTION DEFINITIONS **********************************************/
 
 
 /* FUNCTION *******************************************************************/
-/** Allocates memory space for a polynomial.
+/** Allocates memory space for the coefficients of a polynomial. The memory
+ *  block is the same as allocated by mathPolyMalloc() (with space for the
+ *  roots).
  *
  *  \param poly         Pointer to polynomial.
  *
  *  \return             Zero on success, else an error number.
  ******************************************************************************/
-int mathPolyMalloc (MATHPOLY *poly)
+int mathPolyMallocCoeffs (MATHPOLY *poly)
 {
-    int ret = mathPolyMallocCoeffs (poly);
+    return mathPolyMalloc (poly);
+} /* mathPolyMallocCoeffs() */
+
 
-    if (ret != 0)
+/* FUNCTION *******************************************************************/
+/** Allocates memory space for the roots of a polynomial. If the coefficients
+ *  are allocated already (by mathPolyMalloc() or mathPolyMallocCoeffs()),
+ *  then the roots have memory space too and nothing is done.
+ *
+ *  \param poly         Pointer to polynomial.
+ *
+ *  \return             Zero on success, else an error number.
+ ******************************************************************************/
+int mathPolyMallocRoots (MATHPOLY *poly)
+{
+    if (poly->coeff == NULL)
     {
-        poly->root = NULL;
-        return ret;
+        return mathPolyMalloc (poly);
     } /* if */
 
-    ret = mathPolyMallocRoots (poly);
+    return mathPolyRealloc (poly, poly->degree);
+} /* mathPolyMallocRoots() */
+
 
-    if (ret != 0)
+/* FUNCTION *******************************************************************/
+/** Allocates memory space for a polynomial. Coefficients and roots are placed
+ *  into one memory block, which is aligned to MATHPOLY_ALIGN bytes:
+ *  - \f$n+1\f$ coefficients (padded to a multiple of MATHPOLY_ALIGN bytes)
+ *  - \f$\max(n,1)\f$ roots (interleaved real and imaginary parts, as
+ *    expected by gsl_poly_complex_solve())
+ *
+ *  with \f$n\f$ the capacity (set to the degree of \p poly).
+ *
+ *  \param poly         Pointer to polynomial.
+ *
+ *  \return             0 on success, else an error number.
+ ******************************************************************************/
+int mathPolyMalloc (MATHPOLY *poly)
+{
+    return polyMallocBlock (poly, FALSE);
+} /* mathPolyMalloc() */
+
+
+/* FUNCTION *******************************************************************/
+/** Changes the degree of a polynomial. If the new degree exceeds the capacity
+ *  of the polynomial, then a new memory block is allocated, which gets the
+ *  coefficients and roots (up to the old degree). Else only the degree is
+ *  changed (the memory is not touched).
+ *
+ *  \param poly         Pointer to polynomial (allocated by mathPolyMalloc()).
+ *  \param degree       New degree of polynomial.
+ *
+ *  \return             0 on success, else an error number (the polynomial is
+ *                      unchanged in that case).
+ ******************************************************************************/
+int mathPolyRealloc (MATHPOLY *poly, int degree)
+{
+    MATHPOLY tmp;
+
+    if (degree > poly->capacity)
     {
-        g_free (poly->coeff);
-        poly->coeff = NULL;
+        tmp.degree = degree;
+
+        if (mathPolyMalloc (&tmp) != 0)
+        {
+            return ENOMEM;
+        } /* if */
+
+        memcpy (tmp.coeff, poly->coeff, (1 + poly->degree) * sizeof(tmp.coeff[0]));
+        memcpy (tmp.root, poly->root, poly->degree * sizeof(tmp.root[0]));
+        mathPolyFree (poly);
+        *poly = tmp;
     } /* if */
 
-    return ret;
-} /* mathPolyMalloc() */
+    poly->degree = degree;
+
+    return 0;
+} /* mathPolyRealloc() */
 
 
 
@@ -156,16 +974,82 @@ void mathPolyFree(MATHPOLY *poly)
 {
     if (poly->coeff != NULL)
     {
-        g_free (poly->coeff);
+        polyAlignedFree (poly->coeff);              /* roots in same block */
         poly->coeff = NULL;
     } /* if */
 
-    if (poly->root != NULL)
+    poly->root = NULL;
+    poly->capacity = 0;
+} /* mathPolyFree() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Opens a scratch arena for the calling thread. Until the matching call of
+ *  mathPolyArenaEnd() all temporary buffers of the polynomial functions (and
+ *  all polynomials allocated by mathPolyMallocScratch()) are taken from this
+ *  arena, which avoids the allocator churn when generating many filters.
+ *  Calls may be nested, then the arena is released by the outermost
+ *  mathPolyArenaEnd().
+ *
+ ******************************************************************************/
+void mathPolyArenaBegin (void)
+{
+    MATHPOLY_ARENA *pArena = g_private_get (&polyArenaKey);
+
+    if (pArena == NULL)
     {
-        g_free (poly->root);
-        poly->root = NULL;
+        pArena = g_malloc0 (sizeof(MATHPOLY_ARENA));
+
+        if (pArena == NULL)
+        {
+            return;                      /* scratch memory comes from heap */
+        } /* if */
+
+        g_private_set (&polyArenaKey, pArena);
     } /* if */
-} /* mathPolyFree() */
+
+    ++pArena->depth;
+} /* mathPolyArenaBegin() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Closes the scratch arena of the calling thread, opened by
+ *  mathPolyArenaBegin(). The outermost call releases all memory of the arena
+ *  in one shot, so any polynomial allocated by mathPolyMallocScratch() is
+ *  invalid afterwards.
+ *
+ ******************************************************************************/
+void mathPolyArenaEnd (void)
+{
+    MATHPOLY_ARENA *pArena = g_private_get (&polyArenaKey);
+
+    if ((pArena != NULL) && (pArena->depth > 0))
+    {
+        if (--pArena->depth == 0)
+        {
+            polyArenaRelease (pArena, TRUE);
+        } /* if */
+    } /* if */
+} /* mathPolyArenaEnd() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Allocates memory space for a temporary polynomial. The memory layout is
+ *  the same as from mathPolyMalloc(), but the memory is taken from the scratch
+ *  arena of the calling thread (if any, see mathPolyArenaBegin()). Use
+ *  mathPolyFree() as usual, which is a no-op for arena memory.
+ *
+ *  \param poly         Pointer to polynomial.
+ *
+ *  \return             0 on success, else an error number.
+ ******************************************************************************/
+int mathPolyMallocScratch (MATHPOLY *poly)
+{
+    return polyMallocBlock (poly, TRUE);
+} /* mathPolyMallocScratch() */
 
 
 
@@ -351,6 +1235,64 @@ void mathPolyMulBinomial (MATHPOLY *poly, int degn, double a, double b)
 
 
 
+/* FUNCTION *******************************************************************/
+/** Multiplies two polynomials. Polynomials of small degree are multiplied
+ *  by the schoolbook method, those where both degrees are greater than or
+ *  equal to MATHPOLY_MUL_FFT_DEGREE by real FFT's (\f$O(n\log n)\f$).
+ *  The roots of \p result are not touched.
+ *
+ *  \param result       Pointer to polynomial which gets the product. The
+ *                      coefficients vector must be large enough to get
+ *                      \f$\deg p_1+\deg p_2+1\f$ coefficients and must not
+ *                      overlap with one of the factors.
+ *  \param poly1        Pointer to first polynomial \f$p_1\f$.
+ *  \param poly2        Pointer to second polynomial \f$p_2\f$.
+ *
+ *  \return             Zero on success, else an error number (see errno.h or
+ *                      gsl_errno.h for predefined codes).
+ ******************************************************************************/
+int mathPolyMul (MATHPOLY *result, const MATHPOLY *poly1,
+                 const MATHPOLY *poly2)
+{
+    int err, size = 1;
+    double *pWork = NULL;
+
+    ASSERT (result->capacity >= poly1->degree + poly2->degree);
+
+    if (MIN (poly1->degree, poly2->degree) >= MATHPOLY_MUL_FFT_DEGREE)
+    {
+        while (size <= poly1->degree + poly2->degree)
+        {
+            size *= 2;
+        } /* while */
+
+        pWork = polyScratchAlloc (2 * size * sizeof(pWork[0]));
+
+        if (pWork == NULL)
+        {
+            DEBUG_LOG ("Polynomial multiplication");
+            return ENOMEM;
+        } /* if */
+    } /* if */
+
+    err = polyMulReal (poly1->coeff, poly1->degree,
+                       poly2->coeff, poly2->degree, result->coeff, pWork);
+
+    if (err == 0)
+    {
+        result->degree = poly1->degree + poly2->degree;
+    } /* if */
+
+    if (pWork != NULL)
+    {
+        polyAlignedFree (pWork);
+    } /* if */
+
+    return err;
+} /* mathPolyMul() */
+
+
+
 /* FUNCTION *******************************************************************/
 /** Transforms polynomial coefficients for fractional variable substitution.
  *  The function transforms the polynomial
@@ -408,13 +1350,13 @@ int mathPolyTransform (MATHPOLY *poly,
     vecv.degree = degn * poly->degree;
     vecu.degree = MAX (degn, degm) * poly->degree;
 
-    if (mathPolyMalloc (&vecu) != 0)
+    if (mathPolyMallocScratch (&vecu) != 0)
     {
         DEBUG_LOG ("Polynomial memory allocation");
         return ENOMEM;
     } /* if */
 
-    if (mathPolyMalloc (&vecv) != 0)
+    if (mathPolyMallocScratch (&vecv) != 0)
     {
         mathPolyFree (&vecu);
         DEBUG_LOG ("Polynomial memory allocation");
@@ -448,11 +1390,7 @@ int mathPolyTransform (MATHPOLY *poly,
     \f[
     p(z)=c_n z^n + c_{n-1} z^{n-1}+ \cdots + c_2 z^2 + c_1 z + c_0
     \f]
-    is performed using the following algorithm:
-    \f[
-    p_{i+1}(z)=p_{i}(z) (z-z_i)=z p_{i}(z)-z_i p_{i}(z)
-    \f]
- *  with \f$p_{0}(z)=1\f$.
+ *  is performed by mathPolyExpand() with \e Leja ordering.
  *
  *  \param poly         Pointer to polynomial that holds the roots in \p
  *                      poly->root and gets the coefficients in \p poly->coeff.
@@ -465,45 +1403,143 @@ int mathPolyTransform (MATHPOLY *poly,
  ******************************************************************************/
 int mathPolyRoots2Coeffs(MATHPOLY *poly, double factor)
 {
-    int i, k;
-    gsl_complex result;
+    return mathPolyExpand (poly, factor, TRUE);
+} /* mathPolyRoots2Coeffs() */
 
-    gsl_complex *cplxPoly = g_malloc ((1 + poly->degree) * sizeof(poly->root[0]));
 
-    if (cplxPoly == NULL)
+
+/* FUNCTION *******************************************************************/
+/** Expands a real polynomial from its roots. The roots are combined into
+ *  real linear and quadratic factors (conjugate complex pairs), which are
+ *  multiplied in a balanced product tree
+    \f[
+    p(z)=c_n\prod_{i=1}^{m}q_i(z)=c_n\,
+    \Bigl((q_1 q_2)(q_3 q_4)\Bigr)\Bigl((q_5 q_6)(q_7 q_8)\Bigr)\cdots
+    \f]
+ *  in real arithmetic. On the upper levels of the tree the products are
+ *  computed by real FFT's, which results in
+ *  \f$O(n\log^2 n)\f$ operations (instead of \f$O(n^2)\f$ when multiplying
+ *  one linear factor after the other). Optionally the factors are sorted into
+ *  \e Leja order before (\f$O(n^2)\f$), which limits the error growth for
+ *  roots with greatly differing moduli.
+ *
+ *  \param poly         Pointer to polynomial that holds the roots in \p
+ *                      poly->root and gets the coefficients in \p poly->coeff.
+ *                      The roots must be real or conjugate complex pairs.
+ *  \param factor       Factor to be applied to all coefficients (means the
+ *                      coefficient \f$c_n\f$).
+ *  \param leja         If TRUE the factors are multiplied in \e Leja order.
+ *
+ *  \return             Zero on success, else an error number (see errno.h or
+ *                      gsl_errno.h for predefined codes).
+ ******************************************************************************/
+int mathPolyExpand (MATHPOLY *poly, double factor, BOOL leja)
+{
+    int i, k, count, size;
+    double *pFactor, *pSrc, *pDst, *pWork, *pIn, *pOut;
+    int *pDegree;
+    char *pUsed;
+    void *pMem;
+
+    int err = 0, n = poly->degree;
+
+    if (n <= 0)                                         /* constant polynomial */
+    {
+        poly->coeff[0] = factor;
+        return 0;
+    } /* if */
+
+    size = 0;                    /* FFT workspace size (zero for schoolbook) */
+
+    if (n >= 2 * MATHPOLY_MUL_FFT_DEGREE)
+    {
+        for (size = 1; size <= n; size *= 2)
+        {
+            ;
+        } /* for */
+    } /* if */
+
+    pMem = polyScratchAlloc ((7 * n + MAX (2 * size, n)) * sizeof(double)
+                             + n * (sizeof(int) + sizeof(char)));
+
+    if (pMem == NULL)
     {
         DEBUG_LOG ("Roots to coefficients conversion");
         return ENOMEM;
     } /* if */
 
+    pFactor = pMem;                          /* 3n: coefficients of factors */
+    pSrc = pFactor + 3 * n;                   /* 2n: product tree level i */
+    pDst = pSrc + 2 * n;                     /* 2n: product tree level i+1 */
+    pWork = pDst + 2 * n;                    /* 2^k+1: FFT, n: Leja order */
+    pDegree = (int *) (pWork + MAX (2 * size, n));
+    pUsed = (char *) (pDegree + n);
 
-    GSL_SET_COMPLEX(cplxPoly, 1.0, 0.0);    /* special case if degree is zero */
+    for (i = 0; i < n; i++)          /* roots as SoA (in level i+1 array) */
+    {
+        pDst[i] = GSL_REAL (poly->root[i]);
+        pDst[n + i] = GSL_IMAG (poly->root[i]);
+    } /* for */
+
+    count = polyFactors (pDst, pDst + n, n, pFactor, pDegree, pUsed);
 
-    for (i = 0; i < poly->degree; i++)                   /* process all roots */
+    if (count < 0)
     {
-        for (k = i + 1; k > 0; k--)                  /* with all coefficients */
-        {
-            cplxPoly[k] = cplxPoly[k - 1];                        /* P(i) * z */
-        } /* for */
+        DEBUG_LOG ("Complex root without conjugate");
+        polyAlignedFree (pMem);
+        return GSL_EINVAL;
+    } /* if */
 
-        GSL_SET_COMPLEX(cplxPoly, 0.0, 0.0);
+    if (leja)
+    {
+        polyLeja (pFactor, pDegree, count, pWork);
+    } /* if */
 
-        for (k = 0; k <= i; k++)                     /* with all coefficients */
+    for (i = k = 0; i < count; i++)                  /* leaves of the tree */
+    {
+        memcpy (&pSrc[k], &pFactor[3 * i], (pDegree[i] + 1) * sizeof(pSrc[0]));
+        k += pDegree[i] + 1;
+    } /* for */
+
+    while ((count > 1) && (err == 0))                /* product tree levels */
+    {
+        pIn = pSrc;
+        pOut = pDst;
+
+        for (i = k = 0; (i + 1 < count) && (err == 0); i += 2, k++)
         {
-            result = gsl_complex_mul (cplxPoly[k + 1], poly->root[i]);
-            cplxPoly[k] = gsl_complex_sub (cplxPoly[k], result); /* -P(i)*z[i] */
+            err = polyMulReal (pIn, pDegree[i],
+                               pIn + pDegree[i] + 1, pDegree[i + 1],
+                               pOut, pWork);
+            pIn += pDegree[i] + pDegree[i + 1] + 2;
+            pOut += pDegree[i] + pDegree[i + 1] + 1;
+            pDegree[k] = pDegree[i] + pDegree[i + 1];
         } /* for */
-    } /* for */
 
-    for (i = 0; i <= poly->degree; i++)       /* copy into real result vector */
+        if (i < count)                           /* odd number of factors */
+        {
+            memcpy (pOut, pIn, (pDegree[i] + 1) * sizeof(pOut[0]));
+            pDegree[k++] = pDegree[i];
+        } /* if */
+
+        pIn = pSrc;                                     /* swap the levels */
+        pSrc = pDst;
+        pDst = pIn;
+        count = k;
+    } /* while */
+
+    if (err == 0)
     {
-        poly->coeff[i] = factor * GSL_REAL (cplxPoly[i]);
-    } /* for */
+        for (i = 0; i <= n; i++)
+        {
+            poly->coeff[i] = factor * pSrc[i];
+        } /* for */
+    } /* if */
 
-    free(cplxPoly);
+    polyAlignedFree (pMem);
 
-    return 0;
-} /* mathPolyRoots2Coeffs() */
+    return err;
+} /* mathPolyExpand() */
 
 
 
@@ -513,6 +1549,11 @@ int mathPolyRoots2Coeffs(MATHPOLY *poly, double factor)
     p(z)=c_n z^n + c_{n-1} z^{n-1}+ \cdots + c_2 z^2 + c_1 z + c_0
     \f]
  *
+ *  Polynomials of higher degree are solved by \e Aberth-Ehrlich iteration
+ *  (\f$O(n^2)\f$ per iteration), all others (and those where the iteration
+ *  fails) by the companion matrix method of gsl_poly_complex_solve()
+ *  (\f$O(n^3)\f$).
+ *
  *  \param poly         Pointer to polynomial that holds the coefficients in
  *                      \p poly->coeff and gets the roots in \p poly->roots.
  *
@@ -525,6 +1566,24 @@ int mathPolyCoeffs2Roots (MATHPOLY *poly)
 {
     int err = 0;
 
+    if ((poly->degree >= MATHPOLY_ABERTH_DEGREE) &&
+        (poly->coeff[0] != 0.0) && (poly->coeff[poly->degree] != 0.0))
+    {
+        err = polyAberthStart (poly->coeff, poly->degree, poly->root);
+
+        if (err == 0)
+        {
+            err = polyAberth (poly, MATHPOLY_ABERTH_ITERMAX);
+
+            if (err == 0)
+            {
+                return 0;
+            } /* if */
+        } /* if */
+
+        DEBUG_LOG ("Aberth iteration failed (%d), using companion matrix", err);
+    } /* if */
+
     if (poly->degree > 0)
     {
         gsl_poly_complex_workspace *polyWsp = /* polynomial roots finder workspace */
@@ -542,7 +1601,42 @@ int mathPolyCoeffs2Roots (MATHPOLY *poly)
     } /* if */
 
     return err;
-} /* mathPolyRoots2Coeffs() */
+} /* mathPolyCoeffs2Roots() */
+
+
+/* FUNCTION *******************************************************************/
+/** Computes the complex roots of a polynomial like mathPolyCoeffs2Roots(),
+ *  but starts the \e Aberth-Ehrlich iteration from the roots in
+ *  \p poly->root (warm start). After a small change of the coefficients the
+ *  old roots are good approximations, so that only a few iterations are
+ *  needed.
+ *
+ *  \param poly         Pointer to polynomial that holds the coefficients in
+ *                      \p poly->coeff and the approximations (from the
+ *                      polynomial before change) in \p poly->roots, which are
+ *                      replaced by the new roots.
+ *  \param maxiter      Maximum number of iterations.
+ *
+ *  \return             Zero on success, else an error number (see gsl_errno.h
+ *                      for predefined codes). In case of error (GSL_EMAXITER
+ *                      if the iteration not converges) the roots are
+ *                      undefined and should be computed from scratch using
+ *                      mathPolyCoeffs2Roots().
+ ******************************************************************************/
+int mathPolyCoeffs2RootsWarm (MATHPOLY *poly, int maxiter)
+{
+    if (poly->degree <= 0)
+    {
+        return 0;
+    } /* if */
+
+    if ((poly->coeff[0] == 0.0) || (poly->coeff[poly->degree] == 0.0))
+    {
+        return GSL_EDOM;              /* zero roots resp. degree reduction */
+    } /* if */
+
+    return polyAberth (poly, maxiter);
+} /* mathPolyCoeffs2RootsWarm() */
 
 
 
@@ -93,6 +93,7 @@ static void miscDlgOnTypeComboChanged (GtkComboBox *combo, gpointer user_data);
 static GtkWidget* createDialog (GtkWidget *topWidget, GtkWidget *boxDesignDlg,
                                 const CFG_DESKTOP* pPrefs);
 static void updateLayout (GtkWidget *topWidget, GtkWidget *combo, int index);
+static int miscDlgFilterGen (DESIGNDLG *pDesign, FLTCOEFF *pFilter);
 
 
 /* LOCAL FUNCTION DEFINITIONS *************************************************/
@@ -301,6 +302,22 @@ static gboolean miscDlgComboSeparator(GtkTreeModel *model, GtkTreeIter *iter, gp
 
 
 
+/* FUNCTION *******************************************************************/
+/** Filter generator of the dialog for dfcPrjFilterGen(), which calls
+ *  miscFilterGen().
+ *
+ *  \param pDesign      Pointer to design data (member \a miscFlt is used).
+ *  \param pFilter      Pointer to buffer which gets the generated filter.
+ *
+ *  \return             Return code of miscFilterGen().
+ ******************************************************************************/
+static int miscDlgFilterGen (DESIGNDLG *pDesign, FLTCOEFF *pFilter)
+{
+    return miscFilterGen (&pDesign->miscFlt, pFilter);
+} /* miscDlgFilterGen() */
+
+
+
 
 /* EXPORTED FUNCTION DEFINITIONS **********************************************/
 
@@ -593,7 +610,8 @@ int miscDesignDlgApply (GtkWidget *topWidget, const CFG_DESKTOP* pPrefs)
                                    FLT_DEGREE_MAX, &prj.design.miscFlt.order))
                     {
                         prj.design.miscFlt.type = index;
-                        err = miscFilterGen (&prj.design.miscFlt, &prj.filter);
+                        err = dfcPrjFilterGen (FLTCLASS_MISC, miscDlgFilterGen,
+                                               &prj.design, &prj.filter);
 
                         if (!FLTERR_CRITICAL (err))
                         {
@@ -0,0 +1,71 @@
+/**
+ * \file        packageSupport.c
+ * \brief       Package support functions for \e gettext and package
+ *              directories (independent of GTK).
+ * \copyright   Copyright (C) 2006-2022 Ralf Hoppe <dfcgen@rho62.de>
+ */
+
+#include "base.h"    /* includes config.h */
+#include "packageSupport.h"
+
+#include <string.h>  /* strlen() */
+
+
+/* FUNCTION *******************************************************************/
+/** \brief This function returns a path to a directory, using UTF-8 encoding.
+ *
+ *  \param[in] dir_id   Directory identifier.
+ *
+ *  \return             A newly allocated string that must be freed with g_free().
+ ******************************************************************************/
+gchar* getPackageDirectory (DIRECTORY_ID dir_id)
+{
+    static const gchar* pkgdir[DIR_ID_SIZE] =
+    {
+        PACKAGE_TEMPLATES_DIR,                       /* (0) DIR_ID_TEMPLATES */
+        PACKAGE_PIXMAPS_DIR,                           /* (1) DIR_ID_PIXMAPS */
+        PACKAGE_FILTERS_DIR,                           /* (2) DIR_ID_FILTERS */
+        PACKAGE_LOCALE_DIR                              /* (3) DIR_ID_LOCALE */
+    };
+
+    gchar* path;
+
+#ifdef G_OS_WIN32
+    gchar* root = g_win32_get_package_installation_directory_of_module (NULL);
+
+    if (root != NULL)                       /* installation directory found? */
+    {
+        const gchar* pStart = pkgdir[dir_id];
+        const gchar* pEnd = pStart + strlen (pStart);
+
+        DEBUG_LOG ("Trying to determine sub-directory from '%s'", pStart);
+
+        while ((pEnd != pStart) && (*pEnd != '/'))
+        {
+            --pEnd;
+        } /* while */
+
+        if (*pEnd == '/')
+        {
+            ++pEnd;
+        } /* if */
+
+        path = g_build_filename (root, "share", pEnd, NULL);
+
+        g_free (root);
+        DEBUG_LOG ("Sub-directory '%s' mapped to '%s'", pEnd, path);
+    } /* if */
+    else /* use the MinGW path */
+#endif
+    path = g_strdup (pkgdir[dir_id]);
+
+    if (path == NULL)
+    {
+        g_critical (_("Couldn't locate package sub-directory no. %d"), dir_id);
+    } /* if */
+
+    return path;
+} /* getPackageDirectory() */
+
+
+
@@ -16,7 +16,7 @@
 #include "dfcProject.h"
 #include "filterSupport.h"
 #include "projectFile.h"
-#include "cfgSettings.h" /* cfgGetDesktopPrefs() */
+#include "packageSupport.h" /* _(), getPackageDirectory() */
 
 #include <stdio.h>
 #include <errno.h>
@@ -103,6 +103,7 @@ typedef enum
     PRJF_IDTAG_MODULE = 20,                /**< Elliptic filters module angle */
     PRJF_IDTAG_FTR = 21,                   /**< Frequency transformation type */
     PRJF_IDTAG_DSPWIN = 22,                              /**< Window function */
+    PRJF_IDTAG_TRANSITION = 23,       /**< Transition bandwidth (optimal FIR) */
 
     PRJF_IDTAG_SIZE
 
@@ -176,6 +177,7 @@ typedef enum
 #define PRJF_TAG_MODULE         "module"
 #define PRJF_TAG_FTR            "transform"      /**< Frequency transform tag */
 #define PRJF_TAG_DSPWIN         "window"                 /**< Window function */
+#define PRJF_TAG_TRANSITION     "transition"        /**< Transition bandwidth */
 
 #define PRJF_ATTRN_LANG         "lang"   /**< Language attribute (of strings) */
 #define PRJF_ATTRN_SUPERSEDED   "superseded"       /**< Design attribute name */
@@ -203,6 +205,8 @@ static int tagIntHandler (GMarkupParseContext *ctx, PRJF_TAG_DESC *pTag,
                           DFCPRJ_FILTER *prj, char *text);
 static int tagDoubleHandler (GMarkupParseContext *ctx, PRJF_TAG_DESC *pTag,
                              DFCPRJ_FILTER *prj, char *text);
+static int tagAttenHandler (GMarkupParseContext *ctx, PRJF_TAG_DESC *pTag,
+                            DFCPRJ_FILTER *prj, char *text);
 static int tagDegreeHandler (GMarkupParseContext *ctx, PRJF_TAG_DESC *pTag,
                              DFCPRJ_FILTER *prj, char *text);
 static int tagCoeffHandler (GMarkupParseContext *ctx, PRJF_TAG_DESC *pTag,
@@ -279,15 +283,17 @@ static PRJF_TAG_DESC prjTagsDesc[PRJF_IDTAG_SIZE] =
     {PRJF_IDTAG_ALGOZ,       2,                 PRJF_TAG_ALGOZ,       ZTR_SIZE - 1,
      PRJF_TAGFLAG_STDIIR, &tmpPrj.design.stdIir.zAlgo, NULL,           tagIntHandler},
     {PRJF_IDTAG_PASSBAND,    2,                 PRJF_TAG_PASSBAND,    FALSE,
-     0, &tmpPrj.design.stdIir.ripple, NULL,     tagDoubleHandler},
+     0, &tmpPrj.design.stdIir.ripple, NULL,     tagAttenHandler},
     {PRJF_IDTAG_STOPBAND,    2,                 PRJF_TAG_STOPBAND,    FALSE,
-     0, &tmpPrj.design.stdIir.minatt, NULL,     tagDoubleHandler},
+     0, &tmpPrj.design.stdIir.minatt, NULL,     tagAttenHandler},
     {PRJF_IDTAG_MODULE,      2,                 PRJF_TAG_MODULE,      FALSE,
      0, &tmpPrj.design.stdIir.angle, NULL,      tagDoubleHandler},
     {PRJF_IDTAG_FTR,        2,                  PRJF_TAG_FTR,         FTR_SIZE,
      PRJF_TAGFLAG_STDIIR | PRJF_TAGFLAG_LINFIR, &tmpPrj.design.all.ftr.type,  NULL, tagIntHandler},
     {PRJF_IDTAG_DSPWIN,     2,                  PRJF_TAG_DSPWIN,      LINFIR_DSPWIN_SIZE,
-     PRJF_TAGFLAG_LINFIR,  &tmpPrj.design.linFir.dspwin, attrKaiserHandler, tagIntHandler}
+     PRJF_TAGFLAG_LINFIR,  &tmpPrj.design.linFir.dspwin, attrKaiserHandler, tagIntHandler},
+    {PRJF_IDTAG_TRANSITION, 2,                  PRJF_TAG_TRANSITION,  FALSE,
+     0, &tmpPrj.design.linFir.width, NULL,      tagDoubleHandler}
 };
 
 
@@ -385,6 +391,38 @@ static int tagDoubleHandler (GMarkupParseContext *ctx, PRJF_TAG_DESC *p,
 } /* tagDoubleHandler() */
 
 
+
+/* FUNCTION *******************************************************************/
+/** Handler for tag contents which is a passband ripple or stopband attenuation
+ *  (PRJF_IDTAG_PASSBAND, PRJF_IDTAG_STOPBAND). Because the design data of
+ *  standard IIR and linear FIR filters are overlayed, the associated variable
+ *  depends on the filter class (which must be read before).
+ *
+ *  \param ctx          Pointer to parser context.
+ *  \param pTag         Pointer to tag descriptor.
+ *  \param prj          Pointer to DFCGen project.
+ *  \param text         Pointer to content of tag (zero-terminated).
+ *
+ *  \return             Zero on success, else an error number.
+ ******************************************************************************/
+static int tagAttenHandler (GMarkupParseContext *ctx, PRJF_TAG_DESC *pTag,
+                            DFCPRJ_FILTER *prj, char *text)
+{
+    PRJF_TAG_DESC tag;
+
+    ASSERT (pTag != NULL);
+    tag = *pTag;
+
+    if (prj->fltcls == FLTCLASS_LINFIR)                /* optimal linear FIR? */
+    {
+        tag.data = (pTag->id == PRJF_IDTAG_PASSBAND) ?
+            (void *)&prj->design.linFir.ripple : (void *)&prj->design.linFir.minatt;
+    } /* if */
+
+    return tagDoubleHandler (ctx, &tag, prj, text);
+} /* tagAttenHandler() */
+
+
 /* FUNCTION *******************************************************************/
 /** Handler for tag contents which is a polynomial coefficient.
  *
@@ -450,10 +488,10 @@ static int tagDegreeHandler (GMarkupParseContext *ctx, PRJF_TAG_DESC *pTag,
 
         if (ret == 0)
         {
-            poly->coeff = g_malloc (((1 + poly->degree) * sizeof(*poly->coeff)));
+            ret = mathPolyMallocCoeffs (poly);
             prjTagsDesc[PRJF_IDTAG_COEFF].data = poly->coeff; /* first coefficient */
 
-            if (poly->coeff != NULL)
+            if (ret == 0)
             {
                 return 0;
             } /* if */
@@ -947,6 +985,16 @@ static void writeLinFirDesign (FILE *f, LINFIR_DESIGN *pDesign)
                  pDesign->dspwin);
     } /* else */
 
+    if (LINFIR_TYPE_IS_OPTIMAL (pDesign->type))           /* tolerance scheme */
+    {
+        fprintf (f, "\t\t<" PRJF_TAG_PASSBAND ">%s</" PRJF_TAG_PASSBAND ">\n",
+                 g_ascii_dtostr (buf, sizeof(buf), pDesign->ripple));
+        fprintf (f, "\t\t<" PRJF_TAG_STOPBAND ">%s</" PRJF_TAG_STOPBAND ">\n",
+                 g_ascii_dtostr (buf, sizeof(buf), pDesign->minatt));
+        fprintf (f, "\t\t<" PRJF_TAG_TRANSITION ">%s</" PRJF_TAG_TRANSITION ">\n",
+                 g_ascii_dtostr (buf, sizeof(buf), pDesign->width));
+    } /* if */
+
     writeFrequTransf (f, pDesign->cutoff, &pDesign->ftr);
 
 } /* writeLinFirDesign() */
@@ -1228,7 +1276,9 @@ static PRJF_IDKEY exportLookupTemplateKeyword (gchar* keyword)
 
 /* FUNCTION *******************************************************************/
 /** \brief  Writes a \c double value as string to a buffer, always using '.' as
- *          decimal point (does not regard the current locale).
+ *          decimal point (does not regard the current locale). Zero is
+ *          always written as exact "0", so that zero coefficients can be
+ *          identified (and skipped) in the exported code.
  *
  *  \param[out] buffer  Pointer to buffer to use (should be at least of size \c G_ASCII_DTOSTR_BUF_SIZE).
  *  \param[in]  bufsize Size of this buffer.
@@ -1246,6 +1296,11 @@ static gint exportConvertCoeff (char* buffer, gint bufsize, gdouble val)
         return G_ASCII_DTOSTR_BUF_SIZE; /* indicate error (as snprintf() does) */
     } /* if */
 
+    if (val == 0.0)                   /* exact zero, also from -0.0 (no sign) */
+    {
+        val = 0.0;
+    } /* if */
+
     g_ascii_dtostr (buffer, bufsize, val);
 
     return (strlen (buffer));
@@ -1532,6 +1587,7 @@ void prjFileRead (const char *filename, DFCPRJ_FILTER *pProject, GError **err)
             (mathPolyMallocRoots (&tmpPrj.filter.den) == 0) &&
             FLTERR_SUCCESS (filterCheck(&tmpPrj.filter)))
         {
+            tmpPrj.filter.factor = 0.0;       /* roots are not stored in file */
             *pProject = tmpPrj;
         } /* if */
         else
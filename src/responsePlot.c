@@ -35,6 +35,7 @@ typedef struct
     void *pData;                     /**< Original data pointer (may be NULL) */
     FLTCOEFF *pFilter;                    /**< Pointer to filter coefficients */
     FLTRESP_TIME_WORKSPACE *pWorkspace;  /**< Time response workspace pointer */
+    FLTFIXED *pFixed;  /**< Fixed-point filter (NULL if the ideal is plotted) */
 } RESPONSE_PLOT;
 
 
@@ -51,12 +52,27 @@ static double plotPhaseDelay (double *f, void *pData);
 static double plotGroupDelay (double *f, void *pData);
 static int plotImpulseInit (double start, double stop, void *pData);
 static int plotStepInit (double start, double stop, void *pData);
+static int plotSignalInit (double start, double stop, void *pData);
 static double timeResponse (double *t, void *pData);
 static void timeResponseEnd (void *pData);
 
 
 /* LOCAL VARIABLE DEFINITIONS *************************************************/
 
+/** Fixed-point format of simulation (FLTFIXED_SIZE if disabled).
+ */
+static FLTFIXED_FORMAT responsePlotFixedFormat = FLTFIXED_SIZE;
+
+
+/** Rounding mode of fixed-point simulation.
+ */
+static FLTFIXED_ROUND responsePlotFixedRound = FLTFIXED_ROUND_NEAREST;
+
+
+/** User signal of time response plot RESPONSE_TYPE_SIGNAL (NULL if none).
+ */
+static FLTSIGNAL_SOURCE *responsePlotSource = NULL;
+
 
 /** All predefined response plots (partially intialized).
  */
@@ -105,6 +121,13 @@ static RESPONSE_PLOT responsePlot[RESPONSE_TYPE_SIZE] =
         .sampleFunc = timeResponse,
         .initFunc = plotStepInit,
         .endFunc = timeResponseEnd
+    },
+    [RESPONSE_TYPE_SIGNAL] =
+    {
+        .type = RESPONSE_TYPE_SIGNAL,
+        .sampleFunc = timeResponse,
+        .initFunc = plotSignalInit,
+        .endFunc = timeResponseEnd
     }
 }; /* responsePlot[] */
 
@@ -280,8 +303,17 @@ static int plotImpulseInit (double start, double stop, void *pData)
 {
     RESPONSE_PLOT *pResponse = pData;
 
-    pResponse->pWorkspace = filterResponseTimeNew (start, stop, FLTSIGNAL_DIRAC,
-                                                   pResponse->pFilter);
+    if (pResponse->pFixed != NULL)                  /* quantized filter? */
+    {
+        pResponse->pWorkspace = filterResponseTimeNewFixed (start, stop, FLTSIGNAL_DIRAC,
+                                                            pResponse->pFixed);
+    } /* if */
+    else
+    {
+        pResponse->pWorkspace = filterResponseTimeNew (start, stop, FLTSIGNAL_DIRAC,
+                                                       pResponse->pFilter);
+    } /* else */
+
     if (pResponse->pWorkspace == NULL)
     {
         return -1;
@@ -312,8 +344,17 @@ static int plotStepInit (double start, double stop, void *pData)
 {
     RESPONSE_PLOT *pResponse = pData;
 
-    pResponse->pWorkspace = filterResponseTimeNew (start, stop, FLTSIGNAL_HEAVISIDE,
-                                                   pResponse->pFilter);
+    if (pResponse->pFixed != NULL)                  /* quantized filter? */
+    {
+        pResponse->pWorkspace = filterResponseTimeNewFixed (start, stop, FLTSIGNAL_HEAVISIDE,
+                                                            pResponse->pFixed);
+    } /* if */
+    else
+    {
+        pResponse->pWorkspace = filterResponseTimeNew (start, stop, FLTSIGNAL_HEAVISIDE,
+                                                       pResponse->pFilter);
+    } /* else */
+
     if (pResponse->pWorkspace == NULL)
     {
         return -1;
@@ -323,6 +364,46 @@ static int plotStepInit (double start, double stop, void *pData)
 } /* plotStepInit() */
 
 
+/* FUNCTION *******************************************************************/
+/** Initializes the response of a filter on the user signal (for usage on a
+ *  \e Cairo plot). The signal is read from its beginning on each call.
+ *
+ *  \note               There is no fixed-point simulation on user signals,
+ *                      so the quantized filter is not drawn here.
+ *
+ *  \param start        Time to start (must be positive).
+ *  \param stop         Time to stop (must be positive).
+ *  \param pData        User application data pointer as passed to cairoPlot2d()
+ *                      in element \a pData of structure PLOT_DIAG. In that
+ *                      special case here it is a pointer to
+ *                      responsePlot[RESPONSE_TYPE_SIGNAL].
+ *
+ *  \return  The number of samples in interval \a start - \a stop, or a
+ *           negative number if there is no user signal or on any error.
+ ******************************************************************************/
+static int plotSignalInit (double start, double stop, void *pData)
+{
+    RESPONSE_PLOT *pResponse = pData;
+
+    if ((responsePlotSource == NULL) || (pResponse->pFixed != NULL) ||
+        (filterSignalSeek (responsePlotSource, 0) != 0))
+    {
+        pResponse->pWorkspace = NULL;
+        return -1;
+    } /* if */
+
+    pResponse->pWorkspace = filterResponseTimeNewUser (start, stop,
+                                                       responsePlotSource,
+                                                       pResponse->pFilter);
+    if (pResponse->pWorkspace == NULL)
+    {
+        return -1;
+    } /* if */
+
+    return pResponse->pWorkspace->samples;
+} /* plotSignalInit() */
+
+
 /* FUNCTION *******************************************************************/
 /** Computes the time domain response of a filter (for usage on a \e Cairo plot).
  *
@@ -380,6 +461,8 @@ static void timeResponseEnd (void *pData)
  ******************************************************************************/
 int responsePlotDraw (cairo_t* cr, RESPONSE_TYPE type, PLOT_DIAG *pDiag)
 {
+    FLTFIXED *pFixed;
+    FLTCOEFF *pIdeal;
     int points = 0;
     RESPONSE_PLOT *pResponse = &responsePlot[type];
     const CFG_DESKTOP* pPrefs = cfgGetDesktopPrefs ();
@@ -391,6 +474,7 @@ int responsePlotDraw (cairo_t* cr, RESPONSE_TYPE type, PLOT_DIAG *pDiag)
     {
         case RESPONSE_TYPE_IMPULSE:
         case RESPONSE_TYPE_STEP:
+        case RESPONSE_TYPE_SIGNAL:
             pDiag->x.pUnit = &pPrefs->timeUnit;
             break;
 
@@ -420,7 +504,22 @@ int responsePlotDraw (cairo_t* cr, RESPONSE_TYPE type, PLOT_DIAG *pDiag)
         pDiag->endFunc = pResponse->endFunc;
 
         pDiag->x.prec = pDiag->y.prec = pPrefs->outprec;
+        pResponse->pFixed = NULL;
         points = cairoPlot2d (cr, pDiag);
+
+        if ((points >= 0) && (responsePlotFixedFormat != FLTFIXED_SIZE) &&
+            (filterFixedNew (pResponse->pFilter, responsePlotFixedFormat,
+                             responsePlotFixedRound, &pFixed) == 0))
+        {                       /* quantized filter into the same diagram */
+            pIdeal = pResponse->pFilter;
+            pResponse->pFilter = &pFixed->coeff;
+            pResponse->pFixed = pFixed;
+            (void)cairoPlotOverlay (cr, pDiag);
+            pResponse->pFilter = pIdeal;              /* restore ideal filter */
+            pResponse->pFixed = NULL;
+            filterFixedFree (pFixed);
+        } /* if */
+
         pDiag->pData = pResponse->pData;     /* restore original data pointer */
 
     } /* if */
@@ -429,6 +528,60 @@ int responsePlotDraw (cairo_t* cr, RESPONSE_TYPE type, PLOT_DIAG *pDiag)
 } /* responsePlotDraw() */
 
 
+/* FUNCTION *******************************************************************/
+/** Sets the fixed-point simulation for all response plots. If enabled, the
+ *  response of the quantized filter is drawn (dashed) next to the ideal one.
+ *
+ *  \param format       Fixed-point format, FLTFIXED_SIZE disables the
+ *                      simulation.
+ *  \param rounding     Rounding mode.
+ *
+ ******************************************************************************/
+void responsePlotSetFixed (FLTFIXED_FORMAT format, FLTFIXED_ROUND rounding)
+{
+    responsePlotFixedFormat = format;
+    responsePlotFixedRound = rounding;
+} /* responsePlotSetFixed() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Gets the fixed-point simulation of all response plots, as set by function
+ *  responsePlotSetFixed().
+ *
+ *  \param pFormat      Pointer to buffer for fixed-point format (FLTFIXED_SIZE
+ *                      if the simulation is disabled).
+ *  \param pRounding    Pointer to buffer for rounding mode.
+ *
+ ******************************************************************************/
+void responsePlotGetFixed (FLTFIXED_FORMAT *pFormat, FLTFIXED_ROUND *pRounding)
+{
+    *pFormat = responsePlotFixedFormat;
+    *pRounding = responsePlotFixedRound;
+} /* responsePlotGetFixed() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Sets the user signal for the time response plot RESPONSE_TYPE_SIGNAL.
+ *  The response plot module takes over the signal source and closes it (by
+ *  filterSignalClose()) when another signal is set.
+ *
+ *  \param pSource      Pointer to user signal, formerly opened by
+ *                      filterSignalOpen(). Pass NULL to remove the signal.
+ *
+ ******************************************************************************/
+void responsePlotSetSignal (FLTSIGNAL_SOURCE *pSource)
+{
+    if (responsePlotSource != NULL)
+    {
+        filterSignalClose (responsePlotSource);
+    } /* if */
+
+    responsePlotSource = pSource;
+} /* responsePlotSetSignal() */
+
+
 
 /******************************************************************************/
 /* END OF FILE                                                                */
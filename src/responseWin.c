@@ -13,6 +13,8 @@
 #include "dfcProject.h"  /* dfcPrjGetFilter() */
 #include "filterPrint.h" /* filterPrintResponse() */
 #include "cfgSettings.h" /* cfgSaveResponseSettings(), cfgRestoreResponseSettings */
+#include "dialogSupport.h" /* dlgErrorFile() */
+#include "filterSignal.h"
 #include "mathFuncs.h"
 
 
@@ -173,6 +175,17 @@ static RESPONSE_WIN responseWidget[RESPONSE_TYPE_SIZE] =
             .pData = &responseWidget[RESPONSE_TYPE_STEP], /* pData (backward ptr) */
             .thickness = RESPONSE_WIN_GRAPH_THICKNESS,    /* graph thickness */
         }
+    },
+    [RESPONSE_TYPE_SIGNAL] =
+    {
+        RESPONSE_TYPE_SIGNAL,
+        "step.png",                                               /* iconFile */
+        {                                                             /* diag */
+            .x = {.name = N_("<b>t</b>")},
+            .y = {.name = N_("<b>y(t)</b>")},
+            .pData = &responseWidget[RESPONSE_TYPE_SIGNAL], /* pData (backward ptr) */
+            .thickness = RESPONSE_WIN_GRAPH_THICKNESS,    /* graph thickness */
+        }
     }
 }; /* responseWidget[] */
 
@@ -647,6 +660,143 @@ void responseWinRedraw (RESPONSE_TYPE type)
 } /* responseWinRedraw() */
 
 
+
+/**
+ * \brief   Selects the fixed-point format of the quantized filter, which is
+ *          drawn next to the ideal one in all response windows.
+ * \note    This function should be called if a \e GtkRadioMenuItem from the
+ *          \e Fixed-Point submenu receives an \e activate event.
+ *
+ * \param   menuitem    Menu item which has received the \e activate event.
+ * \param   user_data   Fixed-point format (FLTFIXED_FORMAT), FLTFIXED_SIZE
+ *                      disables the simulation.
+ */
+void responseWinFixedActivate (GtkMenuItem* menuitem, gpointer user_data)
+{
+    FLTFIXED_FORMAT format;
+    FLTFIXED_ROUND rounding;
+
+    if (gtk_check_menu_item_get_active (GTK_CHECK_MENU_ITEM (menuitem)))
+    {
+        responsePlotGetFixed (&format, &rounding);
+        responsePlotSetFixed (GPOINTER_TO_INT (user_data), rounding);
+        responseWinRedraw (RESPONSE_TYPE_SIZE);
+    } /* if */
+} /* responseWinFixedActivate() */
+
+
+
+/**
+ * \brief   Selects the rounding mode of the fixed-point simulation.
+ * \note    This function should be called if a \e GtkRadioMenuItem from the
+ *          \e Fixed-Point submenu receives an \e activate event.
+ *
+ * \param   menuitem    Menu item which has received the \e activate event.
+ * \param   user_data   Rounding mode (FLTFIXED_ROUND).
+ */
+void responseWinRoundActivate (GtkMenuItem* menuitem, gpointer user_data)
+{
+    FLTFIXED_FORMAT format;
+    FLTFIXED_ROUND rounding;
+
+    if (gtk_check_menu_item_get_active (GTK_CHECK_MENU_ITEM (menuitem)))
+    {
+        responsePlotGetFixed (&format, &rounding);
+        responsePlotSetFixed (format, GPOINTER_TO_INT (user_data));
+
+        if (format != FLTFIXED_SIZE)
+        {
+            responseWinRedraw (RESPONSE_TYPE_SIZE);
+        } /* if */
+    } /* if */
+} /* responseWinRoundActivate() */
+
+
+
+/**
+ * \brief   Loads the user signal of the time response plot (in window
+ *          RESPONSE_TYPE_SIGNAL) from a raw or WAV file. The file format is
+ *          taken from the file name suffix: \c .wav means WAV, \c .f64 raw
+ *          64 bit floats and all others raw 32 bit floats.
+ * \note    This function should be called if the \e Load \e User \e Signal
+ *          menu item from the \e View menu receives an \e activate event.
+ *
+ * \param   srcWidget   Widget which has received the \e activate event.
+ * \param   user_data   User data set when the signal handler was connected
+ *                      (unused).
+ */
+void responseWinSignalActivate (GtkWidget* srcWidget, gpointer user_data)
+{
+    GtkFileFilter* filter;
+    FLTSIGNAL_SOURCE *pSource;
+    FLTSIGNAL_FORMAT format;
+    GError *error;
+    char *fname, *suffix;
+    int err;
+
+    GtkWidget *topWidget = gtk_widget_get_toplevel (srcWidget);
+    GtkWidget* dialog =
+        gtk_file_chooser_dialog_new (_("Load user signal"),
+                                     GTK_WINDOW (topWidget),
+                                     GTK_FILE_CHOOSER_ACTION_OPEN,
+                                     GUI_BUTTON_IMAGE_CANCEL, GTK_RESPONSE_CANCEL,
+                                     GUI_BUTTON_IMAGE_OPEN, GTK_RESPONSE_ACCEPT, NULL);
+
+    gtk_file_chooser_set_local_only (GTK_FILE_CHOOSER (dialog), TRUE);
+
+    filter = gtk_file_filter_new ();
+    gtk_file_filter_set_name (filter, _("WAV files (*.wav)"));
+    gtk_file_filter_add_pattern (filter, "*.wav");
+    gtk_file_filter_add_pattern (filter, "*.WAV");
+    gtk_file_chooser_add_filter (GTK_FILE_CHOOSER (dialog), filter);
+
+    filter = gtk_file_filter_new ();
+    gtk_file_filter_set_name (filter, _("All files (*)"));
+    gtk_file_filter_add_pattern (filter, "*");
+    gtk_file_chooser_add_filter (GTK_FILE_CHOOSER (dialog), filter);
+
+    gtk_file_chooser_set_show_hidden (GTK_FILE_CHOOSER (dialog), FALSE);
+
+    if (gtk_dialog_run (GTK_DIALOG (dialog)) == GTK_RESPONSE_ACCEPT)
+    {
+        fname = gtk_file_chooser_get_filename (GTK_FILE_CHOOSER (dialog));
+        suffix = g_ascii_strdown (fname, -1);
+        format = FLTSIGNAL_FORMAT_FLOAT32;
+
+        if (g_str_has_suffix (suffix, ".wav"))
+        {
+            format = FLTSIGNAL_FORMAT_WAV;
+        } /* if */
+        else if (g_str_has_suffix (suffix, ".f64"))
+        {
+            format = FLTSIGNAL_FORMAT_FLOAT64;
+        } /* else if */
+
+        g_free (suffix);
+        err = filterSignalOpen (fname, format, &pSource);
+
+        if (err == 0)
+        {
+            responsePlotSetSignal (pSource);
+            responseWinRedraw (RESPONSE_TYPE_SIGNAL);
+        } /* if */
+        else
+        {
+            error = g_error_new_literal (G_FILE_ERROR,
+                                         g_file_error_from_errno (err),
+                                         g_strerror (err));
+            dlgErrorFile (topWidget, _("Error loading user signal '%s'."),
+                          fname, error);
+            g_error_free (error);
+        } /* else */
+
+        g_free (fname);
+    } /* if */
+
+    gtk_widget_destroy (dialog);
+} /* responseWinSignalActivate() */
+
+
 /**
  * \brief   Top widget callback function on \e key_press_event.
  * \note    This function is used to detect zoom mode cancel.
@@ -26,6 +26,8 @@
 
 /* LOCAL CONSTANT DEFINITIONS *************************************************/
 
+#define ROOTSPLOT_TRACK_ITERMAX 8   /**< Maximum iterations on root tracking */
+
 
 /* LOCAL VARIABLE DEFINITIONS *************************************************/
 
@@ -43,7 +45,8 @@ static int rootsPlotInit (double start, double stop, void *pData);
 static double plotRoot (double *px, void *pData);
 static double returnZeroRoot (double *px, void *pData);
 static void updateRootsMinMax (MATHPOLY *poly, gsl_complex *rmin, gsl_complex *rmax);
-static int calcRoots (MATHPOLY *poly);
+static int calcRoots (MATHPOLY *poly, BOOL track);
+static void updateRoots (FLTCOEFF *pFilter, BOOL track);
 static gboolean rootsPlotDrawHandler (GtkWidget *widget, cairo_t *gc,
                                       gpointer user_data);
 static double plotUnitCircleBottom (double *px, void *pData);
@@ -255,14 +258,36 @@ static void updateRootsMinMax (MATHPOLY *poly, gsl_complex *rmin, gsl_complex *r
  *
  *  \param poly         Pointer to polynomial that holds the coefficients in
  *                      \p poly->coeff and gets the roots in \p poly->roots.
+ *  \param track        If TRUE the roots in \p poly->roots (from the
+ *                      polynomial before a coefficient change) are used as
+ *                      start values and only polished by a few iterations.
+ *                      If that fails the roots are computed from scratch.
  *
  *  \return             0 on success, else an error number.
  ******************************************************************************/
-static int calcRoots (MATHPOLY *poly)
+static int calcRoots (MATHPOLY *poly, BOOL track)
 {
-    int ret, i;
+    int ret = GSL_FAILURE, i;
+
+    if (track)
+    {
+        for (i = 0; i < poly->degree; i++)           /* back into w = 1/z */
+        {
+            poly->root[i] = gsl_complex_inverse (poly->root[i]);
+        } /* for */
+
+        ret = mathPolyCoeffs2RootsWarm (poly, ROOTSPLOT_TRACK_ITERMAX);
 
-    ret = mathPolyCoeffs2Roots (poly);
+        if (ret != 0)
+        {
+            DEBUG_LOG ("Root tracking failed (%d), computing from scratch", ret);
+        } /* if */
+    } /* if */
+
+    if (ret != 0)
+    {
+        ret = mathPolyCoeffs2Roots (poly);
+    } /* if */
 
     if (ret == 0)
     {
@@ -277,6 +302,36 @@ static int calcRoots (MATHPOLY *poly)
 
 
 
+/* FUNCTION *******************************************************************/
+/** Re-calculates the roots of transfer \f$H(z)\f$ of a filter and redraws
+ *  the roots plot.
+ *
+ *  \param pFilter      Pointer to filter coefficients (may be NULL).
+ *  \param track        TRUE if the roots of \p pFilter shall be tracked from
+ *                      the roots currently stored (see calcRoots()).
+ *
+ ******************************************************************************/
+static void updateRoots (FLTCOEFF *pFilter, BOOL track)
+{
+    if (pFilter != NULL)
+    {
+        if ((calcRoots (&pFilter->num, track) != 0) ||
+            (calcRoots (&pFilter->den, track) != 0))
+        {
+            pFilter->factor = 0.0;                       /* roots are invalid */
+        } /* if */
+        else
+        {
+            pFilter->factor = pFilter->num.coeff[0] / pFilter->den.coeff[0];
+        } /* else */
+    } /* if */
+
+    rootsPlotRedraw ();
+
+} /* updateRoots() */
+
+
+
 /* FUNCTION *******************************************************************/
 /** Redraws a response widget in case an \e draw event is received.
  *
@@ -460,7 +515,9 @@ GtkWidget *rootsPlotCreate ()
 
 
 /* FUNCTION *******************************************************************/
-/** Re-calculates the roots of transfer \f$H(z)\f$ of a filter.
+/** Re-calculates the roots of transfer \f$H(z)\f$ of a filter. If the filter
+ *  comes with a valid roots representation (\a factor is not zero), e.g.
+ *  from the standard IIR filter generator, then the roots are only redrawn.
  *
  *  \param pFilter      Pointer to filter coefficients, for which the roots
  *                      shall be calculated. Set this to NULL, if the filter
@@ -469,24 +526,37 @@ GtkWidget *rootsPlotCreate ()
  ******************************************************************************/
 void rootsPlotUpdate (FLTCOEFF *pFilter)
 {
-    if (pFilter != NULL)
+    if ((pFilter != NULL) && (pFilter->factor != 0.0))   /* roots are valid? */
     {
-        if ((calcRoots (&pFilter->num) != 0) || (calcRoots (&pFilter->den) != 0))
-        {
-            pFilter->factor = 0.0;                       /* roots are invalid */
-        } /* if */
-        else
-        {
-            pFilter->factor = pFilter->num.coeff[0] / pFilter->den.coeff[0];
-        } /* else */
+        rootsPlotRedraw ();
+        return;
     } /* if */
 
-    rootsPlotRedraw ();
-
+    updateRoots (pFilter, FALSE);
 } /* rootsPlotUpdate() */
 
 
 
+/* FUNCTION *******************************************************************/
+/** Re-calculates the roots of transfer \f$H(z)\f$ of a filter after a (small)
+ *  change of coefficients, but not of the degrees (root tracking). The roots
+ *  of the filter before change are used as start values, so that typically
+ *  a few iterations are needed to get the new roots. If the iteration not
+ *  converges, then the roots are computed from scratch.
+ *
+ *  \param pFilter      Pointer to filter coefficients, which holds the roots
+ *                      of the filter before change (or \a factor is zero if
+ *                      these are invalid). Set this to NULL, if the filter
+ *                      (and therefore the roots too) is invalid.
+ *
+ ******************************************************************************/
+void rootsPlotTrack (FLTCOEFF *pFilter)
+{
+    updateRoots (pFilter, (pFilter != NULL) && (pFilter->factor != 0.0));
+} /* rootsPlotTrack() */
+
+
+
 /* FUNCTION *******************************************************************/
 /** Forces a asynchronous redraw of all transfer function roots.
  *
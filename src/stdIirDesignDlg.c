@@ -16,6 +16,8 @@
 #include "dialogSupport.h"
 #include "stdIirDesignDlg.h"
 
+#include <gsl/gsl_errno.h> /* GSL_ETOL */
+
 
 /* GLOBAL CONSTANT DEFINITIONS ************************************************/
 
@@ -35,6 +37,7 @@ typedef struct
     BOOL hasRipple;     /**< TRUE if ripple attenuation is an input parameter */
     BOOL hasStopband; /**< TRUE if stopband attenuation is an input parameter */
     BOOL hasAngle;                   /**< TRUE if angle is an input parameter */
+    BOOL hasMinOrder;        /**< TRUE if the minimum order can be calculated */
 } STDIIR_DLG_CHAR;
 
 
@@ -61,11 +64,14 @@ typedef struct
 #define STDIIRDLG_ENTRY_RIPPLE  "entryRipple"
 #define STDIIRDLG_ENTRY_MINATT  "entryMinAtt"
 #define STDIIRDLG_SPIN_ANGLE    "spinAngle"
+#define STDIIRDLG_ENTRY_WIDTH   "entryTransWidth"
+#define STDIIRDLG_CHKBTN_MINORDER "checkMinOrder"
 
 #define STDIIRDLG_UNIT_CUTOFF   "unitCutF"
 #define STDIIRDLG_UNIT_SAMPLE   "unitSampleF"
 #define STDIIRDLG_UNIT_CENTER   "unitCenterF"
 #define STDIIRDLG_UNIT_BANDW    "unitBandwidth"
+#define STDIIRDLG_UNIT_WIDTH    "unitTransWidth"
 
 
 /* LOCAL VARIABLE DEFINITIONS *************************************************/
@@ -74,13 +80,13 @@ typedef struct
 /** Array of all standard IIR filter types (in same order as the enums).
  */
 static STDIIR_DLG_CHAR stdIirDlgChar[STDIIR_TYPE_SIZE] =
-{   /* type,                  btn,  name,                  hasRipple, hasStopband, hasAngle */
-    {STDIIR_TYPE_BUTTERWORTH, NULL, N_("Butterworth"),     FALSE, FALSE, FALSE},
-    {STDIIR_TYPE_CHEBY,       NULL, N_("Chebyshev"),       TRUE, FALSE, FALSE},
-    {STDIIR_TYPE_CHEBYINV,    NULL, N_("Chebyshev Inv."),  FALSE, TRUE, FALSE},
-    {STDIIR_TYPE_CAUER1,      NULL, N_("Cauer (Case I)"),  TRUE, FALSE, TRUE},
-    {STDIIR_TYPE_CAUER2,      NULL, N_("Cauer (Case II)"), FALSE, TRUE, TRUE},
-    {STDIIR_TYPE_BESSEL,      NULL, N_("Bessel"),          FALSE, FALSE, FALSE}
+{   /* type,                  btn,  name,                  hasRipple, hasStopband, hasAngle, hasMinOrder */
+    {STDIIR_TYPE_BUTTERWORTH, NULL, N_("Butterworth"),     FALSE, FALSE, FALSE, TRUE},
+    {STDIIR_TYPE_CHEBY,       NULL, N_("Chebyshev"),       TRUE, FALSE, FALSE, TRUE},
+    {STDIIR_TYPE_CHEBYINV,    NULL, N_("Chebyshev Inv."),  FALSE, TRUE, FALSE, TRUE},
+    {STDIIR_TYPE_CAUER1,      NULL, N_("Cauer (Case I)"),  TRUE, FALSE, TRUE, TRUE},
+    {STDIIR_TYPE_CAUER2,      NULL, N_("Cauer (Case II)"), FALSE, TRUE, TRUE, TRUE},
+    {STDIIR_TYPE_BESSEL,      NULL, N_("Bessel"),          FALSE, FALSE, FALSE, FALSE}
 }; /* stdIirDlgChar[] */
 
 
@@ -99,41 +105,66 @@ static const gboolean ftrEntry[FTR_SIZE][5] =
 
 /* LOCAL FUNCTION DECLARATIONS ************************************************/
 
-static void filterTypeChanged (GtkRadioButton* radiobutton, gpointer user_data);
+static STDIIR_DLG_CHAR *activeDlgChar (void);
+static void toleranceSchemeChanged (GtkToggleButton *button, gpointer user_data);
 static void transformTypeChanged (GtkComboBox *combobox, gpointer user_data);
+static int stdIirDlgFilterGen (DESIGNDLG *pDesign, FLTCOEFF *pFilter);
 
 
 /* LOCAL FUNCTION DEFINITIONS *************************************************/
 
 
 /* FUNCTION *******************************************************************/
-/** This function is called if the IIR filter type changes (\e toggle event
- *  from radio button).
- *
- *  \param radiobutton  Radio button which changes the state.
- *  \param user_data    User data set when the signal handler was connected. In
- *                      that case it points to the associated STDIIR_DLG_CHAR.
+/** Returns the characteristic of the active radio button.
  *
+ *  \return             Pointer to active element of stdIirDlgChar[].
  ******************************************************************************/
-static void filterTypeChanged (GtkRadioButton* radiobutton, gpointer user_data)
+static STDIIR_DLG_CHAR *activeDlgChar (void)
 {
-    STDIIR_DLG_CHAR *pDesc = (STDIIR_DLG_CHAR*) user_data;
+    STDIIR_TYPE type = STDIIR_TYPE_SIZE - 1;
 
-    if (gtk_toggle_button_get_active (GTK_TOGGLE_BUTTON(radiobutton)))
-    {                                              /* really not de-activated */
-        gtk_widget_set_sensitive (lookup_widget (GTK_WIDGET (radiobutton),
-                                                 STDIIRDLG_ENTRY_RIPPLE),
-                                  pDesc->hasRipple);
+    while ((type > 0) &&                      /* look for active radio button */
+           !gtk_toggle_button_get_active (GTK_TOGGLE_BUTTON(stdIirDlgChar[type].btn)))
+    {
+        --type;
+    } /* while */
 
-        gtk_widget_set_sensitive (lookup_widget (GTK_WIDGET (radiobutton),
-                                                 STDIIRDLG_ENTRY_MINATT),
-                                  pDesc->hasStopband);
+    return &stdIirDlgChar[type];
+} /* activeDlgChar() */
 
-        gtk_widget_set_sensitive (lookup_widget (GTK_WIDGET (radiobutton),
-                                                 STDIIRDLG_SPIN_ANGLE),
-                                  pDesc->hasAngle);
-    } /* if */
-} /* filterTypeChanged() */
+
+
+/* FUNCTION *******************************************************************/
+/** This function is called if the IIR filter type (\e toggle event from radio
+ *  button) or the minimum order check button changes. The minimum order
+ *  calculation needs the complete tolerance scheme and derives the degree
+ *  (and the modular angle of \e Cauer filters).
+ *
+ *  \param button       Toggle button which changes the state.
+ *  \param user_data    User data set when the signal handler was connected
+ *                      (unused).
+ *
+ ******************************************************************************/
+static void toleranceSchemeChanged (GtkToggleButton *button, gpointer user_data)
+{
+    GtkWidget *widget = GTK_WIDGET (button);
+    GtkWidget *check = lookup_widget (widget, STDIIRDLG_CHKBTN_MINORDER);
+    STDIIR_DLG_CHAR *pDesc = activeDlgChar ();
+    gboolean minOrder = pDesc->hasMinOrder &&
+        gtk_toggle_button_get_active (GTK_TOGGLE_BUTTON (check));
+
+    gtk_widget_set_sensitive (check, pDesc->hasMinOrder);
+    gtk_widget_set_sensitive (lookup_widget (widget, STDIIRDLG_ENTRY_RIPPLE),
+                              pDesc->hasRipple || minOrder);
+    gtk_widget_set_sensitive (lookup_widget (widget, STDIIRDLG_ENTRY_MINATT),
+                              pDesc->hasStopband || minOrder);
+    gtk_widget_set_sensitive (lookup_widget (widget, STDIIRDLG_SPIN_ANGLE),
+                              pDesc->hasAngle && !minOrder);
+    gtk_widget_set_sensitive (lookup_widget (widget, STDIIRDLG_ENTRY_WIDTH),
+                              minOrder);
+    gtk_widget_set_sensitive (lookup_widget (widget, STDIIRDLG_SPIN_DEGREE),
+                              !minOrder);
+} /* toleranceSchemeChanged() */
 
 
 
@@ -193,6 +224,22 @@ static void transformTypeChanged (GtkComboBox *combobox, gpointer user_data)
 
 
 
+/* FUNCTION *******************************************************************/
+/** Filter generator of the dialog for dfcPrjFilterGen(), which calls
+ *  stdIirFilterGen().
+ *
+ *  \param pDesign      Pointer to design data (member \a stdIir is used).
+ *  \param pFilter      Pointer to buffer which gets the generated filter.
+ *
+ *  \return             Return code of stdIirFilterGen().
+ ******************************************************************************/
+static int stdIirDlgFilterGen (DESIGNDLG *pDesign, FLTCOEFF *pFilter)
+{
+    return stdIirFilterGen (&pDesign->stdIir, pFilter);
+} /* stdIirDlgFilterGen() */
+
+
+
 /* EXPORTED FUNCTION DEFINITIONS **********************************************/
 
 
@@ -253,7 +300,7 @@ void stdIirDesignDlgCreate (GtkWidget *topWidget, GtkWidget *boxDesignDlg,
         iirTypeRadioGroup = gtk_radio_button_get_group (GTK_RADIO_BUTTON (stdIirDlgChar[type].btn));
 
         g_signal_connect ((gpointer) stdIirDlgChar[type].btn, "toggled",
-                          G_CALLBACK (filterTypeChanged), &stdIirDlgChar[type]);
+                          G_CALLBACK (toleranceSchemeChanged), NULL);
     } /* for */
 
 
@@ -406,6 +453,13 @@ void stdIirDesignDlgCreate (GtkWidget *topWidget, GtkWidget *boxDesignDlg,
     gtk_widget_set_halign (label, GTK_ALIGN_END);
     gtk_label_set_mnemonic_widget (GTK_LABEL (label), widget);
 
+    widget = gtk_check_button_new_with_mnemonic (_("_Min."));
+    gtk_grid_attach (GTK_GRID (table), widget, 2, 0, 1, 1);
+    gtk_widget_set_tooltip_text (widget, _("Minimum degree which meets the tolerance"
+                                           " scheme (transition band centered at"
+                                           " the cutoff frequency)"));
+    GLADE_HOOKUP_OBJECT (topWidget, widget, STDIIRDLG_CHKBTN_MINORDER);
+
     /* Parameters
      */
     frame = gtk_frame_new (NULL);
@@ -475,6 +529,28 @@ void stdIirDesignDlgCreate (GtkWidget *topWidget, GtkWidget *boxDesignDlg,
     gtk_widget_set_halign (label, GTK_ALIGN_END);
     gtk_label_set_mnemonic_widget (GTK_LABEL (label), widget);
 
+    widget = gtk_entry_new ();                        /* transition bandwidth */
+    gtk_entry_set_activates_default (GTK_ENTRY (widget), TRUE);
+    gtk_grid_attach (GTK_GRID (table), widget, 1, 3, 1, 1);
+    gtk_widget_set_tooltip_text (widget, _("Width of transition band(s)"));
+    gtk_entry_set_width_chars (GTK_ENTRY (widget), GUI_ENTRY_WIDTH_CHARS);
+    gtk_widget_set_sensitive (widget, FALSE);
+    GLADE_HOOKUP_OBJECT (topWidget, widget, STDIIRDLG_ENTRY_WIDTH);
+
+    label = gtk_label_new_with_mnemonic (_("_Transition"));
+    gtk_grid_attach (GTK_GRID (table), label, 0, 3, 1, 1);
+    gtk_widget_set_halign (label, GTK_ALIGN_END);
+    gtk_label_set_mnemonic_widget (GTK_LABEL (label), widget);
+
+    label = gtk_label_new (pPrefs->frequUnit.name);        /* transition unit */
+    gtk_grid_attach (GTK_GRID (table), label, 2, 3, 1, 1);
+    gtk_widget_set_halign (label, GTK_ALIGN_START);
+    GLADE_HOOKUP_OBJECT (topWidget, label, STDIIRDLG_UNIT_WIDTH);
+
+    g_signal_connect ((gpointer) lookup_widget (topWidget, STDIIRDLG_CHKBTN_MINORDER),
+                      "toggled", G_CALLBACK (toleranceSchemeChanged),
+                      NULL);
+
     g_signal_connect ((gpointer) comboFtr, "changed",
                       G_CALLBACK (transformTypeChanged),
                       NULL);
@@ -508,6 +584,8 @@ void stdIirDesignDlgPreset (GtkWidget *topWidget, const STDIIR_DESIGN *pDesign,
                         pPrefs->frequUnit.name);
     gtk_label_set_text (GTK_LABEL (lookup_widget (topWidget, STDIIRDLG_UNIT_BANDW)),
                         pPrefs->frequUnit.name);
+    gtk_label_set_text (GTK_LABEL (lookup_widget (topWidget, STDIIRDLG_UNIT_WIDTH)),
+                        pPrefs->frequUnit.name);
 
     gtk_toggle_button_set_active (GTK_TOGGLE_BUTTON (
                                       stdIirDlgChar[pDesign->type].btn), TRUE);
@@ -591,6 +669,9 @@ void stdIirDesignDlgDestroy (GtkWidget *topWidget)
         GLADE_HOOKUP_OBJECT_NO_REF (topWidget, NULL, STDIIRDLG_ENTRY_RIPPLE);
         GLADE_HOOKUP_OBJECT_NO_REF (topWidget, NULL, STDIIRDLG_ENTRY_MINATT);
         GLADE_HOOKUP_OBJECT_NO_REF (topWidget, NULL, STDIIRDLG_SPIN_ANGLE);
+        GLADE_HOOKUP_OBJECT_NO_REF (topWidget, NULL, STDIIRDLG_CHKBTN_MINORDER);
+        GLADE_HOOKUP_OBJECT_NO_REF (topWidget, NULL, STDIIRDLG_ENTRY_WIDTH);
+        GLADE_HOOKUP_OBJECT_NO_REF (topWidget, NULL, STDIIRDLG_UNIT_WIDTH);
 
         GLADE_HOOKUP_OBJECT_NO_REF(topWidget, NULL, STDIIRDLG_WIDGET_MAIN);
 
@@ -641,13 +722,10 @@ int stdIirDesignDlgApply (GtkWidget *topWidget, const CFG_DESKTOP* pPrefs)
     FLTCOEFF filter;
 
     int err = INT_MAX;
-    STDIIR_DESIGN design = {STDIIR_TYPE_SIZE - 1, 0};        /* preset design */
-
-    while ((design.type > 0) &&               /* look for active radio button */
-           !gtk_toggle_button_get_active (GTK_TOGGLE_BUTTON(stdIirDlgChar[design.type].btn)))
-    {
-        --design.type;
-    } /* while */
+    STDIIR_DESIGN design = {activeDlgChar ()->type, 0};      /* preset design */
+    gboolean minOrder = stdIirDlgChar[design.type].hasMinOrder &&
+        gtk_toggle_button_get_active (
+            GTK_TOGGLE_BUTTON (lookup_widget (topWidget, STDIIRDLG_CHKBTN_MINORDER)));
 
 
     combo = lookup_widget (topWidget, STDIIRDLG_COMBO_FTR);
@@ -659,7 +737,7 @@ int stdIirDesignDlgApply (GtkWidget *topWidget, const CFG_DESKTOP* pPrefs)
     {
         gint idx;
 
-        if (stdIirDlgChar[design.type].hasRipple)
+        if (stdIirDlgChar[design.type].hasRipple || minOrder)
         {                                        /* get passband ripple in dB */
             if (!dlgGetDouble (topWidget, STDIIRDLG_ENTRY_RIPPLE,
                                STDIIR_RIPPLE_MIN, STDIIR_RIPPLE_MAX, 1.0,
@@ -670,7 +748,7 @@ int stdIirDesignDlgApply (GtkWidget *topWidget, const CFG_DESKTOP* pPrefs)
         } /* if */
 
 
-        if (stdIirDlgChar[design.type].hasStopband)
+        if (stdIirDlgChar[design.type].hasStopband || minOrder)
         {                                   /* get stopband attenuation in dB */
             if (!dlgGetDouble (topWidget, STDIIRDLG_ENTRY_MINATT,
                                STDIIR_STOPATT_MIN, STDIIR_STOPATT_MAX, 1.0,
@@ -680,7 +758,7 @@ int stdIirDesignDlgApply (GtkWidget *topWidget, const CFG_DESKTOP* pPrefs)
             } /* if */
         } /* if */
 
-        if (stdIirDlgChar[design.type].hasAngle)
+        if (stdIirDlgChar[design.type].hasAngle && !minOrder)
         {                                                /* get modular angle */
             if (!dlgGetDouble (topWidget, STDIIRDLG_SPIN_ANGLE,
                                STDIIR_ANGLE_MIN, STDIIR_ANGLE_MAX, 1.0,
@@ -690,6 +768,16 @@ int stdIirDesignDlgApply (GtkWidget *topWidget, const CFG_DESKTOP* pPrefs)
             } /* if */
         } /* if */
 
+        if (minOrder)                             /* get transition bandwidth */
+        {
+            if (!dlgGetDouble (topWidget, STDIIRDLG_ENTRY_WIDTH,
+                               FLT_SAMPLE_MIN / 2, FLT_SAMPLE_MAX / 2,
+                               pPrefs->frequUnit.multiplier, &design.width))
+            {
+                return INT_MAX;
+            } /* if */
+        } /* if */
+
 
         idx = gtk_combo_box_get_active(GTK_COMBO_BOX (combo));
 
@@ -702,7 +790,7 @@ int stdIirDesignDlgApply (GtkWidget *topWidget, const CFG_DESKTOP* pPrefs)
             design.ftr.type = idx;
         } /* else */
 
-        if (ftrEntry[design.ftr.type][4] && GSL_IS_ODD(design.order))
+        if (ftrEntry[design.ftr.type][4] && GSL_IS_ODD(design.order) && !minOrder)
         {
             dlgError(topWidget, _("Degree must be even for bandpass/bandstop."));
             return INT_MAX;
@@ -749,7 +837,37 @@ int stdIirDesignDlgApply (GtkWidget *topWidget, const CFG_DESKTOP* pPrefs)
         } /* if */
 
         design.zAlgo = ZTR_BILINEAR;                                   /* fix */
-        err = stdIirFilterGen (&design, &filter);  /* generate the IIR filter */
+
+        if (minOrder)         /* calculate minimum order for tolerance scheme */
+        {
+            err = stdIirFilterMinOrder (&design, filter.f0);
+
+            if (err == GSL_ETOL)
+            {
+                dlgError (topWidget, _("No degree up to %d meets the tolerance"
+                                       " scheme."), FLT_DEGREE_MAX);
+                return INT_MAX;
+            } /* if */
+
+            if (err != 0)
+            {
+                dlgError (topWidget, _("Tolerance scheme mismatch."));
+                return INT_MAX;
+            } /* if */
+
+            gtk_spin_button_set_value (
+                GTK_SPIN_BUTTON (lookup_widget (topWidget, STDIIRDLG_SPIN_DEGREE)),
+                design.order);
+
+            if (stdIirDlgChar[design.type].hasAngle)
+            {
+                dlgSetDouble (topWidget, STDIIRDLG_SPIN_ANGLE, 1.0, design.angle);
+            } /* if */
+        } /* if */
+
+        err = dfcPrjFilterGen (FLTCLASS_STDIIR,    /* generate the IIR filter */
+                               stdIirDlgFilterGen,
+                               (DESIGNDLG *)&design, &filter);
 
         if (!FLTERR_CRITICAL (err))
         {
@@ -41,6 +41,20 @@
 #define STDIIR_BESSEL_EPSREL    1.0E-9
 
 
+/** Tolerance of the (real) minimum order of a standard approximation before
+    it is rounded up, so that an exactly matching order is not increased by
+    rounding errors.
+ */
+#define STDIIR_MINORDER_EPS     1.0E-9
+
+
+/** Modules \f$k\f$ below that value let the complementary complete elliptic
+    integral be calculated by its asymptotic \f$K'(k)\approx\ln(4/k)\f$,
+    because \f$\sqrt{1-k^2}\f$ cannot be distinguished from 1.
+ */
+#define STDIIR_ELLINT_KSMALL    1.0E-6
+
+
 
 /* LOCAL VARIABLE DEFINITIONS *************************************************/
 
@@ -50,8 +64,8 @@
 
 /* MACRO **********************************************************************/
 /** Error code check and conditional return. The macro checks for an error code
- *  unequal to zero in \p cond. On that condition it calls filterFree(), then
- *  returns.
+ *  unequal to zero in \p cond. On that condition it calls filterFree(),
+ *  releases the scratch arena and returns.
  *
  *  \param pFilter      Pointer to filter.
  *  \param cond         Condition to be checked (e.g. may be a function call).
@@ -59,15 +73,24 @@
  *
  ******************************************************************************/
 #define STDIIR_ERROR_RET(pFilter, cond, string) \
-    ERROR_RET_IF(cond, string, filterFree (pFilter); gsl_set_error_handler (oldHandler))
+    ERROR_RET_IF(cond, string, filterFree (pFilter); mathPolyArenaEnd ())
 
 
 /* LOCAL FUNCTION DECLARATIONS ************************************************/
 
 static double bilinearInv (double fz, double f0);
+static double bilinear (double fl, double f0);
 static double drosselung(double att);
 static int ftrHighpass(FLTCOEFF *pFilter, double omega);
 static int ftrBandpass(FLTCOEFF *pFilter, double omega, double quality);
+static void rootsHighpass (FLTCOEFF *pFilter, double omega, gsl_complex *pGain);
+static void rootsBandpass (FLTCOEFF *pFilter, double omega, double quality,
+                           gsl_complex *pGain);
+static void rootsBilinear (FLTCOEFF *pFilter, double a, gsl_complex *pGain);
+static int transformRoots (FLTCOEFF *pFilter, FTR type, double omega,
+                           double quality, double a);
+static int transformCoeffs (FLTCOEFF *pFilter, FTR type, double omega,
+                            double quality, double a);
 static double evalPolyAbsLaplace(double omega, MATHPOLY *poly);
 static double magnitudeLaplace(double omega, FLTCOEFF *pFilter);
 static double cutoffMagnitude(double omega, void *pFilter);
@@ -76,6 +99,10 @@ static double approxChebyPassband (double maxAtt, FLTCOEFF *pFilter);
 static double approxChebyStopband (double minAtt, FLTCOEFF *pFilter);
 static double approxCauer (STDIIR_TYPE type, double angle, double dr, FLTCOEFF *pFilter);
 static double approxBessel (FLTCOEFF *pFilter);
+static double ellintF (double phi, double k);
+static double ellintKcompl (double k);
+static double minOrderLowpass (STDIIR_TYPE type, double selectivity,
+                               double discrimination);
 
 
 /* LOCAL FUNCTION DEFINITIONS *************************************************/
@@ -126,6 +153,25 @@ static double bilinearInv(double fz, double f0)
 
 
 
+/* FUNCTION *******************************************************************/
+/** Forward bilinear (frequency) transformation, which is the reverse of
+ *  bilinearInv():
+    \f[
+    f_z=\frac{f_0}{\pi}\arctan\frac{\pi f_l}{f_0}
+    \f]
+ *
+ *  \param fl           Frequency in \e Laplace domain.
+ *  \param f0           Sampling frequency.
+ *
+ *  \return             Frequency in Z domain.
+ ******************************************************************************/
+static double bilinear (double fl, double f0)
+{
+    return f0 * M_1_PI * atan (M_PI * fl / f0);
+} /* bilinear() */
+
+
+
 /* FUNCTION *******************************************************************/
 /** Calculates discrimination (in German \e Drosselung) from attenuation. The
  *  calculation is based on \f$10^{A / 10} - 1\f$, which is the reverse of:
@@ -220,14 +266,288 @@ static int ftrBandpass (FLTCOEFF *pFilter, double omega, double quality)
 } /* ftrBandpass() */
 
 
+/* FUNCTION *******************************************************************/
+/** \e Laplace domain highpass transformation of roots. This is the roots
+ *  counterpart of ftrHighpass(), means each root \f$s_i\f$ maps to
+ *  \f$\omega_c^2/s_i\f$ and each zero at infinity to a zero at the origin.
+ *  Because of \f$\omega_c^2/s-s_i=-(s_i/s)(s-\omega_c^2/s_i)\f$ the gain
+ *  changes by \f$\prod(-z_i)/\prod(-p_i)\f$.
+ *
+ *  \param pFilter      Representation of system in \e Laplace domain by
+ *                      roots (numerator and denominator degree are the number
+ *                      of finite zeros and poles). The roots space must be
+ *                      enough to hold \p pFilter->den.degree zeros.
+ *  \param omega        Angular frequency of mirror point \f$\omega_c\f$,
+ *                      the denormalized lowpass cut-off frequency.
+ *  \param pGain        Pointer to gain, which is updated.
+ *
+ ******************************************************************************/
+static void rootsHighpass (FLTCOEFF *pFilter, double omega, gsl_complex *pGain)
+{
+    int i;
+
+    int inf = pFilter->den.degree - pFilter->num.degree;   /* zeros at s=inf */
+
+    omega *= omega;
+
+    for (i = 0; i < pFilter->den.degree; i++)     /* interleaved (wrt. gain) */
+    {
+        if (i < pFilter->num.degree)
+        {
+            *pGain = gsl_complex_mul (*pGain, gsl_complex_negative (pFilter->num.root[i]));
+            pFilter->num.root[i] =
+                gsl_complex_mul_real (gsl_complex_inverse (pFilter->num.root[i]), omega);
+        } /* if */
+
+        *pGain = gsl_complex_div (*pGain, gsl_complex_negative (pFilter->den.root[i]));
+        pFilter->den.root[i] =
+            gsl_complex_mul_real (gsl_complex_inverse (pFilter->den.root[i]), omega);
+    } /* for */
+
+    for (i = 0; i < inf; i++)                   /* zeros at infinity -> s = 0 */
+    {
+        GSL_SET_COMPLEX (&pFilter->num.root[pFilter->num.degree + i], 0.0, 0.0);
+    } /* for */
+
+    pFilter->num.degree += inf;
+} /* rootsHighpass() */
+
+
+/* FUNCTION *******************************************************************/
+/** \e Laplace domain bandpass transformation of roots. This is the roots
+ *  counterpart of ftrBandpass(). Because of
+ *  \f$Q(s^2+\omega_m^2)/s-s_i=(Q/s)(s^2-(s_i/Q)s+\omega_m^2)\f$ each root
+ *  \f$s_i\f$ maps to two roots, each zero at infinity to one zero at the
+ *  origin and one at infinity and the gain changes by \f$Q^{m-n}\f$.
+ *
+ *  \param pFilter      Representation of system in \e Laplace domain by
+ *                      roots (numerator and denominator degree are the number
+ *                      of finite zeros and poles). The roots space must be
+ *                      enough to hold twice \p pFilter->den.degree roots.
+ *  \param omega        Denormalized angular center (mid) frequency \f$\omega_m\f$.
+ *  \param quality      Bandpass quality \f$Q\f$.
+ *  \param pGain        Pointer to gain, which is updated.
+ *
+ ******************************************************************************/
+static void rootsBandpass (FLTCOEFF *pFilter, double omega, double quality,
+                           gsl_complex *pGain)
+{
+    int i, k;
+    gsl_complex mid, delta;
+    MATHPOLY *poly;
+
+    int inf = pFilter->den.degree - pFilter->num.degree;   /* zeros at s=inf */
+
+    for (k = 0, poly = &pFilter->num; k < 2; k++, poly = &pFilter->den)
+    {
+        for (i = poly->degree - 1; i >= 0; i--) /* backwards (two from one) */
+        {
+            mid = gsl_complex_div_real (poly->root[i], 2.0 * quality);
+            delta = gsl_complex_sqrt (gsl_complex_sub_real (gsl_complex_mul (mid, mid),
+                                                            omega * omega));
+            poly->root[2 * i] = gsl_complex_add (mid, delta);
+            poly->root[2 * i + 1] = gsl_complex_sub (mid, delta);
+        } /* for */
+
+        poly->degree *= 2;
+    } /* for */
+
+    for (i = 0; i < inf; i++)                   /* half of them go to s = 0 */
+    {
+        GSL_SET_COMPLEX (&pFilter->num.root[pFilter->num.degree + i], 0.0, 0.0);
+        *pGain = gsl_complex_div_real (*pGain, quality);
+    } /* for */
+
+    pFilter->num.degree += inf;
+} /* rootsBandpass() */
+
+
+/* FUNCTION *******************************************************************/
+/** Bilinear transformation of roots. Based on the substitution
+ *  \f$s:=a\,(z-1)/(z+1)\f$ each root \f$s_i\f$ maps to
+ *  \f$z_i=(a+s_i)/(a-s_i)\f$ and each zero at infinity to \f$z=-1\f$.
+ *  Because of \f$a(z-1)/(z+1)-s_i=(a-s_i)(z-z_i)/(z+1)\f$ the gain changes
+ *  by \f$\prod(a-z_i)/\prod(a-p_i)\f$.
+ *
+ *  \param pFilter      Representation of system in \e Laplace domain by
+ *                      roots (numerator and denominator degree are the number
+ *                      of finite zeros and poles), which is transformed into
+ *                      Z domain. The roots space must be enough to hold
+ *                      \p pFilter->den.degree zeros.
+ *  \param a            Pre-factor \f$a\f$ of bilinear transformation.
+ *  \param pGain        Pointer to gain, which is updated.
+ *
+ ******************************************************************************/
+static void rootsBilinear (FLTCOEFF *pFilter, double a, gsl_complex *pGain)
+{
+    int i;
+    gsl_complex tmp;
+
+    int inf = pFilter->den.degree - pFilter->num.degree;   /* zeros at s=inf */
+
+    for (i = 0; i < pFilter->den.degree; i++)     /* interleaved (wrt. gain) */
+    {
+        if (i < pFilter->num.degree)
+        {
+            tmp = gsl_complex_add_real (gsl_complex_negative (pFilter->num.root[i]), a);
+            *pGain = gsl_complex_mul (*pGain, tmp);
+            pFilter->num.root[i] =
+                gsl_complex_div (gsl_complex_add_real (pFilter->num.root[i], a), tmp);
+        } /* if */
+
+        tmp = gsl_complex_add_real (gsl_complex_negative (pFilter->den.root[i]), a);
+        *pGain = gsl_complex_div (*pGain, tmp);
+        pFilter->den.root[i] =
+            gsl_complex_div (gsl_complex_add_real (pFilter->den.root[i], a), tmp);
+    } /* for */
+
+    for (i = 0; i < inf; i++)
+    {
+        GSL_SET_COMPLEX (&pFilter->num.root[pFilter->num.degree + i], -1.0, 0.0);
+    } /* for */
+
+    pFilter->num.degree += inf;
+} /* rootsBilinear() */
+
+
+/* FUNCTION *******************************************************************/
+/** Transforms a (normalized) lowpass into Z domain by its roots. Zeros and
+ *  poles are mapped by frequency transformation (if any) and bilinear
+ *  transformation. The coefficients are expanded once from the Z domain roots
+ *  at the end, which avoids the growing dynamic range of coefficients during
+ *  polynomial substitution (see transformCoeffs()).
+ *
+ *  \param pFilter      Lowpass in \e Laplace domain, specified by roots and
+ *                      \a factor. On return it holds roots and coefficients
+ *                      in Z domain (coefficients with positive powers of z).
+ *  \param type         Frequency transformation type.
+ *  \param omega        Normalized angular cut-off frequency of the lowpass.
+ *  \param quality      Bandpass quality \f$Q\f$ (BP and BS only).
+ *  \param a            Pre-factor of bilinear transformation.
+ *
+ *  \return             Zero on success, else an error number (see errno.h or
+ *                      gsl_errno.h for predefined codes).
+ ******************************************************************************/
+static int transformRoots (FLTCOEFF *pFilter, FTR type, double omega,
+                           double quality, double a)
+{
+    gsl_complex gain = gsl_complex_rect (pFilter->factor, 0.0);
+
+    switch (type)
+    {
+        case FTR_HIGHPASS:                /* lowpass->highpass transformation */
+            rootsHighpass (pFilter, omega, &gain);
+            break;
+
+
+        case FTR_BANDSTOP:
+            rootsHighpass (pFilter, omega, &gain);         /* fall trough */
+
+        case FTR_BANDPASS:                           /* LP->BP transformation */
+            rootsBandpass (pFilter, omega, quality, &gain);
+            break;  /* FTR_BANDPASS, FTR_BANDSTOP */
+
+
+        case FTR_NON:
+            break;
+
+        default:
+            ASSERT(0);
+            break;
+    } /* switch */
+
+    rootsBilinear (pFilter, a, &gain);
+
+    ERROR_RET_IF (mathPolyRoots2Coeffs (&pFilter->den, 1.0),
+                  "Conversion of poles into coefficients has failed");
+    ERROR_RET_IF (mathPolyRoots2Coeffs (&pFilter->num, GSL_REAL (gain)),
+                  "Conversion of zeros into coefficients has failed");
+
+    return 0;
+} /* transformRoots() */
+
+
+/* FUNCTION *******************************************************************/
+/** Transforms a (normalized) lowpass into Z domain by its coefficients, using
+ *  frequency transformation (if any) and bilinear transformation of the
+ *  polynomials.
+ *
+ *  \param pFilter      Lowpass in \e Laplace domain, specified by its
+ *                      coefficients. On return it holds the coefficients in
+ *                      Z domain (with positive powers of z).
+ *  \param type         Frequency transformation type.
+ *  \param omega        Normalized angular cut-off frequency of the lowpass.
+ *  \param quality      Bandpass quality \f$Q\f$ (BP and BS only).
+ *  \param a            Pre-factor of bilinear transformation.
+ *
+ *  \return             Zero on success, else an error number (see errno.h or
+ *                      gsl_errno.h for predefined codes).
+ ******************************************************************************/
+static int transformCoeffs (FLTCOEFF *pFilter, FTR type, double omega,
+                            double quality, double a)
+{
+    int i, degree;
+
+    switch (type)
+    {
+        case FTR_HIGHPASS:                /* lowpass->highpass transformation */
+            ERROR_RET_IF (ftrHighpass (pFilter, omega),
+                          "Lowpass->Highpass transformation");
+            break;
+
+
+        case FTR_BANDSTOP:
+            ERROR_RET_IF (ftrHighpass (pFilter, omega),
+                          "Lowpass->Bandstop transformation");
+                                                               /* fall trough */
+
+        case FTR_BANDPASS:                           /* LP->BP transformation */
+            ERROR_RET_IF (ftrBandpass (pFilter, omega, quality),
+                          "Lowpass->Bandpass transformation");
+            break;  /* FTR_BANDPASS, FTR_BANDSTOP */
+
+
+        case FTR_NON:
+            break;
+
+        default:
+            ASSERT(0);
+            break;
+    } /* switch */
+
+
+    /* Denominator polynomial degree is greater/equal numerator polynomial
+     * degree for standard approximations. Compensate later the pre-factor
+     * (1+z)^{n-m} inserted by function mathPolyTransform().
+     */
+    degree = pFilter->den.degree - pFilter->num.degree;
+    ASSERT (degree >= 0);
+
+    ERROR_RET_IF (mathPolyTransform (&pFilter->den, 1, a, -a, 1, 1.0, 1.0),
+                  "Bilinear transformation and denormalization (denominator)");
+    ERROR_RET_IF (mathPolyTransform (&pFilter->num, 1, a, -a, 1, 1.0, 1.0),
+                  "Bilinear transformation and denormalization (numerator)");
+
+    for (i = 0; i < degree; i++)
+    {
+        mathPolyMulBinomial (&pFilter->num, 1, 1.0, 1.0);
+    } /* for */
+
+    return 0;
+} /* transformCoeffs() */
+
+
+
 /* FUNCTION *******************************************************************/
 /** Evaluates absolute magnitude associated with a polynomial in \e Laplace
  *  domain. The function returns the absolute value of polynomial \f$P(s)\f$
- *  for \f$s\Rightarrow j\omega\f$:
+ *  for \f$s\Rightarrow j\omega\f$. Because \f$(j\omega)^2=-\omega^2\f$ is
+ *  real, the even and odd coefficients give the real and imaginary part,
+ *  which are evaluated in real arithmetic by two independent \e Horner
+ *  chains in \f$x=-\omega^2\f$:
     \f{eqnarray*}
         P(s) &=& a_0+a_1 j\omega+a_2 (j\omega)^2+\cdots a_n (j\omega)^n \\
-             &=& (\cdots(a_n j\omega + a_{n-1}) j\omega + a_{n-2}) j\omega
-                 +\cdots+a_0
+             &=& (a_0+a_2 x+a_4 x^2+\cdots)+j\omega(a_1+a_3 x+a_5 x^2+\cdots)
     \f}
  *
  *  \param omega        Angular frequency in rad/s.
@@ -237,20 +557,18 @@ static int ftrBandpass (FLTCOEFF *pFilter, double omega, double quality)
  ******************************************************************************/
 static double evalPolyAbsLaplace(double omega, MATHPOLY *poly)
 {
-    gsl_complex result;
-
-    int i = poly->degree;
-    double *pCoeff = &poly->coeff[i];
-
-    GSL_SET_COMPLEX(&result, 0.0, 0.0);
+    int m = poly->degree / 2;
+    double x = -omega * omega;
+    double re = poly->coeff[2 * m];                /* even coefficients */
+    double im = (2 * m < poly->degree) ? poly->coeff[2 * m + 1] : 0.0;
 
-    while (i >= 0)
+    for (--m; m >= 0; m--)
     {
-        result = gsl_complex_add_real (gsl_complex_mul_imag (result, omega), *pCoeff);
-        --i; --pCoeff;
+        re = re * x + poly->coeff[2 * m];
+        im = im * x + poly->coeff[2 * m + 1];
     } /* for */
 
-    return gsl_complex_abs(result);
+    return hypot (re, omega * im);
 } /* evalPolyAbsLaplace() */
 
 
@@ -482,23 +800,21 @@ static double approxChebyStopband (double minAtt, FLTCOEFF *pFilter)
     \f}
 
  *  which are best approximations in \f$0<\omega<1\f$ and
- *  \f$1/k<\omega<\infty\f$ respectively. Each characteristic function may be
- *  written in fractional terms \f$D(s)=P(s)/Q(s)\f$ too:
-    \f{eqnarray*}
-        |H(s)|^2  &=& \frac{1}{1+\sigma^2 D(s)D(-s)} \\ 
-        H(s)H(-s) &=& \frac{Q(s)Q(-s)}{Q(s)Q(-s)+\sigma^2 P(s)P(-s)}
-    \f}
-
- *  If we take the special property of first principal elliptic transformation
- *  into account, namely the \e Laplace variable always is used squared (except
- *  one root at the origin in the odd case), which means \f$P(s)=\pm P(-s)\f$
- *  (neg. sign only for odd case) and \f$Q(s)=Q(-s)\f$, then:
+ *  \f$1/k<\omega<\infty\f$ respectively. With \f$s=j\jsn(u;k)\f$ the
+ *  characteristic function is \f$D=\jsn(u/M;\lambda)\f$ (up to a shift of the
+ *  argument) and the poles of
+    \f[
+        H(s)H(-s) = \frac{1}{1+\sigma^2 D(s)D(-s)}
+    \f]
+ *  follow from \f$\jsn(u/M;\lambda)=\pm j/\sigma\f$ in closed form, which
+ *  avoids any (numerical) roots finding:
     \f{eqnarray*}
-        P(s)P(-s) &=& \pm P^2(s)\\
-        Q(s)Q(-s) &=& \hphantom{\pm} Q^2(s)
+        s_\eta &=& j\,\jsn(\eta K/n + jv;k)
+                   \quad (\eta=0,2,4,\ldots\;\textup{resp.}\;\eta=1,3,5,\ldots) \\
+        v      &=& M F(\arctan(1/\sigma);\lambda')
     \f}
- *  With this in mind the substitution \f$s^2=x\f$ is possible and roots
- *  finding can be performed in variable x domain.
+ *  The \e Jacobian elliptic function of complex argument is evaluated by the
+ *  addition theorem from real arguments of module \f$k\f$ and \f$k'\f$.
  *
  *  \param type         Type of \e Cauer lowpass (STDIIR_TYPE_CAUER1,
  *                      STDIIR_TYPE_CAUER2).
@@ -536,14 +852,12 @@ static double approxChebyStopband (double minAtt, FLTCOEFF *pFilter)
 static double approxCauer (STDIIR_TYPE type, double angle, double dr, FLTCOEFF *pFilter)
 {
     int i;
-    gsl_sf_result result;    /* special GSL result structure (etmporary used) */
-    gsl_complex *pRootNumD;         /* pointer to P(x) resp. P(s), with x=s^2 */
-    gsl_complex *pRootDenD;         /* pointer to Q(x) resp. Q(s), with x=s^2 */
-    gsl_complex *pRootNumH;             /* Pointer to numerator roots of H(s) */
-    MATHPOLY denPoly2;     /* Q(x)^2, means squared denominator poly in x=s^2 */
+    gsl_complex *pRoot;                     /* pointer to roots (zeros/poles) */
     double snOdd, snEven, cn, dn;       /* Jacobian elliptic function results */
+    double snIm, cnIm, dnIm;      /* sn, cn, dn of imaginary part (module k') */
     double deltaK;             /* partial complete elliptic integral K(k) / n */
     double sigma;       /* scaling factor of characteristc function D(\omega) */
+    double denom;             /* denominator of addition theorem for sn(u+jv) */
     double *pZero;           /* pointer to numerator root (zero) of polynomial*/
     double factor; /* multiplier of characteristic function (\f$k/\lambda M\f$ */
                              /* in odd case, \f$1/\lambda\f$ for even degree) */
@@ -558,17 +872,7 @@ static double approxCauer (STDIIR_TYPE type, double angle, double dr, FLTCOEFF *
     int degree = pFilter->den.degree;
 
 
-    /* Allocate denominator polynomial of squared characteristic function D(s).
-     */
-    denPoly2.degree = degree;
-
-    if (mathPolyMalloc(&denPoly2) != 0)
-    {
-        return 0.0;                                    /* out of memory space */
-    } /* if */
-
-
-    pFilter->num.degree = denPoly2.degree = (degree / 2) * 2;
+    pFilter->num.degree = (degree / 2) * 2;
     deltaK = gsl_sf_ellint_Kcomp (module, GSL_PREC_DOUBLE) / degree;
 
     /* Set start index for running variable during for-loop. For odd degree the
@@ -577,19 +881,12 @@ static double approxCauer (STDIIR_TYPE type, double angle, double dr, FLTCOEFF *
     */
     pZero = GSL_IS_ODD (degree) ? &snEven : &snOdd;
 
-    /* Now prepare for-loop
-     */
-    pRootNumH = pFilter->num.root;                           /* zeros of H(s) */
-    pRootNumD = pFilter->den.root;  /* P(x), means zeros of D^2(x) with x=s^2 */
-    pRootDenD = denPoly2.root;                 /* Q(x), means poles of D^2(x) */
-
-    for (i = 0; i < denPoly2.degree; i += 2)
+    for (i = 0, pRoot = pFilter->num.root; i < pFilter->num.degree; i += 2)
     {
         if ((gsl_sf_elljac_e ((i + 1) * deltaK, kappa, &snOdd, &cn, &dn) != 0)
             || (gsl_sf_elljac_e ((i + 2) * deltaK, kappa, &snEven, &cn, &dn) != 0))
         {                                                             /* EDOM */
             DEBUG_LOG ("Jacobian elliptic function calculation has failed");
-            mathPolyFree(&denPoly2);
             return 0.0;
         } /* if */
 
@@ -597,27 +894,15 @@ static double approxCauer (STDIIR_TYPE type, double angle, double dr, FLTCOEFF *
         /* Roots of numerator polynomial of transfer function are determined by
            denominator roots of characteristic function D(s).
         */
-        GSL_SET_COMPLEX(pRootNumH, 0.0, 1.0 / (module * *pZero));
-        GSL_SET_COMPLEX(pRootNumH + 1, 0.0, - GSL_IMAG(*pRootNumH));
+        GSL_SET_COMPLEX(pRoot, 0.0, 1.0 / (module * *pZero));
+        GSL_SET_COMPLEX(pRoot + 1, 0.0, - GSL_IMAG(*pRoot));
+        pRoot += 2;
 
         snOdd *= snOdd;                                     /* square to sn^2 */
         snEven *= snEven;
 
         multiplier *= snOdd / snEven;                   /* update M's product */
         lambda *= snOdd * snOdd;            /* update \lambda product by sn^4 */
-
-        /* With x=s^2 the associated roots of D(s)D(-s) are located at
-         * x = -sn^2(i K/n) respectively x = -1/(k sn(i K/n))^2 in x-domain.
-         */
-        GSL_SET_COMPLEX(pRootNumD, - *pZero, 0.0);          /* real root in x */
-        *(pRootNumD + 1) = *pRootNumD;       /* double root of P(s)P(-s) in x */
-
-        GSL_SET_COMPLEX(pRootDenD, -1.0 / (*pZero * kappa), 0.0);
-        *(pRootDenD + 1) = *pRootDenD;       /* double root of Q(s)Q(-s) in x */
-
-        pRootNumH += 2;
-        pRootNumD += 2;
-        pRootDenD += 2;
     } /* for */
 
 
@@ -626,8 +911,7 @@ static double approxCauer (STDIIR_TYPE type, double angle, double dr, FLTCOEFF *
 
     if (GSL_IS_ODD (degree))                                      /* odd case */
     {
-        GSL_SET_COMPLEX (pRootNumD, 0.0, 0.0); /* root of P(s)P(-s) at origin */
-        factor *= -module * multiplier;  /* odd case factor = - k / \lambda M */
+        factor *= module * multiplier;     /* odd case factor = k / \lambda M */
     } /* if */
 
 
@@ -650,8 +934,6 @@ static double approxCauer (STDIIR_TYPE type, double angle, double dr, FLTCOEFF *
             if (sigma < lambda * drosselung (STDIIR_STOPATT_MIN))
             {
                 DEBUG_LOG ("Resulting stopband attenuation is less than 3dB");
-                mathPolyFree (&denPoly2);
-
                 return 0.0;        /* min. stopband attenuation less than 3dB */
             } /* if */
 
@@ -669,8 +951,6 @@ static double approxCauer (STDIIR_TYPE type, double angle, double dr, FLTCOEFF *
             if (sigma > drosselung (STDIIR_RIPPLE_MAX))
             {
                 DEBUG_LOG ("Resulting passband ripple is greater than 3dB");
-                mathPolyFree(&denPoly2);
-
                 return 0.0;                        /* ripple greater than 3dB */
             } /* if */
 
@@ -684,72 +964,69 @@ static double approxCauer (STDIIR_TYPE type, double angle, double dr, FLTCOEFF *
     } /* switch */
 
 
-    /* Calculate denominator polynomial Q(x)^2 of squared transfer function
-     * H(s)H(-s).
+    /* Set the scaling factor of H(s) roots from its value at s=\infty, which
+       is 1/sqrt(1+\sigma^2 D^2(\infty)) with D(\infty)=1/\lambda in even case,
+       and which is approached by \lambda/(\sigma k M s) in odd case.
      */
     factor *= sigma;           /* factor now holds the product factor * sigma */
-    pFilter->factor = 1.0 / fabs (factor); /* set scaling factor of H(s) roots */
-    factor *= fabs (factor); /* square \sigma wrt. calculations of H(s)H(-s), */
-                           /* but preserves the negative sign in the odd case */
 
-    if ((mathPolyRoots2Coeffs (&pFilter->den, factor) != 0) /* coeffs of \sigma^2 P(x)^2 */
-        || (mathPolyRoots2Coeffs (&denPoly2, 1.0) != 0))  /* coeffs of Q(x)^2 */
+    if (GSL_IS_ODD (degree))
     {
-        DEBUG_LOG ("Denominator polynomial coefficients calculation of squared"
-                   " transfer function failed for Cauer filter");
-        mathPolyFree (&denPoly2);
-        return 0.0;
+        pFilter->factor = 1.0 / factor;
     } /* if */
+    else
+    {
+        pFilter->factor = 1.0 / HYPOT (1.0, factor);
+    } /* else */
 
 
-    /* Calculate Q(s)Q(-s) + \sigma^2 P(s)P(-s) for x=s^2.
+    /* The poles are located at s = j sn(\eta K/n + jv; k), which is evaluated
+       by the addition theorem. All Jacobian elliptic functions with imaginary
+       argument jv are transformed into real functions of module k'.
      */
-    mathPolyAdd (&pFilter->den, &denPoly2, 1.0);
-    mathPolyFree(&denPoly2);                              /* no longer needed */
-
+    lambda = sqrt (1.0 - lambda * lambda);                        /* \lambda' */
+    cn = ellintF (atan (1.0 / sigma), lambda);
 
-    /* Now calculate the denominator roots (poles) of transfer function in x
-     * domain.
-     */
-    if (mathPolyCoeffs2Roots (&pFilter->den) != GSL_SUCCESS)
+    if (gsl_isnan (cn)
+        || (gsl_sf_elljac_e (multiplier * cn, 1.0 - kappa,
+                             &snIm, &cnIm, &dnIm) != GSL_SUCCESS))
     {
-        DEBUG_LOG ("Roots finding for Cauer filter has failed");
+        DEBUG_LOG ("Jacobian elliptic function calculation has failed");
         return 0.0;
     } /* if */
 
 
-    /* Because roots finding is performed on H(s)H(-s) in x=s^2, the roots in
-     * \e Laplace domain are located at s = +/- \sqrt{x}. To define stabil LTI
-     * systems make the real part of all roots negative.
-     */
-    for (i = 0, pRootNumH = pFilter->den.root; i < degree; i++, pRootNumH++)
+    for (i = 0, pRoot = pFilter->den.root; i < degree / 2; i++, pRoot += 2)
     {
-        *pRootNumH = gsl_complex_negative (gsl_complex_sqrt (*pRootNumH));
+        if (gsl_sf_elljac_e ((2 * i + 1 + degree % 2) * deltaK, kappa,
+                             &snOdd, &cn, &dn) != GSL_SUCCESS)
+        {
+            DEBUG_LOG ("Jacobian elliptic function calculation has failed");
+            return 0.0;
+        } /* if */
+
+        denom = cnIm * cnIm + kappa * snOdd * snOdd * snIm * snIm;
+        GSL_SET_COMPLEX (pRoot, -cn * dn * snIm * cnIm / denom,
+                         snOdd * dnIm / denom);
+        GSL_SET_COMPLEX (pRoot + 1, GSL_REAL (*pRoot), -GSL_IMAG (*pRoot));
     } /* for */
 
 
+    if (GSL_IS_ODD (degree))     /* real pole at s = j sn(jv; k) = -sc(v; k') */
+    {
+        GSL_SET_COMPLEX (pRoot, -snIm / cnIm, 0.0);
+    } /* if */
+
+
     /* Last calculate 3dB cut-off frequency (associated with nd(u/M; lambda')=
        1/sigma, omega=nd(u;k')). So the condition is:
        sn^2(u/M;lambda') = (1 - sigma^2) / (1 - lambda^2)
      */
-    lambda = sqrt (1.0 - lambda * lambda);                        /* \lambda' */
-    sigma = asin (sqrt (1.0 - sigma * sigma) / lambda);  /* argument to funcs */
+    sigma = ellintF (asin (sqrt (1.0 - sigma * sigma) / lambda), lambda);
 
-    if (lambda == 1)                /* gsl_sf_ellint_F_e() cannot handle this */
-    {
-        result.val = log (fabs (tan (sigma / 2 + M_PI_4)));
-    } /* if */
-    else
-    {
-        if (gsl_sf_ellint_F_e (sigma, lambda, GSL_PREC_DOUBLE, &result) != GSL_SUCCESS)
-        {                               /* may give EDOM if \lambda is near 1 */
-            return 0.0;
-        } /* if */
-    } /* else */
-
-
-    if ((gsl_sf_elljac_e (multiplier * result.val, 1.0 - kappa,
-                          &snOdd, &cn, &dn) != GSL_SUCCESS))
+    if (gsl_isnan (sigma)
+        || (gsl_sf_elljac_e (multiplier * sigma, 1.0 - kappa,
+                             &snOdd, &cn, &dn) != GSL_SUCCESS))
     {
         return 0.0;
     } /* if */
@@ -843,6 +1120,108 @@ static double approxBessel (FLTCOEFF *pFilter)
 
 
 
+/* FUNCTION *******************************************************************/
+/** Calculates the incomplete elliptic integral of first kind
+ *  \f$F(\phi;k)\f$, including the limiting case \f$k=1\f$, which cannot be
+ *  handled by gsl_sf_ellint_F_e().
+ *
+ *  \param phi          Amplitude \f$\phi\f$.
+ *  \param k            Elliptic module \f$0\leq k\leq 1\f$.
+ *
+ *  \return             Elliptic integral \f$F(\phi;k)\f$, GSL_NAN in case of
+ *                      an error. Use gsl_isnan() for result checking.
+ ******************************************************************************/
+static double ellintF (double phi, double k)
+{
+    gsl_sf_result result;
+
+    if (k == 1.0)
+    {
+        return log (fabs (tan (phi / 2 + M_PI_4)));
+    } /* if */
+
+    if (gsl_sf_ellint_F_e (phi, k, GSL_PREC_DOUBLE, &result) != GSL_SUCCESS)
+    {                                         /* may give EDOM if k is near 1 */
+        return GSL_NAN;
+    } /* if */
+
+    return result.val;
+} /* ellintF() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Calculates the complementary complete elliptic integral of first kind
+ *  \f$K'(k)=K(\sqrt{1-k^2})\f$.
+ *
+ *  \param k            Elliptic module \f$0<k<1\f$.
+ *
+ *  \return             Complementary complete elliptic integral \f$K'(k)\f$.
+ ******************************************************************************/
+static double ellintKcompl (double k)
+{
+    if (k < STDIIR_ELLINT_KSMALL)
+    {
+        return log (4.0 / k);
+    } /* if */
+
+    return gsl_sf_ellint_Kcomp (sqrt (1.0 - k * k), GSL_PREC_DOUBLE);
+} /* ellintKcompl() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Calculates the (real) minimum degree of a normalized lowpass approximation
+ *  with passband edge \f$\omega=1\f$ and stopband edge
+ *  \f$\omega=\Omega>1\f$. With the discrimination ratio
+ *  \f$D=D_s/D_p>1\f$ of stopband and passband the closed-form solutions are:
+    \f{eqnarray*}
+        n_{Butterworth} &=& \frac{\ln D}{\ln\Omega} \\
+        n_{Chebyshev}   &=& \frac{\arcosh D}{\arcosh\Omega} \\
+        n_{Cauer}       &=& \frac{K(1/\Omega)\,K'(1/D)}{K'(1/\Omega)\,K(1/D)}
+    \f}
+ *  The \e Chebyshev formula holds for the inverse \e Chebyshev lowpass too.
+ *
+ *  \param type         Type of lowpass.
+ *  \param selectivity  Ratio \f$\Omega\f$ of stopband and passband edge.
+ *  \param discrimination Ratio \f$D\f$ of stopband and passband
+ *                      discrimination.
+ *
+ *  \return             Minimum degree (not rounded), 0.0 if there is no
+ *                      closed-form solution (\e Bessel) or in case of an
+ *                      error.
+ ******************************************************************************/
+static double minOrderLowpass (STDIIR_TYPE type, double selectivity,
+                               double discrimination)
+{
+    double k = 1.0 / selectivity;
+    double k1 = 1.0 / discrimination;
+
+    switch (type)
+    {
+        case STDIIR_TYPE_BUTTERWORTH:
+            return log (discrimination) / log (selectivity);
+
+
+        case STDIIR_TYPE_CHEBY:
+        case STDIIR_TYPE_CHEBYINV:
+            return acosh (discrimination) / acosh (selectivity);
+
+
+        case STDIIR_TYPE_CAUER1:
+        case STDIIR_TYPE_CAUER2:
+            return gsl_sf_ellint_Kcomp (k, GSL_PREC_DOUBLE) * ellintKcompl (k1) /
+                (ellintKcompl (k) * gsl_sf_ellint_Kcomp (k1, GSL_PREC_DOUBLE));
+
+
+        case STDIIR_TYPE_BESSEL:                   /* no closed-form solution */
+        default:
+            return 0.0;
+    } /* switch */
+} /* minOrderLowpass() */
+
+
+
 /* EXPORTED FUNCTION DEFINITIONS **********************************************/
 
 
@@ -858,18 +1237,51 @@ static double approxBessel (FLTCOEFF *pFilter)
  *  \param pDesign      Pointer to standard IIR design data.
  *  \param pFilter      Pointer to buffer which gets the generated filter.
  *                      Notice, that memory space for polynomials will be
- *                      allocated.
+ *                      allocated. Except for \e Bessel filters the analytic
+ *                      roots of the approximation are mapped into Z domain,
+ *                      means the filter comes with valid roots (\a factor
+ *                      is not zero).
  *
  *  \return             Zero on success, else an error number (see errno.h or
  *                      gsl_errno.h for predefined codes).
  ******************************************************************************/
 int stdIirFilterGen (STDIIR_DESIGN *pDesign, FLTCOEFF *pFilter)
 {
-    int i, degree;
-    gsl_error_handler_t *oldHandler;
+    int err;
+
+    /* All GSL errors are handled by the caller, therefore disable the abort
+     * behaviour of the GSL library.
+     */
+    gsl_error_handler_t *oldHandler = gsl_set_error_handler_off ();
+
+    err = stdIirFilterGenWorker (pDesign, pFilter);
+    gsl_set_error_handler (oldHandler);
+
+    return err;
+} /* stdIirFilterGen() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Generates an IIR filter like stdIirFilterGen(), but leaves the (process
+ *  global) GSL error handler untouched. The caller must have switched it off
+ *  before, see gsl_set_error_handler_off(). Worker threads use this function,
+ *  because saving and restoring the handler per call would race.
+ *
+ *  \param pDesign      Pointer to standard IIR design data.
+ *  \param pFilter      Pointer to buffer which gets the generated filter.
+ *
+ *  \return             Zero on success, else an error number (see errno.h or
+ *                      gsl_errno.h for predefined codes).
+ ******************************************************************************/
+int stdIirFilterGenWorker (STDIIR_DESIGN *pDesign, FLTCOEFF *pFilter)
+{
+    int i;
+    BOOL roots;                       /* lowpass is specified by its roots? */
     double fc;                   /* Real-world (design) 3dB cut-off frequency */
     double normOmega; /* Effective (normalized) 3dB cut-off angular frequency */
-    double bpQuality;                                        /* Q of BP or BS */
+    double bpQuality = 0.0;                                  /* Q of BP or BS */
+    double preFactor;               /* pre-factor of bilinear transformation */
 
     /* Memory allocation for coefficients and roots space in numerator and
      * denominator polynomial.
@@ -878,10 +1290,7 @@ int stdIirFilterGen (STDIIR_DESIGN *pDesign, FLTCOEFF *pFilter)
     ERROR_RET_IF (filterMalloc(pFilter),
                   "Standard IIR filter memory allocation");
 
-    /* All GSL errors are handled by the caller (starting from here), therefore
-     * disable the abort behaviour of the GSL library.
-     */
-    oldHandler = gsl_set_error_handler_off ();
+    mathPolyArenaBegin ();       /* all temporary polynomials from one arena */
 
     pFilter->factor = 0.0;            /* no valid roots representation so far */
 
@@ -985,89 +1394,335 @@ int stdIirFilterGen (STDIIR_DESIGN *pDesign, FLTCOEFF *pFilter)
     STDIIR_ERROR_RET (pFilter, (normOmega == 0.0) ? GSL_EFAILED : 0,
                       "Standard IIR filter approximation has failed");
 
-    if (pFilter->factor != 0.0)            /* lowpass specification by roots? */
-    {                                          /* transform into coefficients */
-        STDIIR_ERROR_RET (pFilter, mathPolyRoots2Coeffs (&pFilter->den, 1.0),
-                          "Conversion of poles into coefficients has failed");
-        STDIIR_ERROR_RET (pFilter, mathPolyRoots2Coeffs (&pFilter->num, pFilter->factor),
-                          "Conversion of zeros into coefficients has failed");
+    /* Scale standard approximation interval to normOmega / fc and
+       multiply with f0, which is the pre-factor of bilinear transformation.
+     */
+    preFactor = normOmega * pFilter->f0 / fc / M_PI;
+
+    /* If the lowpass is specified by its (analytic) roots, then transform the
+     * roots and expand the coefficients at the end. So the filter leaves with
+     * a valid roots representation.
+     */
+    roots = pFilter->factor != 0.0;
+
+    if (roots)
+    {
+        STDIIR_ERROR_RET (pFilter,
+                          transformRoots (pFilter, pDesign->ftr.type,
+                                          normOmega, bpQuality, preFactor),
+                          "Transformation of roots into Z domain");
     } /* if */
+    else
+    {
+        STDIIR_ERROR_RET (pFilter,
+                          transformCoeffs (pFilter, pDesign->ftr.type,
+                                           normOmega, bpQuality, preFactor),
+                          "Transformation of coefficients into Z domain");
+    } /* else */
 
+    pFilter->factor = 0.0;            /* no valid roots representation so far */
 
-    pFilter->factor = 0.0;                /* roots are valid only in L-domain */
 
-    switch (pDesign->ftr.type)
+    for (i = 0; i <= pFilter->num.degree / 2; i++)       /* re-sort wrt. z^-1 */
     {
-        case FTR_HIGHPASS:                /* lowpass->highpass transformation */
-            STDIIR_ERROR_RET (pFilter, ftrHighpass (pFilter, normOmega),
-                              "Lowpass->Highpass transformation");
-            break;
+        mathDoubleSwap (&pFilter->num.coeff[i],
+                        &pFilter->num.coeff[pFilter->num.degree - i]);
+
+        mathDoubleSwap (&pFilter->den.coeff[i],
+                        &pFilter->den.coeff[pFilter->den.degree - i]);
+    } /* for */
+
+
+    i = normFilterCoeffs (pFilter);
+
+    if (FLTERR_CRITICAL (i))
+    {
+        filterFree (pFilter);
+    } /* if */
+    else
+    {
+        if (roots && FLTERR_SUCCESS (i)) /* no coefficient dropped (degree ok) */
+        {
+            pFilter->factor = pFilter->num.coeff[0] / pFilter->den.coeff[0];
+        } /* if */
+    } /* else */
+
+    mathPolyArenaEnd ();                 /* release all temporary memory */
+
+    return i;
+} /* stdIirFilterGenWorker() */
+
+
+
+/* FUNCTION *******************************************************************/
+/** Calculates the minimum order of a standard IIR filter, which meets the
+ *  tolerance scheme given by \a ripple, \a minatt and \a width of the design.
+ *  Like the linear FIR designs the transition band(s) of width \a width are
+ *  centered at the cutoff frequency (or the band edges defined by center
+ *  frequency and bandwidth). All edges are mapped into \e Laplace domain by
+ *  bilinearInv(), then the selectivity of the lowpass prototype is evaluated
+ *  and the minimum order follows from the closed-form solution of its
+ *  approximation (see minOrderLowpass()).
+ *
+ *  After that the function sets the 3dB cutoff frequency (\a cutoff or \a fc
+ *  and \a bw of the frequency transformation), which is expected by
+ *  stdIirFilterGen(). \e Butterworth and \e Chebyshev lowpass filters meet
+ *  the passband edge exactly, the inverse \e Chebyshev lowpass meets the
+ *  stopband edge. For \e Cauer filters the module angle \a angle is set from
+ *  the selectivity, so that both edges are met.
+ *
+ *  \param pDesign      Pointer to standard IIR design data. The element
+ *                      \a order gets the minimum order.
+ *  \param f0           Sampling frequency.
+ *
+ *  \return             Zero on success, else an error number (see errno.h or
+ *                      gsl_errno.h for predefined codes). GSL_ETOL is
+ *                      returned if the minimum order exceeds FLT_DEGREE_MAX,
+ *                      GSL_EUNIMPL for \e Bessel filters.
+ ******************************************************************************/
+int stdIirFilterMinOrder (STDIIR_DESIGN *pDesign, double f0)
+{
+    FLTCOEFF proto;                                /* Cauer lowpass prototype */
+    gsl_error_handler_t *oldHandler;
+    double zPass[2], zStop[2];         /* passband/stopband edges in Z domain */
+    double pass[2], stop[2];     /* passband/stopband edges in Laplace domain */
+    double omega, order;
+    double center2 = 0.0;                /* squared center frequency of BP/BS */
+    double bw = 0.0;                           /* passband bandwidth of BP/BS */
+    int i;
+
+    int edges = 1;                          /* number of pass-/stopband edges */
+    double half = 0.5 * pDesign->width;
+    double dp = drosselung (pDesign->ripple);
+    double ds = drosselung (pDesign->minatt);
+    double selectivity = GSL_POSINF;          /* stopband/passband edge ratio */
+    double normOmega = 0.0;   /* 3dB frequency of prototype (passband edge 1) */
 
+    if (pDesign->type == STDIIR_TYPE_BESSEL)
+    {
+        return GSL_EUNIMPL;
+    } /* if */
+
+    if ((half <= 0.0) || (dp <= 0.0) || (ds <= dp))
+    {
+        return GSL_EDOM;
+    } /* if */
 
+
+    switch (pDesign->ftr.type)               /* edges of the tolerance scheme */
+    {
+        case FTR_BANDPASS:
         case FTR_BANDSTOP:
-            STDIIR_ERROR_RET (pFilter, ftrHighpass (pFilter, normOmega),
-                              "Lowpass->Bandstop transformation");
-                                                               /* fall trough */
+            omega = pDesign->ftr.fc - 0.5 * pDesign->ftr.bw;    /* lower edge */
 
-        case FTR_BANDPASS:                           /* LP->BP transformation */
-            STDIIR_ERROR_RET (pFilter, ftrBandpass (pFilter, normOmega, bpQuality),
-                              "Lowpass->Bandpass transformation");
-            break;  /* FTR_BANDPASS, FTR_BANDSTOP */
+            if (pDesign->ftr.flags & FTRDESIGN_FLAG_CENTER_GEOMETRIC)
+            {
+                omega = HYPOT (pDesign->ftr.fc, 0.5 * pDesign->ftr.bw) -
+                    0.5 * pDesign->ftr.bw;
+            } /* if */
 
+            if (pDesign->ftr.type == FTR_BANDSTOP)
+            {
+                half = -half;         /* passband outside of transition bands */
+            } /* if */
+
+            zPass[0] = omega + half;
+            zPass[1] = omega + pDesign->ftr.bw - half;
+            zStop[0] = omega - half;
+            zStop[1] = omega + pDesign->ftr.bw + half;
+            edges = 2;
+            break; /* FTR_BANDPASS, FTR_BANDSTOP */
 
-        case FTR_NON:
-            break;
 
+        case FTR_HIGHPASS:
+            zPass[0] = pDesign->ftr.fc + half;
+            zStop[0] = pDesign->ftr.fc - half;
+            break; /* FTR_HIGHPASS */
+
+
+        case FTR_NON: /* LOWPASS */
         default:
-            ASSERT(0);
-            break;
+            zPass[0] = pDesign->cutoff - half;
+            zStop[0] = pDesign->cutoff + half;
+            break; /* FTR_NON */
     } /* switch */
 
 
-    /* Scale standard approximation interval to normOmega / fc and
-       multiply with f0, which is the pre-factor of bilinear transformation.
-     */
-    normOmega = normOmega * pFilter->f0 / fc / M_PI;
+    for (i = 0; i < edges; i++)
+    {
+        if ((zPass[i] <= 0.0) || (zStop[i] <= 0.0) ||
+            (zPass[i] >= f0 / 2) || (zStop[i] >= f0 / 2))
+        {
+            return GSL_EDOM;
+        } /* if */
 
-    /* Denominator polynomial degree is greater/equal numerator polynomial
-     * degree for standard approximations. Compensate later the pre-factor
-     * (1+z)^{n-m} inserted by function mathPolyTransform().
-     */
-    degree = pFilter->den.degree - pFilter->num.degree;
-    ASSERT (degree >= 0);
+        pass[i] = bilinearInv (zPass[i], f0);
+        stop[i] = bilinearInv (zStop[i], f0);
+    } /* for */
 
-    STDIIR_ERROR_RET (pFilter, mathPolyTransform (&pFilter->den, 1, normOmega, -normOmega, 1, 1.0, 1.0),
-                      "Bilinear transformation and denormalization (denominator)");
-    STDIIR_ERROR_RET (pFilter, mathPolyTransform (&pFilter->num, 1, normOmega, -normOmega, 1, 1.0, 1.0),
-                      "Bilinear transformation and denormalization (numerator)");
 
-    for (i = 0; i < degree; i++)
+    /* Map the stopband edges onto the lowpass prototype, which has its
+     * passband edge at 1. For bandpass/bandstop the passband edges determine
+     * center and bandwidth, and the tighter stopband edge is relevant.
+     */
+    switch (pDesign->ftr.type)
     {
-        mathPolyMulBinomial (&pFilter->num, 1, 1.0, 1.0);
-    } /* for */
+        case FTR_BANDPASS:
+        case FTR_BANDSTOP:
+            center2 = pass[0] * pass[1];
+            bw = pass[1] - pass[0];
+
+            if ((bw <= 0.0) || (stop[1] <= stop[0]))
+            {
+                return GSL_EDOM;
+            } /* if */
 
+            for (i = 0; i < edges; i++)
+            {
+                omega = fabs (stop[i] * stop[i] - center2) / (stop[i] * bw);
 
-    for (i = 0; i <= pFilter->num.degree / 2; i++)       /* re-sort wrt. z^-1 */
+                if (pDesign->ftr.type == FTR_BANDSTOP)
+                {
+                    omega = 1.0 / omega;
+                } /* if */
+
+                selectivity = GSL_MIN_DBL (selectivity, omega);
+            } /* for */
+
+            break; /* FTR_BANDPASS, FTR_BANDSTOP */
+
+
+        case FTR_HIGHPASS:
+            selectivity = pass[0] / stop[0];
+            break; /* FTR_HIGHPASS */
+
+
+        case FTR_NON: /* LOWPASS */
+        default:
+            selectivity = stop[0] / pass[0];
+            break; /* FTR_NON */
+    } /* switch */
+
+
+    if (!(selectivity > 1.0))
     {
-        mathDoubleSwap (&pFilter->num.coeff[i],
-                        &pFilter->num.coeff[pFilter->num.degree - i]);
+        return GSL_EDOM;
+    } /* if */
 
-        mathDoubleSwap (&pFilter->den.coeff[i],
-                        &pFilter->den.coeff[pFilter->den.degree - i]);
-    } /* for */
+    oldHandler = gsl_set_error_handler_off ();
 
+    if ((pDesign->type == STDIIR_TYPE_CAUER1) ||
+        (pDesign->type == STDIIR_TYPE_CAUER2))
+    {              /* module angle from selectivity (stopband edge is at 1/k) */
+        pDesign->angle = GSL_MAX_DBL (asin (1.0 / selectivity) * 180.0 / M_PI,
+                                      STDIIR_ANGLE_MIN);
+        pDesign->angle = GSL_MIN_DBL (pDesign->angle, STDIIR_ANGLE_MAX);
+        selectivity = 1.0 / sin (pDesign->angle / 180.0 * M_PI);
+    } /* if */
 
-    i = normFilterCoeffs (pFilter);
+    order = ceil (minOrderLowpass (pDesign->type, selectivity, ds / dp) -
+                  STDIIR_MINORDER_EPS);
 
-    if (FLTERR_CRITICAL (i))
+    if (!gsl_finite (order) || (order * edges > FLT_DEGREE_MAX))
     {
-        filterFree (pFilter);
+        gsl_set_error_handler (oldHandler);
+        return GSL_ETOL;
     } /* if */
 
+    pDesign->order = GSL_MAX_INT ((int) order, 1);
+
+
+    switch (pDesign->type)              /* 3dB frequency of lowpass prototype */
+    {
+        case STDIIR_TYPE_BUTTERWORTH:          /* meets passband edge exactly */
+            normOmega = pow (dp, -1.0 / pDesign->order);
+            break;
+
+
+        case STDIIR_TYPE_CHEBY:                /* meets passband edge exactly */
+            normOmega = mathPolyChebyInv (pDesign->order, 1.0 / dp);
+            break;
+
+
+        case STDIIR_TYPE_CHEBYINV:             /* meets stopband edge exactly */
+            normOmega = selectivity / mathPolyChebyInv (pDesign->order, ds);
+            break;
+
+
+        case STDIIR_TYPE_CAUER1:
+        case STDIIR_TYPE_CAUER2:        /* meets both edges (by module angle) */
+            proto.f0 = f0;
+            proto.num.degree = proto.den.degree = pDesign->order;
+
+            if (filterMalloc (&proto) == 0)
+            {
+                mathPolyArenaBegin ();
+                normOmega = approxCauer (
+                    pDesign->type, pDesign->angle,
+                    (pDesign->type == STDIIR_TYPE_CAUER1) ? dp : ds, &proto);
+                mathPolyArenaEnd ();
+                filterFree (&proto);
+            } /* if */
+
+            break;
+
+
+        default:
+            ASSERT(0);
+    } /* switch */
+
     gsl_set_error_handler (oldHandler);
 
-    return i;
-} /* stdIirFilterGen() */
+    if (!(normOmega > 0.0))
+    {
+        return GSL_EFAILED;
+    } /* if */
+
+
+    switch (pDesign->ftr.type)          /* 3dB cutoff frequency into Z domain */
+    {
+        case FTR_BANDPASS:
+        case FTR_BANDSTOP:
+            if (pDesign->ftr.type == FTR_BANDPASS)
+            {
+                bw *= normOmega;
+            } /* if */
+            else
+            {
+                bw /= normOmega;
+            } /* else */
+
+            omega = sqrt (center2 + 0.25 * bw * bw);     /* arithmetic center */
+            zPass[0] = bilinear (omega - 0.5 * bw, f0);
+            zPass[1] = bilinear (omega + 0.5 * bw, f0);
+            pDesign->ftr.bw = zPass[1] - zPass[0];
+
+            if (pDesign->ftr.flags & FTRDESIGN_FLAG_CENTER_GEOMETRIC)
+            {
+                pDesign->ftr.fc = sqrt (zPass[0] * zPass[1]);
+            } /* if */
+            else
+            {
+                pDesign->ftr.fc = 0.5 * (zPass[0] + zPass[1]);
+            } /* else */
+
+            pDesign->order *= 2;         /* lowpass prototype has half degree */
+            break; /* FTR_BANDPASS, FTR_BANDSTOP */
+
+
+        case FTR_HIGHPASS:
+            pDesign->ftr.fc = bilinear (pass[0] / normOmega, f0);
+            break; /* FTR_HIGHPASS */
+
+
+        case FTR_NON: /* LOWPASS */
+        default:
+            pDesign->cutoff = bilinear (pass[0] * normOmega, f0);
+            break; /* FTR_NON */
+    } /* switch */
+
+    return 0;
+} /* stdIirFilterMinOrder() */
 
 
 